@@ -40,6 +40,11 @@ print([[
    (GeV)     (GeV^-1 m^-2 s^-1 sr^-1)     (s)
 ]])
 
+-- Freeze the simulation context and recycle the transport result, in order to
+-- avoid allocations within the event loop
+simulation.frozen = true
+local result = {}
+
 for ik = 1, 81 do
     local t0 = os.clock()
 
@@ -59,7 +64,7 @@ for ik = 1, 81 do
         state.weight = state.weight * 2
 
         -- Do the backward transport
-        simulation:transport(state)
+        simulation:transport_into(state, result)
 
         -- Sample the primary flux
         if flux:sample(state) then
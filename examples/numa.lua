@@ -0,0 +1,69 @@
+-- Benchmark the per NUMA node throughput of sharded simulations
+--
+-- Each shard transports muons through standard rock for a fixed duration.
+-- The number of transported events per second is printed per NUMA node. The
+-- scaling can be compared with and without binding shards to NUMA nodes, e.g.
+-- as:
+--
+--     luajit-pumas -j 64 examples/numa.lua [duration]
+--     luajit-pumas -j 64 -n examples/numa.lua [duration]
+--
+-- The -n option binds shards to NUMA nodes, such that the physics tables
+-- loaded by each shard are allocated locally.
+
+local ffi = require('ffi')
+local pumas = require('pumas')
+
+ffi.cdef [[
+struct numa_timeval {
+    long tv_sec;
+    long tv_usec;
+};
+
+int gettimeofday(struct numa_timeval *, void *);
+]]
+
+local function now ()
+    local t = ffi.new('struct numa_timeval')
+    ffi.C.gettimeofday(t, nil)
+    return tonumber(t.tv_sec) + 1E-06 * tonumber(t.tv_usec)
+end
+
+local job = pumas.job
+local duration = tonumber(arg[1]) or 10
+
+-- Load the physics tables, after the shard has been bound to its node
+local physics = pumas.Physics('share/materials/examples')
+local simulation = physics:Context('longitudinal hybrid')
+simulation.geometry = pumas.InfiniteGeometry('StandardRock')
+
+-- Transport muons for the requested duration
+local initial_state = pumas.State{energy = 1E+03}
+local state = pumas.State()
+local n, t0 = 0, now()
+local t1 = t0
+while t1 - t0 < duration do
+    for _ = 1, 100 do
+        state:set(initial_state)
+        simulation:transport(state)
+    end
+    n = n + 100
+    t1 = now()
+end
+
+-- Gather the statistics per NUMA node
+local node = job.node and string.format('node %d', job.node) or 'unbound'
+local stats = job.reduce{[node] = {shards = 1, events = n, time = t1 - t0}}
+
+local nodes = {}
+for k, _ in pairs(stats) do table.insert(nodes, k) end
+table.sort(nodes)
+
+print(string.format('%-12s %8s %14s %14s', 'node', 'shards', 'events / s',
+    'per shard'))
+for _, k in ipairs(nodes) do
+    local v = stats[k]
+    local rate = v.events / (v.time / v.shards)
+    print(string.format('%-12s %8d %14.0f %14.0f', k, v.shards, rate,
+        rate / v.shards))
+end
@@ -0,0 +1,120 @@
+/*
+ * Example of a PUMAS geometry plugin, providing a sphere.
+ *
+ * Build, e.g. on Linux, as:
+ *     gcc -o libsphere.so -shared -fPIC -O3 -I../../src -I$PUMAS_INC \
+ *         sphere.c -lm
+ *
+ * where PUMAS_INC points to the PUMAS headers, e.g. under
+ * build-release/src/pumas/include.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pumas_extensions.h"
+
+
+struct sphere {
+        struct pumas_geometry base;
+        struct pumas_medium * medium;
+        double center[3];
+        double radius;
+};
+
+
+/* Distance to the sphere surface, or 0 if there is no intersection ahead */
+static double sphere_distance(const struct sphere * sphere, const double * r,
+    const double * u)
+{
+        const double dr[3] = {r[0] - sphere->center[0],
+                              r[1] - sphere->center[1],
+                              r[2] - sphere->center[2]};
+        const double b = dr[0] * u[0] + dr[1] * u[1] + dr[2] * u[2];
+        const double c = dr[0] * dr[0] + dr[1] * dr[1] + dr[2] * dr[2] -
+            sphere->radius * sphere->radius;
+        const double delta = b * b - c;
+        if (delta <= 0) return 0;
+
+        const double sqrt_delta = sqrt(delta);
+        double d = -b - sqrt_delta;
+        if (d <= 0) d = -b + sqrt_delta;
+        return (d > 0) ? d : 0;
+}
+
+
+static void sphere_get(struct pumas_geometry * geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+#define STEP_MIN 1E-06
+
+        struct sphere * sphere = (void *)geometry;
+        struct pumas_state_extended * extended = (void *)state;
+        const double sgn =
+            (extended->context->mode.direction == PUMAS_MODE_FORWARD)? 1 : -1;
+        const double u[3] = {sgn * state->direction[0],
+                             sgn * state->direction[1],
+                             sgn * state->direction[2]};
+        const double * const r = state->position;
+
+        if (medium_p != NULL) {
+                /* Locate the position slightly ahead, in order to resolve
+                 * the boundary when the particle lies on the surface
+                 */
+                const double dr[3] = {
+                    r[0] + STEP_MIN * u[0] - sphere->center[0],
+                    r[1] + STEP_MIN * u[1] - sphere->center[1],
+                    r[2] + STEP_MIN * u[2] - sphere->center[2]};
+                const double d2 = dr[0] * dr[0] + dr[1] * dr[1] +
+                    dr[2] * dr[2];
+                *medium_p = (d2 < sphere->radius * sphere->radius) ?
+                    sphere->medium : NULL;
+        }
+
+        if (step_p != NULL) {
+                const double d = sphere_distance(sphere, r, u);
+                *step_p = (d > STEP_MIN) ? d : 0;
+        }
+
+#undef STEP_MIN
+}
+
+
+static struct pumas_geometry * sphere_create(const char * options,
+    struct pumas_medium ** media, int n_media)
+{
+        if (n_media != 1) return NULL;
+
+        struct sphere * sphere = calloc(1, sizeof(*sphere));
+        if (sphere == NULL) return NULL;
+
+        if ((options == NULL) || (sscanf(options, "%lf %lf %lf %lf",
+            sphere->center, sphere->center + 1, sphere->center + 2,
+            &sphere->radius) != 4) || (sphere->radius <= 0)) {
+                free(sphere);
+                return NULL;
+        }
+
+        sphere->base.get = &sphere_get;
+        sphere->base.destroy = (void *)&free;
+        sphere->base.exact = 1;
+        sphere->medium = media[0];
+
+        return &sphere->base;
+}
+
+
+static const struct pumas_plugin_geometry geometries[] = {
+        {"Sphere", &sphere_create}
+};
+
+static const struct pumas_plugin plugin = {
+        PUMAS_PLUGIN_VERSION, "sphere", 1, geometries, 0, NULL
+};
+
+
+const struct pumas_plugin * pumas_plugin_initialise(void)
+{
+        return &plugin;
+}
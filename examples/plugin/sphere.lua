@@ -0,0 +1,29 @@
+local pumas = require('pumas')
+
+-- Load materials tabulations
+local physics = pumas.Physics('share/materials/examples')
+
+-- Load the sphere plugin. See sphere.c for build instructions
+local plugin = pumas.load_geometry_plugin('./libsphere.so')
+
+-- Build the geometry, a sphere of standard rock with a radius of 100 m,
+-- placed in a world filled with air
+local world = pumas.InfiniteGeometry('Air')
+local sphere = plugin:geometry('Sphere', {'StandardRock'}, '0 0 0 100')
+world:insert(sphere)
+
+local simulation = physics:Context('csda')
+simulation.geometry = world
+
+-- Score the track length of muons crossing the sphere
+sphere:scoring(true)
+
+local state = pumas.State()
+local n = 10000
+for _ = 1, n do
+    state:set(pumas.State{energy = 1E+01})
+    simulation:transport(state)
+end
+
+local score = sphere:score()
+print(string.format('mean track length = %.5E m', score.length / n))
@@ -0,0 +1,70 @@
+local pumas = require('pumas')
+
+-- Settings for the simulation
+local latitude, longitude = 45, 3
+local top_altitude = 1600
+
+-- Build the geometry, an Earth with a flat topography
+local atmosphere = pumas.GradientMedium('Air', {
+    ['type'] = 'exponential', axis = 'vertical', lambda = -1E+04,
+    z0 = 0, rho0 = 1.205})
+local geometry = pumas.EarthGeometry{medium = atmosphere, data = top_altitude}
+
+-- Set the primary flux model
+local flux = pumas.MuonFlux{altitude = top_altitude}
+
+-- Create a backward simulation context
+local simulation = pumas.Context{
+    physics = 'share/materials/examples',
+    mode = 'backward longitudinal hybrid',
+    limit = {energy = 1E+08},
+    geometry = geometry
+}
+
+-- Set the template state for Monte Carlo particles
+local position = pumas.GeodeticPoint(latitude, longitude, 0)
+local frame = pumas.LocalFrame(position)
+local deg = math.pi / 180
+local direction = pumas.HorizontalVector{
+    azimuth = 0 * deg, elevation = -90 * deg, norm = 1, frame = frame}
+
+local initial_state = pumas.State{
+    position = position,
+    direction = direction
+}
+
+-- Create a generator drawing the final energy from a log-uniform PDF. The
+-- whole spectrum is estimated in a single pass
+local generator = pumas.BackwardGenerator{
+    context = simulation,
+    state = initial_state,
+    energy = {1E-02, 1E+06},
+    bins = 80
+}
+
+local t0 = os.clock()
+
+local state = pumas.State()
+for _ = 1, 1000000 do
+    -- Generate the final state and do the backward transport
+    generator:generate(state)
+    simulation:transport(state)
+
+    -- Sample the primary flux and update the Monte Carlo estimate
+    if flux:sample(state) then
+        generator:score(state)
+    end
+end
+
+local dt = os.clock() - t0
+
+print([[
+  energy        flux       sigma
+   (GeV)     (GeV^-1 m^-2 s^-1 sr^-1)
+]])
+
+local energy, spectrum, sigma = generator:spectrum()
+for i = 1, generator.bins do
+    print(string.format('%.5E  %.5E %.5E', energy[i], spectrum[i], sigma[i]))
+end
+print(string.format('\ntotal time: %.5E s', dt))
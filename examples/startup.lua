@@ -0,0 +1,41 @@
+-- Benchmark the startup time of luajit-pumas
+--
+-- The runtime is started repeatedly, with and without loading the pumas
+-- package. The mean wall time per start is printed. Usage:
+--
+--     luajit-pumas examples/startup.lua [repetitions]
+
+local ffi = require('ffi')
+
+ffi.cdef [[
+struct startup_timeval {
+    long tv_sec;
+    long tv_usec;
+};
+
+int gettimeofday(struct startup_timeval *, void *);
+]]
+
+local function now ()
+    local t = ffi.new('struct startup_timeval')
+    ffi.C.gettimeofday(t, nil)
+    return tonumber(t.tv_sec) + 1E-06 * tonumber(t.tv_usec)
+end
+
+local exe = _PREFIX..'/bin/luajit-pumas'
+local n = tonumber(arg[1]) or 100
+
+local function benchmark (label, command)
+    local t0 = now()
+    for _ = 1, n do
+        os.execute(string.format('%s -e "%s"', exe, command))
+    end
+    local dt = (now() - t0) / n
+    print(string.format('%-24s %8.2f ms', label, 1E+03 * dt))
+end
+
+benchmark('bare runtime', '')
+benchmark('require pumas', "require('pumas')")
+benchmark('access a material', "local _ = require('pumas').materials.Water")
+benchmark('iterate all materials',
+    "for _ in pairs(require('pumas').materials) do end")
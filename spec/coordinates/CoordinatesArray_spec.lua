@@ -0,0 +1,159 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.CoordinatesArray metatypes
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local metatype = require('pumas.metatype')
+local util = require('spec.util')
+
+
+-- ECEF coordinates for latitude = 1 deg, longitude = 2 deg, and altitude = 3 m
+-- Ref: http://walter.bislins.ch/bloge/index.asp?page=Rainy+Lake+Experiment%3A+WGS84+Calculator
+local ecef = {x = 6373290.28, y = 222560.20, z = 110568.83}
+
+
+describe('CoordinatesArray', function ()
+    describe('constructor', function ()
+        it('should default to zero', function ()
+            local a = pumas.CartesianPointArray(3)
+            assert.is.equal(a.size, 3)
+            assert.is.equal(#a, 3)
+            assert.is_nil(a.frame)
+            for i = 0, 2 do
+                assert.are.equals(a.x[i], a.y[i], a.z[i], 0)
+            end
+        end)
+
+        it('should properly set keyword attributes', function ()
+            local frame = pumas.LocalFrame(pumas.GeodeticPoint(1, 2, 3))
+            local a = pumas.HorizontalVectorArray{size = 2, frame = frame}
+            assert.is.equal(a.size, 2)
+            assert.is.equal(a.frame, frame)
+        end)
+
+        it('should initialise from another array', function ()
+            local a0 = pumas.GeodeticPointArray(1)
+            a0.latitude[0], a0.longitude[0], a0.altitude[0] = 1, 2, 3
+            local a1 = pumas.CartesianPointArray(a0)
+            assert.is.equal(util.round(a1.x[0], 2), ecef.x)
+            assert.is.equal(util.round(a1.y[0], 2), ecef.y)
+            assert.is.equal(util.round(a1.z[0], 2), ecef.z)
+        end)
+
+        it('should return a CoordinatesArray table', function ()
+            local a = pumas.GeodeticPointArray(1)
+            assert.is.equal(metatype(a), 'CoordinatesArray')
+        end)
+
+        it('should not accept a bad size', function ()
+            assert.has_error(function ()
+                pumas.CartesianVectorArray(-1)
+            end, "bad argument #1 to 'CartesianVectorArray' (size must be \z
+                a non negative integer)")
+        end)
+    end)
+
+    describe('clone', function ()
+        it('should return a copy', function ()
+            local a0 = pumas.CartesianPointArray(2)
+            a0.x[1] = 1
+            local a1 = a0:clone()
+            assert.is_not.equal(a0, a1)
+            assert.is_not.equal(a0.x, a1.x)
+            assert.is.equal(a1.x[1], 1)
+        end)
+    end)
+
+    describe('set', function ()
+        it('should match the scalar conversion', function ()
+            local geodetic = pumas.GeodeticPointArray(3)
+            for i = 0, 2 do
+                geodetic.latitude[i] = 45 * (i - 1)
+                geodetic.longitude[i] = 30 * i
+                geodetic.altitude[i] = 1E+03 * i
+            end
+
+            local cartesian = pumas.CartesianPointArray(geodetic)
+            local back = pumas.GeodeticPointArray(3):set(cartesian)
+            for i = 0, 2 do
+                local point = pumas.CartesianPoint(pumas.GeodeticPoint(
+                    geodetic.latitude[i], geodetic.longitude[i],
+                    geodetic.altitude[i]))
+                assert.is.equal(util.round(cartesian.x[i], 4),
+                    util.round(point.x, 4))
+                assert.is.equal(util.round(cartesian.y[i], 4),
+                    util.round(point.y, 4))
+                assert.is.equal(util.round(cartesian.z[i], 4),
+                    util.round(point.z, 4))
+                assert.is.equal(util.round(back.latitude[i], 9),
+                    geodetic.latitude[i])
+                assert.is.equal(util.round(back.longitude[i], 9),
+                    geodetic.longitude[i])
+                assert.is.equal(util.round(back.altitude[i], 6),
+                    geodetic.altitude[i])
+            end
+        end)
+
+        it('should convert horizontal vectors', function ()
+            local frame = pumas.LocalFrame(pumas.GeodeticPoint(1, 2, 3))
+            local horizontal = pumas.HorizontalVectorArray(1, frame)
+            horizontal.norm[0] = 1
+            horizontal.elevation[0] = math.rad(30)
+            horizontal.azimuth[0] = math.rad(60)
+
+            local cartesian = pumas.CartesianVectorArray(horizontal)
+            assert.is.equal(cartesian.frame, frame)
+            local vector = pumas.CartesianVector(pumas.HorizontalVector(
+                1, math.rad(30), math.rad(60), frame))
+            assert.is.equal(util.round(cartesian.x[0], 9),
+                util.round(vector.x, 9))
+            assert.is.equal(util.round(cartesian.y[0], 9),
+                util.round(vector.y, 9))
+            assert.is.equal(util.round(cartesian.z[0], 9),
+                util.round(vector.z, 9))
+        end)
+
+        it('should not accept inconsistent sizes', function ()
+            assert.has_error(function ()
+                pumas.CartesianPointArray(2):set(pumas.GeodeticPointArray(3))
+            end, "bad argument(s) to 'set' (inconsistent sizes (2 ~= 3))")
+        end)
+
+        it('should not accept a vector array', function ()
+            assert.has_error(function ()
+                pumas.CartesianPointArray(1):set(pumas.CartesianVectorArray(1))
+            end, "bad argument(s) to 'set' (not implemented)")
+        end)
+    end)
+
+    describe('transform', function ()
+        it('should match the scalar transform', function ()
+            local frame = pumas.LocalFrame(pumas.GeodeticPoint(1, 2, 3))
+            local a = pumas.CartesianPointArray(1)
+            a.x[0], a.y[0], a.z[0] = ecef.x, ecef.y, ecef.z
+            a:transform(frame)
+            assert.is.equal(a.frame, frame)
+
+            local point = pumas.CartesianPoint(ecef.x, ecef.y, ecef.z)
+            point:transform(frame)
+            assert.is.equal(util.round(a.x[0], 6), util.round(point.x, 6))
+            assert.is.equal(util.round(a.y[0], 6), util.round(point.y, 6))
+            assert.is.equal(util.round(a.z[0], 6), util.round(point.z, 6))
+
+            a:transform(nil)
+            assert.is_nil(a.frame)
+            assert.is.equal(util.round(a.x[0], 2), ecef.x)
+        end)
+
+        it('should preserve the horizontal angles', function ()
+            local frame = pumas.LocalFrame(pumas.GeodeticPoint(1, 2, 3))
+            local a = pumas.HorizontalVectorArray(1, frame)
+            a.norm[0], a.elevation[0], a.azimuth[0] = 2, 0.5, 0.25
+            a:transform(nil):transform(frame)
+            assert.is.equal(util.round(a.norm[0], 9), 2)
+            assert.is.equal(util.round(a.elevation[0], 9), 0.5)
+            assert.is.equal(util.round(a.azimuth[0], 9), 0.25)
+        end)
+    end)
+end)
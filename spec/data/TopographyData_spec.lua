@@ -3,6 +3,8 @@
 -- Author: Valentin Niess
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
+local ffi = require('ffi')
+local lfs = require('lfs')
 local pumas = require('pumas')
 local metatype = require('pumas.metatype')
 local util = require('spec.util')
@@ -26,6 +28,37 @@ describe('TopographyData', function ()
             assert.is.equal(1, d1.offset)
         end)
 
+        it('should cache maps', function ()
+            local cache = 'spec/cache'
+            local d0 = pumas.TopographyData('spec/map-2x2.png', 1, cache)
+
+            -- The cache file is keyed on a hash of the absolute path
+            local path
+            for name in lfs.dir(cache) do
+                if name:match('^map%-2x2%.png%-%x+%.map$') then
+                    path = cache..'/'..name
+                end
+            end
+            assert.is_not_nil(path)
+
+            -- Load the map from the cache
+            local d1 = pumas.TopographyData('spec/map-2x2.png', 1, cache)
+            assert.is.equal(util.round(d0:elevation(45.5, 3.5), 3),
+                util.round(d1:elevation(45.5, 3.5), 3))
+            assert.is.equal(nil, d1:elevation(0, 0))
+            os.remove(path)
+            lfs.rmdir(cache)
+
+            assert.has_error(function ()
+                pumas.TopographyData('spec/no-such-map.png', 1, cache)
+            end)
+
+            assert.has_error(function ()
+                pumas.TopographyData('spec/map-2x2.png', 1, 2)
+            end, "bad argument #3 to 'TopographyData' (expected a string \z
+                or nil, got a number)")
+        end)
+
         it('should properly get and set the offset attribute', function ()
             local d = pumas.TopographyData()
             d.offset = 1
@@ -77,6 +110,97 @@ describe('TopographyData', function ()
             local d1 = pumas.TopographyData(1)
             assert.is.equal(1, d1:elevation(0, 0))
         end)
+
+        it('should provide elevation for arrays', function ()
+            local d0 = pumas.TopographyData('spec/map-2x2.png', 1)
+            local z = d0:elevation({45.5, 0}, {3.5, 0})
+            assert.is.equal('table', type(z))
+            assert.is.equal(2, util.round(z[1], 1))
+            assert.is_true(z[2] ~= z[2])
+
+            local latitude = ffi.new('double [3]', 45.5, 45.5, 45.5)
+            local longitude = ffi.new('double [3]', 3.5, 3.5, 3.5)
+            local output = ffi.new('double [3]')
+            z = d0:elevation(latitude, longitude, output, 3)
+            assert.is.equal(output, z)
+            for i = 0, 2 do
+                assert.is.equal(2, util.round(z[i], 1))
+            end
+        end)
+
+        it('should provide elevation for arrays over threads', function ()
+            -- A stack of a single tile, queried through TURTLE clients
+            local stack = 'spec/stack'
+            lfs.mkdir(stack)
+            local tile = stack..'/map-2x2.png'
+            local file = io.open('spec/map-2x2.png', 'rb')
+            local data = file:read('*a')
+            file:close()
+            file = io.open(tile, 'wb')
+            file:write(data)
+            file:close()
+
+            local ok, err = pcall(function ()
+                local d0 = pumas.TopographyData(stack, 1)
+                local n = 1000
+                local latitude = ffi.new('double [?]', n)
+                local longitude = ffi.new('double [?]', n)
+                for i = 0, n - 1 do
+                    latitude[i] = (i % 2 == 0) and 45.5 or 0
+                    longitude[i] = (i % 2 == 0) and 3.5 or 0
+                end
+                local z = d0:elevation(latitude, longitude, nil, 4)
+                for i = 0, n - 1 do
+                    if i % 2 == 0 then
+                        assert.is.equal(2, util.round(z[i], 1))
+                    else
+                        assert.is_true(z[i] ~= z[i])
+                    end
+                end
+            end)
+            os.remove(tile)
+            lfs.rmdir(stack)
+            if not ok then error(err, 0) end
+        end)
+
+        it('should raise an error for bad arrays', function ()
+            local d0 = pumas.TopographyData(1)
+            assert.has_error(function ()
+                d0:elevation({0, 0}, {0})
+            end, "bad argument #3 to 'elevation' (expected 2 values, got 1)")
+
+            local latitude = ffi.new('double [2]')
+            assert.has_error(function ()
+                d0:elevation(ffi.cast('double *', latitude), latitude)
+            end, "bad argument #2 to 'elevation' (expected a number, \z
+                a table or a double [?] cdata, got a cdata)")
+            assert.has_error(function ()
+                d0:elevation(latitude, ffi.new('float [2]'))
+            end, "bad argument #3 to 'elevation' (expected a number, \z
+                a table or a double [?] cdata, got a cdata)")
+
+            assert.has_error(function ()
+                d0:elevation(latitude, latitude, nil, 1.5)
+            end, "bad argument 'threads' to 'elevation' (expected a \z
+                positive integer or zero, got 1.5)")
+            local z = d0:elevation(latitude, latitude, nil, 0)
+            assert.is.equal(1, z[1])
+        end)
+    end)
+
+    describe('project', function ()
+        it('should provide map coordinates', function ()
+            local d0 = pumas.TopographyData('spec/map-2x2.png')
+            local x, y = d0:project(45.5, 3.5)
+            local xs, ys = d0:project({45.5}, {3.5})
+            assert.is.equal(x, xs[1])
+            assert.is.equal(y, ys[1])
+
+            local d1 = pumas.TopographyData(1)
+            x, y = d1:project(45.5, 3.5)
+            assert.is.equal(3.5, x)
+            assert.is.equal(45.5, y)
+        end)
     end)
 
     describe('__add', function ()
@@ -66,6 +66,16 @@ describe('TopographyDataset', function ()
             assert.is.equal(1, util.round(s:elevation(45.5, 3.5), 1))
             assert.is.equal(2, s:elevation(0, 0))
         end)
+
+        it('should provide elevation for arrays', function ()
+            local s = pumas.TopographyDataset('spec/map-2x2.png', 2)
+            local z = s:elevation({45.5, 0}, {3.5, 0})
+            assert.is.equal(1, util.round(z[1], 1))
+            assert.is.equal(2, z[2])
+
+            local z1 = s:elevation({45.5, 0}, {3.5, 0}, nil, 2)
+            assert.are.same(z, z1)
+        end)
     end)
 
     describe('__add', function ()
@@ -0,0 +1,141 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.EarthGeometry metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local physics = require('spec.physics')
+local util = require('spec.util')
+
+
+describe('EarthGeometry', function ()
+    describe('flat layers', function ()
+        local geometry = pumas.EarthGeometry(
+            {'Water', 100}, {'StandardRock', 0})
+        local context = physics.muon:Context{geometry = geometry}
+
+        local function State (altitude, elevation)
+            local position = pumas.GeodeticPoint(45, 3, altitude)
+            local frame = pumas.LocalFrame(position)
+            local direction = pumas.HorizontalVector{
+                norm = 1, elevation = math.rad(elevation), azimuth = 0,
+                frame = frame}
+            return pumas.State{position = position, direction = direction}
+        end
+
+        it('should locate the layers', function ()
+            local layers = geometry.layers
+            assert.is.equal(layers[2].medium, context:medium(State(-10, 90)))
+            assert.is.equal(layers[1].medium, context:medium(State(50, 90)))
+            assert.is_nil(context:medium(State(200, 90)))
+        end)
+
+        it('should compute exact distances to the layers', function ()
+            local _, step = context:medium(State(50, 90))
+            assert.is.equal(50, util.round(step, 2))
+
+            _, step = context:medium(State(50, -90))
+            assert.is.equal(50, util.round(step, 2))
+
+            _, step = context:medium(State(-10, 90))
+            assert.is.equal(10, util.round(step, 2))
+        end)
+
+        it('should transport through the layers', function ()
+            local state = State(-10, 90)
+            state.energy = 1E+03
+            context.event = pumas.Event('medium')
+            local event, media = context:transport(state)
+            assert.is_true(event.medium)
+            assert.is.equal(geometry.layers[2].medium, media[1])
+            assert.is.equal(geometry.layers[1].medium, media[2])
+            local position = pumas.GeodeticPoint():set(state.position)
+            assert.is.equal(0, util.round(position.altitude, 3))
+        end)
+
+        it('should score the layers', function ()
+            assert.is_nil(geometry:score())
+            geometry:scoring(true)
+
+            local c = physics.muon:Context('forward csda longitudinal')
+            c.geometry = geometry
+            c.limit.distance = 5
+
+            local n, energy, grammage = 10, 0, 0
+            for _ = 1, n do
+                local state = State(-10, 90)
+                state.energy = 1
+                state.weight = 2
+                c:transport(state)
+                energy = energy + 2 * (1 - state.energy)
+                grammage = grammage + 2 * state.grammage
+            end
+
+            local score = geometry:score()
+            assert.is.equal(0, score.crossings)
+            assert.is.equal(2 * n * 5, util.round(score.length, 6))
+            assert.is.equal(util.round(energy, 9),
+                util.round(score.energy, 9))
+            assert.is.equal(util.round(grammage, 6),
+                util.round(score.grammage, 6))
+
+            geometry:scoring(true)
+            assert.are.same({crossings = 0, energy = 0, grammage = 0,
+                length = 0}, geometry:score())
+
+            geometry:scoring(false)
+            assert.is_nil(geometry:score())
+        end)
+    end)
+
+    describe('update', function ()
+        it('should recycle unmodified volumes', function ()
+            local world = pumas.InfiniteGeometry('Air')
+            local earth = pumas.EarthGeometry({'StandardRock', 0})
+            world:insert(earth)
+            local context = physics.muon:Context{geometry = world}
+
+            local position = pumas.GeodeticPoint(45, 3, -10)
+            assert.is.equal(earth.layers[1].medium, context:medium(position))
+
+            world:remove()
+            assert.is.equal(world.medium, context:medium(position))
+
+            world:insert(earth)
+            assert.is.equal(earth.layers[1].medium, context:medium(position))
+
+            world.medium = pumas.UniformMedium('Water')
+            position.altitude = 10
+            assert.is.equal(world.medium, context:medium(position))
+            position.altitude = -10
+            assert.is.equal(earth.layers[1].medium, context:medium(position))
+        end)
+
+        it('should navigate consistently', function ()
+            local world = pumas.InfiniteGeometry('Air')
+            world:insert(pumas.EarthGeometry(
+                {'Water', 100}, {'StandardRock', 0}))
+            local context = physics.muon:Context{geometry = world}
+
+            local altitudes = {-10, 50, 200, 50, -10}
+            local function navigate ()
+                local media, steps = {}, {}
+                for i, altitude in ipairs(altitudes) do
+                    local position = pumas.GeodeticPoint(45, 3, altitude)
+                    media[i], steps[i] = context:medium(position)
+                end
+                return media, steps
+            end
+
+            -- Compare the flat navigation to the recursive one, used with a
+            -- debug callback
+            local media, steps = navigate()
+            local n = 0
+            context.geometry_callback = function () n = n + 1 end
+            local media_, steps_ = navigate()
+            assert.is_true(n > 0)
+            assert.are.same(media, media_)
+            assert.are.same(steps, steps_)
+        end)
+    end)
+end)
@@ -0,0 +1,167 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.MeshGeometry metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local physics = require('spec.physics')
+local util = require('spec.util')
+
+
+-- Triangles of an axis aligned box, with outward going normals
+local function Box (x0, y0, z0, x1, y1, z1, inward)
+    local p = {
+        {x0, y0, z0}, {x1, y0, z0}, {x0, y1, z0}, {x1, y1, z0},
+        {x0, y0, z1}, {x1, y0, z1}, {x0, y1, z1}, {x1, y1, z1}}
+    local quads = {
+        {1, 3, 4, 2}, {5, 6, 8, 7}, {1, 2, 6, 5},
+        {3, 7, 8, 4}, {1, 5, 7, 3}, {2, 4, 8, 6}}
+    local triangles = {}
+    for _, q in ipairs(quads) do
+        for _, t in ipairs{{q[1], q[2], q[3]}, {q[1], q[3], q[4]}} do
+            if inward then t[2], t[3] = t[3], t[2] end
+            for _, i in ipairs(t) do
+                for k = 1, 3 do table.insert(triangles, p[i][k]) end
+            end
+        end
+    end
+    return triangles
+end
+
+
+describe('MeshGeometry', function ()
+    local function State (x, y, z, ux, uy, uz)
+        return pumas.State{position = {x, y, z}, direction = {ux, uy, uz}}
+    end
+
+    describe('convex mesh', function ()
+        local geometry = pumas.MeshGeometry('StandardRock',
+            Box(0, 0, 0, 1, 1, 1))
+        local context = physics.muon:Context{geometry = geometry}
+
+        it('should have attributes', function ()
+            assert.is.equal(12, geometry.triangles)
+            assert.is.equal('Medium', geometry.medium.__metatype)
+            assert.has_error(function () geometry.triangles = 1 end,
+                "cannot modify 'triangles' for 'MeshGeometry'")
+        end)
+
+        it('should compute distances to the mesh', function ()
+            local medium, step = context:medium(State(0.5, 0.5, 0.5, 1, 0, 0))
+            assert.is.equal(geometry.medium, medium)
+            assert.is.equal(0.5, util.round(step, 6))
+
+            medium, step = context:medium(State(-1, 0.5, 0.5, 1, 0, 0))
+            assert.is_nil(medium)
+            assert.is.equal(1, util.round(step, 6))
+
+            medium = context:medium(State(-1, 0.5, 0.5, -1, 0, 0))
+            assert.is_nil(medium)
+        end)
+
+        it('should not leak through edges', function ()
+            local u = 1 / math.sqrt(2)
+            local medium, step = context:medium(State(-1, -1, 0.5, u, u, 0))
+            assert.is_nil(medium)
+            assert.is.equal(util.round(math.sqrt(2), 6), util.round(step, 6))
+
+            medium = context:medium(State(0.5, 0.5, 0.5, u, u, 0))
+            assert.is.equal(geometry.medium, medium)
+        end)
+
+        it('should support a reference frame', function ()
+            local frame = pumas.UnitaryTransformation{translation = {1, 0, 0}}
+            local g = pumas.MeshGeometry('StandardRock',
+                Box(0, 0, 0, 1, 1, 1), frame)
+            local c = physics.muon:Context{geometry = g}
+            assert.is_nil(c:medium(State(0.5, 0.5, 0.5, 0, 0, 1)))
+            assert.is.equal(g.medium, c:medium(State(1.5, 0.5, 0.5, 0, 0, 1)))
+        end)
+    end)
+
+    describe('non convex mesh', function ()
+        -- A hollow box, i.e. a shell
+        local triangles = Box(0, 0, 0, 3, 3, 3)
+        for _, v in ipairs(Box(1, 1, 1, 2, 2, 2, true)) do
+            table.insert(triangles, v)
+        end
+        local geometry = pumas.MeshGeometry('StandardRock', triangles)
+        local context = physics.muon:Context{geometry = geometry}
+
+        it('should locate the cavity', function ()
+            local medium, step = context:medium(State(1.5, 1.5, 1.5, 1, 0, 0))
+            assert.is_nil(medium)
+            assert.is.equal(0.5, util.round(step, 6))
+
+            medium, step = context:medium(State(0.5, 1.5, 1.5, 1, 0, 0))
+            assert.is.equal(geometry.medium, medium)
+            assert.is.equal(0.5, util.round(step, 6))
+
+            medium, step = context:medium(State(0.5, 0.5, 1.5, 1, 0, 0))
+            assert.is.equal(geometry.medium, medium)
+            assert.is.equal(2.5, util.round(step, 6))
+        end)
+
+        it('should transport through the cavity', function ()
+            local state = State(0.5, 1.5, 1.5, 1, 0, 0)
+            state.energy = 1E+03
+            local c = physics.muon:Context('forward csda')
+            c.geometry = geometry
+            c.event = pumas.Event('medium')
+            local event, media = c:transport(state)
+            assert.is_true(event.medium)
+            assert.is.equal(geometry.medium, media[1])
+            assert.is_nil(media[2])
+            assert.is.equal(1, util.round(state.position[0], 3))
+        end)
+    end)
+
+    describe('loaders', function ()
+        local triangles = Box(0, 0, 0, 1, 1, 1)
+
+        it('should load ASCII STL files', function ()
+            local path = 'test.stl'
+            local file = io.open(path, 'w')
+            file:write('solid box\n')
+            for i = 0, #triangles / 9 - 1 do
+                file:write('facet normal 0 0 0\nouter loop\n')
+                for j = 0, 2 do
+                    local k = 9 * i + 3 * j
+                    file:write(string.format('vertex %g %g %g\n',
+                        triangles[k + 1], triangles[k + 2], triangles[k + 3]))
+                end
+                file:write('endloop\nendfacet\n')
+            end
+            file:write('endsolid box\n')
+            file:close()
+
+            local geometry = pumas.MeshGeometry('StandardRock', path)
+            os.remove(path)
+            assert.is.equal(12, geometry.triangles)
+        end)
+
+        it('should load OBJ files', function ()
+            local path = 'test.obj'
+            local file = io.open(path, 'w')
+            file:write('v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\n')
+            file:write('f 1 4 3 2\nf 1 2 5\nf 2/1 3/2 5/3\nf -2 -5 -4\n')
+            file:write('f 4 1 5\n')
+            file:close()
+
+            local geometry = pumas.MeshGeometry('StandardRock', path)
+            os.remove(path)
+            assert.is.equal(6, geometry.triangles)
+        end)
+
+        it('should raise an error for bad arguments', function ()
+            assert.has_error(function ()
+                pumas.MeshGeometry('StandardRock', {1, 2})
+            end, "bad argument #2 to 'MeshGeometry' (expected n x 9 values, \z
+                got 2)")
+
+            assert.has_error(function ()
+                pumas.MeshGeometry('StandardRock', 'mesh.ply')
+            end, "bad argument #2 to 'MeshGeometry' (unknown format ply)")
+        end)
+    end)
+end)
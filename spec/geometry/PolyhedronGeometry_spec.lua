@@ -0,0 +1,124 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.PolyhedronGeometry metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local physics = require('spec.physics')
+local util = require('spec.util')
+
+
+describe('PolyhedronGeometry', function ()
+    describe('export', function ()
+        -- A cube with a redundant face, containing a pyramid
+        local s = 1 / math.sqrt(2)
+        local geometry = pumas.PolyhedronGeometry{'StandardRock', {
+             1,  0,  0,  1,  0,  0,
+            -1,  0,  0, -1,  0,  0,
+             0,  1,  0,  0,  1,  0,
+             0, -1,  0,  0, -1,  0,
+             0,  0,  1,  0,  0,  1,
+             0,  0, -1,  0,  0, -1,
+             0,  0,  2,  0,  0,  1}, {
+            {'Water', {
+                0, 0, 0, 0, 0, -1,
+                0, 0, 0.5, s, 0, s,
+                0, 0, 0.5, -s, 0, s,
+                0, 0, 0.5, 0, s, s,
+                0, 0, 0.5, 0, -s, s}}}}
+
+        it('should export to PLY', function ()
+            geometry:export('test.ply', {color = function (medium)
+                if medium.material == 'Water' then
+                    return 0, 0, 255, 255
+                else
+                    return 255, 0, 0, 255
+                end
+            end})
+            local file = io.open('test.ply', 'rb')
+            local data = file:read('*a')
+            file:close()
+            os.remove('test.ply')
+
+            -- 6 squares and 1 square + 4 triangles
+            local n_vertices = tonumber(data:match('element vertex (%d+)'))
+            local n_faces = tonumber(data:match('element face (%d+)'))
+            assert.is.equal(24 + 16, n_vertices)
+            assert.is.equal(12 + 6, n_faces)
+
+            local header = data:match('^(.-end_header\n)')
+            assert.is.equal(#header + 28 * n_vertices + 13 * n_faces, #data)
+        end)
+    end)
+
+    describe('score', function ()
+        it('should score crossed volumes', function ()
+            -- A cube of rock, with a half width of 1 m, in water
+            local world = pumas.InfiniteGeometry('Water')
+            local cube = pumas.PolyhedronGeometry{'StandardRock', {
+                 1,  0,  0,  1,  0,  0,
+                -1,  0,  0, -1,  0,  0,
+                 0,  1,  0,  0,  1,  0,
+                 0, -1,  0,  0, -1,  0,
+                 0,  0,  1,  0,  0,  1,
+                 0,  0, -1,  0,  0, -1}}
+            world:insert(cube)
+            world:scoring(true)
+            cube:scoring(true)
+
+            local c = physics.muon:Context('forward csda longitudinal')
+            c.geometry = world
+            c.limit.distance = 3
+
+            -- Tracks start at the cube centre and end in water
+            local n, w = 10, 2
+            local origin = pumas.CartesianPoint(0, 0, 0)
+            local up = pumas.CartesianVector(0, 0, 1)
+            local grammage = 0
+            for _ = 1, n do
+                local state = pumas.State{position = origin, direction = up,
+                    energy = 1, weight = w}
+                c:transport(state)
+                grammage = grammage + w * state.grammage
+            end
+
+            local rock = cube:score()
+            local water = world:score()
+            assert.is.equal(0, rock.crossings)
+            assert.is.equal(n * w, water.crossings)
+            assert.is.equal(n * w * 1, util.round(rock.length, 6))
+            assert.is.equal(n * w * 2, util.round(water.length, 6))
+
+            c.limit.distance = 1
+            local rho_rock = c:grammage(origin, up)
+            c.geometry = pumas.InfiniteGeometry('Water')
+            local rho_water = c:grammage(origin, up)
+            assert.is.equal(util.round(n * w * rho_rock, 6),
+                util.round(rock.grammage, 6))
+            assert.is.equal(util.round(n * w * 2 * rho_water, 6),
+                util.round(water.grammage, 6))
+            assert.is.equal(util.round(grammage, 6),
+                util.round(rock.grammage + water.grammage, 6))
+        end)
+    end)
+
+    describe('release', function ()
+        it('should collect contexts and geometries in any order', function ()
+            for _ = 1, 10 do
+                local world = pumas.InfiniteGeometry('Water')
+                world:insert(pumas.PolyhedronGeometry{'StandardRock', {
+                     1,  0,  0,  1,  0,  0,
+                    -1,  0,  0, -1,  0,  0,
+                     0,  1,  0,  0,  1,  0,
+                     0, -1,  0,  0, -1,  0,
+                     0,  0,  1,  0,  0,  1,
+                     0,  0, -1,  0,  0, -1}})
+                local context = physics.muon:Context{geometry = world}
+                local medium = context:medium(pumas.CartesianPoint())
+                assert.is.equal('StandardRock', medium.material)
+            end
+            collectgarbage()
+            collectgarbage()
+        end)
+    end)
+end)
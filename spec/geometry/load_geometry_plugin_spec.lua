@@ -0,0 +1,120 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.load_geometry_plugin function
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local physics = require('spec.physics')
+
+
+-- Compile a plugin from C source, using the headers of the build tree
+local function compile (source, path)
+    local build = os.getenv('BUILD_DIR') or 'build-release'
+    local include = {'-Isrc'}
+    for _, package in ipairs{'gull', 'pumas', 'turtle'} do
+        table.insert(include, '-I'..build..'/src/'..package..'/include')
+    end
+    local command = string.format('%s -o %s -shared -fPIC %s %s -lm',
+        os.getenv('CC') or 'cc', path, table.concat(include, ' '), source)
+    local rc = os.execute(command..' > /dev/null 2>&1')
+    return (rc == 0) or (rc == true)
+end
+
+
+describe('load_geometry_plugin', function ()
+    it('should catch errors', function ()
+        assert.has_error(function ()
+            pumas.load_geometry_plugin(1)
+        end, "bad argument #1 to 'load_geometry_plugin' \z
+            (expected a string, got a number)")
+
+        assert.has_error(function ()
+            pumas.load_geometry_plugin('./no-such-plugin.so')
+        end)
+    end)
+
+    it('should load the sphere example', function ()
+        local path = './libsphere-spec.so'
+        if not compile('examples/plugin/sphere.c', path) then
+            pending('could not compile the sphere plugin')
+            return
+        end
+
+        local plugin = pumas.load_geometry_plugin(path)
+        assert.is.equal('GeometryPlugin', plugin.__metatype)
+        assert.is.equal('sphere', plugin.name)
+        assert.is.equal(path, plugin.path)
+        assert.are.same({'Sphere'}, plugin.geometries)
+        assert.are.same({}, plugin.media)
+        assert.is.equal(plugin, pumas.load_geometry_plugin(path))
+
+        -- Navigate a sphere of radius 10 m, centred on the origin
+        local geometry = plugin:geometry('Sphere', {'StandardRock'},
+            '0 0 0 10')
+        assert.is.equal('Sphere', geometry.name)
+        assert.is.equal(plugin, geometry.plugin)
+        local context = physics.muon:Context('csda longitudinal')
+        context.geometry = geometry
+        local state = pumas.State()
+        state.direction = pumas.CartesianVector(0, 0, 1)
+
+        state.position = pumas.CartesianPoint(0, 0, 0)
+        local medium, step = context:medium(state)
+        assert.is.equal(geometry.media[1], medium)
+        assert.is.equal('StandardRock', medium.material)
+        assert.is.near(10, step, 1E-09)
+
+        state.position = pumas.CartesianPoint(0, 0, -15)
+        medium, step = context:medium(state)
+        assert.is_nil(medium)
+        assert.is.near(5, step, 1E-09)
+
+        state.position = pumas.CartesianPoint(0, 0, 15)
+        medium, step = context:medium(state)
+        assert.is_nil(medium)
+        assert.is.equal(0, step)
+
+        -- Transport a muon out of the sphere
+        state:set(pumas.State{energy = 1E+01})
+        local event, media = context:transport(state)
+        assert.is_true(event.medium)
+        assert.is.equal(geometry.media[1], media[1])
+        assert.is_nil(media[2])
+        assert.is.near(10, state.distance, 1E-06)
+
+        -- Bad options are reported when the geometry is instantiated
+        context.geometry = plugin:geometry('Sphere', {'StandardRock'},
+            '0 0 0 -1')
+        assert.has_error(function () context:medium(state) end)
+
+        os.remove(path)
+    end)
+
+    it('should check the plugin version', function ()
+        local source, path = './plugin-spec.c', './libplugin-spec.so'
+        local file = io.open(source, 'w')
+        file:write([[
+#include "pumas_extensions.h"
+
+static const struct pumas_plugin plugin = {0, "bad", 0, NULL, 0, NULL};
+
+const struct pumas_plugin * pumas_plugin_initialise(void)
+{
+        return &plugin;
+}
+]])
+        file:close()
+        local ok = compile(source, path)
+        os.remove(source)
+        if not ok then
+            pending('could not compile the test plugin')
+            return
+        end
+
+        assert.has_error(function ()
+            pumas.load_geometry_plugin(path)
+        end, "bad argument #1 to 'load_geometry_plugin' \z
+            (incompatible version (expected 1, got 0))")
+        os.remove(path)
+    end)
+end)
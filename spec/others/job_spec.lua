@@ -0,0 +1,137 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.job sub-package
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local job = require('pumas.job')
+local metatype = require('pumas.metatype')
+
+
+describe('job', function ()
+    it('should describe a single shard by default', function ()
+        assert.is.equal('table', type(pumas.job))
+        assert.is.equal(1, pumas.job.index)
+        assert.is.equal(1, pumas.job.count)
+        assert.is_nil(pumas.job.node)
+        assert.is_nil(pumas.job.seed)
+        assert.is_nil(pumas.job.results)
+    end)
+
+    it('should not reduce values when not sharding', function ()
+        local a, b, c = pumas.job.reduce(1, nil, 'x')
+        assert.is.equal(1, a)
+        assert.is_nil(b)
+        assert.is.equal('x', c)
+    end)
+
+    describe('run', function ()
+        local script = 'test-job.lua'
+        local info = pumas.job
+
+        local function write_script (source)
+            local file = io.open(script, 'w')
+            file:write(source)
+            file:close()
+        end
+
+        after_each(function ()
+            os.remove(script)
+            info.index, info.count, info.seed = 1, 1, nil
+            info.node, info.results = nil, nil
+        end)
+
+        local function skip_windows ()
+            if require('jit').os == 'Windows' then
+                pending('job sharding is not supported on Windows')
+                return true
+            end
+        end
+
+        it('should merge the results of shards', function ()
+            if skip_windows() then return end
+            write_script([[
+local pumas = require('pumas')
+local physics = require('spec.physics')
+local context = physics.muon:Context()
+return pumas.job.index, {[pumas.job.index] = context.random_seed}, 'x'
+]])
+            job.run(2, script)
+
+            local results = info.results
+            assert.is.equal(3, results.n)
+            assert.is.equal(3, results[1])
+            assert.is.equal('x', results[3])
+
+            -- Contexts of different shards get distinct seeds
+            local seeds = results[2]
+            assert.is.equal(info.seed % 2^32, seeds[1])
+            assert.is.equal((info.seed + 1) % 2^32, seeds[2])
+        end)
+
+        it('should report failing shards', function ()
+            if skip_windows() then return end
+            write_script([[
+local pumas = require('pumas')
+if pumas.job.index > 1 then error('toto') end
+return 1
+]])
+            assert.has_error(function () job.run(2, script) end,
+                'shard(s) 2 failed')
+        end)
+    end)
+
+    describe('encode', function ()
+        it('should transfer values', function ()
+            local t = pumas.Tally{x = {field = 'energy', bins = 2,
+                range = {1, 2}}}
+            local values = job.decode(job.encode(1.5, nil, true,
+                'a\0b\n', {x = 1, y = {2, 3}}, t, 1 / 0))
+            assert.is.equal(7, values.n)
+            assert.is.equal(1.5, values[1])
+            assert.is_nil(values[2])
+            assert.is_true(values[3])
+            assert.is.equal('a\0b\n', values[4])
+            assert.are.same({x = 1, y = {2, 3}}, values[5])
+            assert.is.equal('Tally', metatype(values[6]))
+            assert.is.equal(t:dump(), values[6]:dump())
+            assert.is.equal(math.huge, values[7])
+        end)
+
+        it('should raise an error for bad values', function ()
+            assert.has_error(function () job.encode(print) end,
+                'cannot transfer a function')
+
+            local t = {}
+            t.t = t
+            assert.has_error(function () job.encode(t) end,
+                'cannot transfer a recursive table')
+        end)
+    end)
+
+    describe('merge', function ()
+        it('should merge values', function ()
+            assert.is.equal(3, job.merge(1, 2))
+            assert.is.equal(1, job.merge(1, nil))
+            assert.is.equal(2, job.merge(nil, 2))
+            assert.is.equal('a', job.merge('a', 'b'))
+            assert.are.same({x = 3, y = {4, 6}, z = 1},
+                job.merge({x = 1, y = {1, 2}}, {x = 2, y = {3, 4}, z = 1}))
+        end)
+
+        it('should merge tallies', function ()
+            local a, b = pumas.Tally{x = 'energy'}, pumas.Tally{x = 'energy'}
+            local sa, sb = pumas.State{energy = 1}, pumas.State{energy = 2}
+            a:update(sa)
+            b:update(sb)
+            local c = job.merge(a, b)
+            assert.is.equal(a, c)
+            assert.is.equal(2, c.entries)
+        end)
+
+        it('should raise an error for inconsistent values', function ()
+            assert.has_error(function () job.merge(1, 'a') end,
+                'cannot merge a number and a string')
+        end)
+    end)
+end)
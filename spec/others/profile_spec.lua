@@ -0,0 +1,73 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.profile function
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local profile = require('pumas.profile')
+local physics = require('spec.physics')
+
+
+describe('profile', function ()
+    it('should profile a function', function ()
+        local path = 'test.folded'
+        local report, a, b = pumas.profile(function ()
+            local x = 0
+            for i = 1, 30000000 do x = x + math.sqrt(i) end
+            return 1, x
+        end, {output = path})
+        assert.is.equal(1, a)
+        assert.is.equal('number', type(b))
+        assert.is.equal(path, report.output)
+        assert.is.equal('table', type(report.aborts))
+        assert.is_true(report.samples.lua > 0)
+
+        local file = io.open(path)
+        assert.is_not_nil(file)
+        local line = file:read('*l')
+        file:close()
+        os.remove(path)
+        assert.is_not_nil(line:match('^[^ ]+ %d+$'))
+
+        assert.is.equal('string', type(profile.summary(report)))
+        for _, abort in ipairs(report.aborts) do
+            assert.is.equal('boolean', type(abort.pumas))
+        end
+    end)
+
+    it('should count samples in FFI callbacks', function ()
+        local context = physics.muon:Context('forward csda longitudinal')
+        context.geometry = pumas.InfiniteGeometry('StandardRock')
+        context.limit.distance = 10
+        local x = 0
+        context.recorder = pumas.Recorder(function ()
+            for i = 1, 100000 do x = x + math.sqrt(i) end
+        end)
+
+        local report = pumas.profile(function ()
+            for _ = 1, 100 do
+                context:transport(pumas.State{energy = 1})
+            end
+        end, {output = 'test.folded', native = false})
+        os.remove('test.folded')
+        assert.is_true(x > 0)
+        assert.is_true(report.callbacks > 0)
+        assert.is_true(report.callbacks <= report.samples.lua)
+    end)
+
+    it('should forward errors', function ()
+        assert.has_error(function ()
+            pumas.profile(function () error('toto', 0) end,
+                {output = 'test.folded', native = false})
+        end, 'toto')
+    end)
+
+    it('should raise an error for bad arguments', function ()
+        assert.has_error(function () pumas.profile(1) end,
+            "bad argument #1 to 'profile' (expected a function, got a number)")
+
+        assert.has_error(function () pumas.profile(print, 1) end,
+            "bad argument #2 to 'profile' (expected a table or nil, \z
+             got a number)")
+    end)
+end)
@@ -59,6 +59,31 @@ describe('CompositeMaterials', function ()
         assert.is.not_equal(grammage, t.table.csda.grammage[3])
     end)
 
+    it('should update only the modified composite', function ()
+        local t = physics.muon.composites['WetRock']
+        local c = t.materials
+        physics.muon:_update()
+
+        c['StandardRock'] = 0.6
+        c['Water'] = 0.4
+        local modified = rawget(physics.muon, '_update_composites')
+        assert.is_true(modified[t])
+
+        physics.muon:_update()
+        assert.is_nil(next(rawget(physics.muon, '_update_composites')))
+        assert.is_false(rawget(c, '_needs_update'))
+        assert.is_true(rawget(t, '_stale_tables'))
+
+        -- Lua tables are refreshed lazily
+        local grammage = t:grammage(1)
+        assert.is.equal(grammage, t.table.csda.grammage[3])
+        assert.is_false(rawget(t, '_stale_tables'))
+
+        c['StandardRock'] = 0.7
+        c['Water'] = 0.3
+        physics.muon:_update()
+    end)
+
     it('should be iterable with pairs', function ()
         local c = physics.muon.composites['WetRock'].materials
 
@@ -52,4 +52,16 @@ describe('Element', function ()
                 "bad argument 'Z' to 'Element' (expected a number, got nil)")
         end)
     end)
+
+    describe('elements', function ()
+        it('should decode entries on access', function ()
+            local e = pumas.elements.H
+            assert.is.equal('Element', metatype(e))
+            assert.is.equal(e, pumas.elements.H)
+            assert.is.equal(1, e.Z)
+            assert.is.equal(1.0087, e.A)
+            assert.is.equal(1.92E-08, e.I)
+            assert.is_nil(pumas.elements.Xx)
+        end)
+    end)
 end)
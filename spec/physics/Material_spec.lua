@@ -33,7 +33,7 @@ describe('Material', function ()
             assert.is.equal(m.I, 4)
             assert.is.equal('Material', metatype(m))
 
-            local data = require('pumas.data.materials')['Acetone']
+            local data = pumas.materials['Acetone']
             m = pumas.Material(data)
             assert.is.equal('Material', metatype(m))
             for k0, v0 in pairs(data) do
@@ -79,4 +79,23 @@ describe('Material', function ()
                 (expected a number, got nil)")
         end)
     end)
+
+    describe('materials', function ()
+        it('should decode entries on access', function ()
+            local m = pumas.materials.Water
+            assert.is.equal('Material', metatype(m))
+            assert.is.equal(m, pumas.materials.Water)
+            assert.is.equal(1000, m.density)
+            assert.is.equal('liquid', m.state)
+            assert.is.equal(2, util.getn(m.elements))
+            assert.is_nil(pumas.materials.Unobtainium)
+
+            local n = 0
+            for _, v in pairs(pumas.materials) do
+                assert.is.equal('Material', metatype(v))
+                n = n + 1
+            end
+            assert.is_true(n > 300)
+        end)
+    end)
 end)
@@ -3,6 +3,7 @@
 -- Author: Valentin Niess
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
+local ffi = require('ffi')
 local pumas = require('pumas')
 local metatype = require('pumas.metatype')
 local physics = require('spec.physics')
@@ -150,6 +151,59 @@ describe('TabulatedMaterial', function ()
                     m:grammage(1, 'hybrid'))
             end
         end)
+
+        it('should support arrays', function ()
+            for _, m in ipairs(materials) do
+                local energies = {1E-03, 1, 1E+03}
+                local t = m:grammage(energies, 'hybrid')
+                assert.is.equal('table', type(t))
+                assert.is.equal(3, #t)
+                for i, energy in ipairs(energies) do
+                    assert.is.equal(m:grammage(energy, 'hybrid'), t[i])
+                end
+
+                local c = ffi.new('double [3]', energies)
+                local out = ffi.new('double [3]')
+                assert.is.equal(out, m:grammage(c, 'csda', out))
+                for i, energy in ipairs(energies) do
+                    assert.is.equal(m:grammage(energy), out[i - 1])
+                end
+
+                t = m:cross_section(energies)
+                for i, energy in ipairs(energies) do
+                    assert.is.equal(m:cross_section(energy), t[i])
+                end
+            end
+
+            assert.has_error(function () materials[1]:grammage('1') end,
+                "bad argument #2 to 'grammage' \z
+                (expected a number, a table or a double [?] cdata, \z
+                got a string)")
+
+            -- Pointers, e.g. views, and non double arrays are rejected
+            local view = materials[1]:view('kinetic_energy')
+            assert.has_error(function () materials[1]:grammage(view) end,
+                "bad argument #2 to 'grammage' \z
+                (expected a number, a table or a double [?] cdata, \z
+                got a cdata)")
+            local floats = ffi.new('float [3]')
+            assert.has_error(function () materials[1]:grammage(floats) end,
+                "bad argument #2 to 'grammage' \z
+                (expected a number, a table or a double [?] cdata, \z
+                got a cdata)")
+            local out = ffi.new('double [2]')
+            assert.has_error(function ()
+                materials[1]:grammage(ffi.new('double [3]'), 'csda', out)
+            end, "bad argument #4 to 'grammage' \z
+                (expected a table or a double [3] cdata, got a cdata)")
+
+            -- The content of a view can be evaluated from a copy
+            local _, n = materials[1]:view('kinetic_energy')
+            local energies = ffi.new('double [?]', n)
+            ffi.copy(energies, view, n * ffi.sizeof('double'))
+            local t = materials[1]:grammage(energies)
+            assert.is.equal(materials[1].table.csda.grammage[3], t[2])
+        end)
     end)
 
     describe('magnetic rotation', function ()
@@ -171,6 +225,42 @@ describe('TabulatedMaterial', function ()
         end)
     end)
 
+    describe('view', function ()
+        it('should be consistent', function ()
+            for _, m in ipairs(materials) do
+                for _, mode in ipairs{'csda', 'hybrid'} do
+                    local t = m.table[mode]
+                    for _, property in ipairs{'energy_loss', 'grammage',
+                        'kinetic_energy', 'proper_time'} do
+                        local v, n = m:view(property, mode)
+                        assert.is.equal(#t[property], n)
+                        for i = 1, n do
+                            assert.is.equal(t[property][i], v[i - 1])
+                        end
+                    end
+                end
+                local v, n = m:view('cross_section', 'hybrid')
+                assert.is.equal(4, n)
+                assert.is.equal(m.table.hybrid.cross_section[2], v[1])
+            end
+        end)
+
+        it('should be readonly', function ()
+            local v = materials[1]:view('grammage')
+            assert.has_error(function () v[0] = 0 end)
+        end)
+
+        it('should raise an error for bad arguments', function ()
+            local m = materials[1]
+            assert.has_error(function () m:view('scattering_length') end,
+                "bad argument #2 to 'view' \z
+                (expected a tabulated property name, got a string)")
+            assert.has_error(function () m:view('cross_section') end,
+                "bad argument #3 to 'view' \z
+                (no cross_section table for mode 'csda')")
+        end)
+    end)
+
     describe('scattering length', function ()
         it('should return some number', function ()
             for _, m in ipairs(materials) do
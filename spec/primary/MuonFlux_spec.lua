@@ -4,6 +4,7 @@
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
 local pumas = require('pumas')
+local physics = require('spec.physics')
 local util = require('spec.util')
 
 
@@ -116,6 +117,64 @@ describe('MuonFlux', function ()
         end)
     end)
 
+    describe('generator', function ()
+        local context = pumas.Context{physics = physics.muon}
+
+        it('should generate the flux', function ()
+            local flux = pumas.MuonFlux{model = 'gaisser', axis = {0, 0, 1},
+                altitude = 0}
+            local generator = flux:generator{context = context,
+                energy = {1, 1E+03}, cos_theta = {0.5, 1}}
+            assert.is.equal(flux, generator.flux)
+
+            local state = pumas.State()
+            local s1, s2, n = 0, 0, 100000
+            for _ = 1, n do
+                generator:generate(state)
+                assert.is_true((state.energy >= 1) and
+                    (state.energy <= 1E+03))
+                assert.is_true((-state.direction[2] >= 0.5 - 1E-09) and
+                    (-state.direction[2] <= 1 + 1E-09))
+                assert.is.equal(0, state.position[2])
+                s1 = s1 + state.weight
+                s2 = s2 + state.weight * state.weight
+            end
+            s1, s2 = s1 / n, s2 / n
+            local sigma = math.sqrt((s2 - s1 * s1) / n)
+
+            local expected, n_k, n_c = 0, 300, 50
+            local dl, dc = math.log(1E+03) / n_k, 0.5 / n_c
+            for i = 0, n_k - 1 do
+                local k = math.exp((i + 0.5) * dl)
+                for j = 0, n_c - 1 do
+                    local c = 0.5 + (j + 0.5) * dc
+                    expected = expected + flux:spectrum(k, c) * k
+                end
+            end
+            expected = expected * 2 * math.pi * dl * dc
+
+            assert.is_true(math.abs(s1 - expected) < 5 * sigma)
+        end)
+
+        it('should generate a fixed charge', function ()
+            local flux = pumas.MuonFlux{model = 'gaisser'}
+            local generator = flux:generator{context = context,
+                energy = {1, 10}, charge = 1}
+            local state = pumas.State()
+            for _ = 1, 100 do
+                assert.is.equal(1, generator:generate(state).charge)
+            end
+        end)
+
+        it('should catch errors', function ()
+            local flux = pumas.MuonFlux{model = 'gaisser'}
+            assert.has_error(function ()
+                flux:generator{context = context, energy = {1, 10},
+                    cos_theta = {0, 2}}
+            end, "bad argument 'cos_theta' to 'generator' (invalid range)")
+        end)
+    end)
+
     describe('sample', function ()
         it('should update the Monte Carlo weight', function ()
             local flux = pumas.MuonFlux{axis = {0, 0, 1}, altitude = 0}
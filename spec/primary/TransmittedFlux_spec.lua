@@ -0,0 +1,81 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.TransmittedFlux metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local pumas = require('pumas')
+local physics = require('spec.physics')
+
+
+describe('TransmittedFlux', function ()
+    local model = pumas.MuonFlux{model = 'gaisser'}
+    local material = physics.muon.materials.StandardRock
+    local transmitted = pumas.TransmittedFlux{
+        model = model, material = material}
+
+    describe('constructor', function ()
+        it('should set attributes', function ()
+            assert.is.equal(model, transmitted.model)
+            assert.is.equal(material, transmitted.material)
+        end)
+
+        it('should catch errors', function ()
+            assert.has_error(function ()
+                pumas.TransmittedFlux{material = material}
+            end, "bad argument 'model' to 'TransmittedFlux' \z
+                (expected a MuonFlux table, got nil)")
+
+            assert.has_error(function ()
+                pumas.TransmittedFlux{model = model, material = material,
+                    energy = 1}
+            end, "bad argument #1 to 'TransmittedFlux' \z
+                (unknown option 'energy')")
+        end)
+    end)
+
+    describe('energy', function ()
+        it('should invert the CSDA range', function ()
+            for _, grammage in ipairs{1E+03, 1E+05, 1E+07} do
+                local energy = transmitted:energy(grammage)
+                local expected = material:kinetic_energy(grammage)
+                assert.is_true(math.abs(energy / expected - 1) < 1E-02)
+            end
+        end)
+    end)
+
+    describe('flux', function ()
+        it('should integrate the spectrum', function ()
+            local grammage, cos_theta = 1E+05, 0.8
+            local energy = transmitted:energy(grammage)
+
+            local expected, n = 0, 10000
+            local dl = math.log(1E+06 / energy) / n
+            for i = 0, n - 1 do
+                local k = energy * math.exp((i + 0.5) * dl)
+                expected = expected + model:spectrum(k, cos_theta) * k * dl
+            end
+
+            local flux = transmitted:flux(grammage, cos_theta)
+            assert.is_true(math.abs(flux / expected - 1) < 1E-02)
+            assert.is.equal(0, transmitted:flux(grammage, -0.5))
+        end)
+    end)
+
+    describe('map', function ()
+        it('should match the flux', function ()
+            local elevation = {math.rad(30), math.rad(60)}
+            local grammage = ffi.new('double [2][3]',
+                {{1E+03, 1E+04, 1E+05}, {1E+04, 1E+05, 1E+06}})
+            local map = transmitted:map(grammage, elevation)
+            for i = 0, 1 do
+                local cos_theta = math.sin(elevation[i + 1])
+                for j = 0, 2 do
+                    assert.is.equal(
+                        transmitted:flux(grammage[i][j], cos_theta),
+                        map[i][j])
+                end
+            end
+        end)
+    end)
+end)
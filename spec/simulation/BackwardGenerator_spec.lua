@@ -0,0 +1,113 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.BackwardGenerator metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local metatype = require('pumas.metatype')
+local physics = require('spec.physics')
+
+
+describe('BackwardGenerator', function ()
+    local context = physics.muon:Context{mode = 'backward', random_seed = 1}
+    local position = pumas.GeodeticPoint(45, 3, 0)
+    local template = pumas.State{position = position, weight = 1}
+
+    describe('constructor', function ()
+        it('should set attributes', function ()
+            local g = pumas.BackwardGenerator{context = context,
+                state = template, energy = {1E-02, 1E+02}}
+            assert.is.equal('BackwardGenerator', metatype(g))
+            assert.is.equal(context, g.context)
+            assert.is.equal(50, g.bins)
+            assert.is.equal(0, g.events)
+            assert.is.equal(-1, g.exponent)
+        end)
+
+        it('should catch errors', function ()
+            assert.has_error(function ()
+                pumas.BackwardGenerator{context = context, state = template}
+            end, "bad argument 'energy' to 'BackwardGenerator' \z
+                (expected a {number, number} table, got nil)")
+
+            assert.has_error(function ()
+                pumas.BackwardGenerator{context = context, state = template,
+                    energy = {1, 0.1}}
+            end, "bad argument 'energy' to 'BackwardGenerator' \z
+                (invalid range)")
+
+            assert.has_error(function ()
+                pumas.BackwardGenerator{context = context, state = template,
+                    energy = {0.1, 1}, weight = 1}
+            end, "bad argument #1 to 'BackwardGenerator' \z
+                (unknown option 'weight')")
+        end)
+    end)
+
+    describe('generate', function ()
+        it('should copy the template state', function ()
+            local g = pumas.BackwardGenerator{context = context,
+                state = template, energy = {1, 10}, charge = 1}
+            local s = g:generate(pumas.State())
+            assert.is.equal(1, s.charge)
+            assert.is_true((s.energy >= 1) and (s.energy <= 10))
+            for i = 0, 2 do
+                assert.is.equal(template.position[i], s.position[i])
+                assert.is.equal(template.direction[i], s.direction[i])
+            end
+            assert.is.equal(1, g.events)
+        end)
+
+        it('should sample the solid angle', function ()
+            local g = pumas.BackwardGenerator{context = context,
+                state = template, energy = {1, 10},
+                elevation = {math.rad(-90), math.rad(-60)}}
+            local frame = pumas.LocalFrame(position)
+            local direction = pumas.HorizontalVector()
+            for _ = 1, 100 do
+                local s = g:generate(pumas.State())
+                direction:set(s.direction):transform(frame)
+                assert.is_true(direction.elevation <= math.rad(-60) + 1E-09)
+                assert.is.equal(1, math.floor(direction.norm * 1E+09 + 0.5) *
+                    1E-09)
+            end
+        end)
+    end)
+
+    describe('spectrum', function ()
+        it('should be unbiased', function ()
+            for _, options in ipairs{
+                {exponent = -1}, {exponent = -2}, {exponent = 0.5},
+                {elevation = {0, math.rad(30)}, azimuth = {0, math.pi}}} do
+                options.context = context
+                options.state = template
+                options.energy = {1E-01, 1E+03}
+                options.bins = 4
+                options.charge = -1
+
+                local g = pumas.BackwardGenerator(options)
+                local s = pumas.State()
+                for _ = 1, 100000 do
+                    g:generate(s)
+                    g:score(s)
+                end
+
+                local energy, flux, sigma = g:spectrum()
+                assert.is.equal(4, #energy)
+                for i = 1, 4 do
+                    assert.is_true(math.abs(flux[i] - 1) < 5 * sigma[i])
+                end
+
+                g:clear()
+                assert.is.equal(0, g.events)
+            end
+        end)
+
+        it('should catch unpaired scores', function ()
+            local g = pumas.BackwardGenerator{context = context,
+                state = template, energy = {1, 10}}
+            assert.has_error(function () g:score(1) end,
+                "bad argument(s) to 'score' (no pending event)")
+        end)
+    end)
+end)
@@ -83,6 +83,77 @@ describe('context', function ()
                 function () pumas.Context{physics = 1} end,
                 "bad argument 'physics' to 'Context' \z
                 (expected a Physics table, got a number)")
+
+            local c = physics.muon:Context()
+            assert.has_error(
+                function () c.random_seed = 2^32 end,
+                "bad value (expected an integer in [0, 2^32 - 1], \z
+                got 4294967296)")
+
+            assert.has_error(
+                function () c.random_seed = 0.5 end,
+                "bad value (expected an integer in [0, 2^32 - 1], got 0.5)")
+
+            c.random_seed = 2^32 - 1
+            assert.is.equal(2^32 - 1, c.random_seed)
+        end)
+    end)
+
+    describe('grammage', function ()
+        local geometry = pumas.EarthGeometry(
+            {'Water', 100}, {'StandardRock', 0})
+        local position = pumas.GeodeticPoint(45, 3, -10)
+        local frame = pumas.LocalFrame(position)
+        local up = pumas.HorizontalVector{
+            norm = 1, elevation = math.rad(90), azimuth = 0, frame = frame}
+        local rho_water = geometry.layers[1].medium.density
+        local rho_rock = geometry.layers[2].medium.density
+
+        it('should integrate the density', function ()
+            local context = physics.muon:Context{geometry = geometry}
+            local grammage, distance = context:grammage(position, up)
+            assert.is.equal(110, util.round(distance, 3))
+            assert.is_true(math.abs(
+                grammage - 10 * rho_rock - 100 * rho_water) < 1)
+
+            context.limit = {distance = 5}
+            grammage, distance = context:grammage(position, up)
+            assert.is.equal(5, util.round(distance, 6))
+            assert.is.equal(5 * rho_rock, util.round(grammage, 3))
+
+            context.geometry = nil
+            assert.is.equal(0, context:grammage(position, up))
+        end)
+
+        it('should stop in unbounded non uniform media', function ()
+            local medium = pumas.GradientMedium('StandardRock',
+                {lambda = -1000})
+            local context = physics.muon:Context{
+                geometry = pumas.InfiniteGeometry(medium)}
+            assert.is.equal(math.huge, context:grammage(position, up))
+
+            context.limit = {distance = 5}
+            local grammage, distance = context:grammage(position, up)
+            assert.is.equal(5, util.round(distance, 6))
+            assert.is_true(grammage > 0)
+            assert.is_true(grammage < math.huge)
+        end)
+
+        it('should catch errors', function ()
+            local context = physics.muon:Context{geometry = geometry}
+
+            assert.has_error(
+                function () context.grammage() end,
+                "bad number of argument(s) to 'grammage' (expected 3, got 0)")
+
+            assert.has_error(
+                function () context:grammage(position) end,
+                "bad number of argument(s) to 'grammage' (expected 3, got 2)")
+
+            assert.has_error(
+                function () context:grammage(1, up) end,
+                "bad argument #2 to 'grammage' \z
+                (expected a Coordinates cdata, got a number)")
         end)
     end)
 
@@ -123,6 +194,45 @@ describe('context', function ()
         end)
     end)
 
+    describe('opacity_map', function ()
+        local geometry = pumas.EarthGeometry(
+            {'Water', 100}, {'StandardRock', 0})
+        local position = pumas.GeodeticPoint(45, 3, -10)
+
+        it('should match the grammage', function ()
+            local context = physics.muon:Context{geometry = geometry}
+            local map = context:opacity_map{
+                origin = position, azimuth = {0, 1},
+                elevation = {math.rad(30), math.rad(90)}}
+
+            local frame = pumas.LocalFrame(position)
+            for i, elevation in ipairs{math.rad(30), math.rad(90)} do
+                for j, azimuth in ipairs{0, 1} do
+                    local direction = pumas.HorizontalVector(
+                        1, elevation, azimuth, frame)
+                    local grammage = context:grammage(position, direction)
+                    assert.is.equal(util.round(grammage, 3),
+                        util.round(map[i - 1][j - 1], 3))
+                end
+            end
+        end)
+
+        it('should catch errors', function ()
+            local context = physics.muon:Context{geometry = geometry}
+
+            assert.has_error(
+                function () context:opacity_map() end,
+                "bad number of argument(s) to 'opacity_map' \z
+                (expected 2, got 1)")
+
+            assert.has_error(
+                function () context:opacity_map{origin = position,
+                    azimuth = 0} end,
+                "bad argument 'elevation' to 'opacity_map' \z
+                (expected a number or a table, got nil)")
+        end)
+    end)
+
     describe('random', function ()
         it('should return random number(s)', function ()
             local context = physics.tau:Context()
@@ -169,6 +279,109 @@ describe('context', function ()
         end)
     end)
 
+    describe('weight_window', function ()
+        it('should set and get the window', function ()
+            local context = physics.muon:Context()
+            assert.is_nil(context.weight_window)
+
+            context.weight_window = {lower = 1}
+            local window = context.weight_window
+            assert.is.equal(1, window.lower)
+            assert.is.equal(2, window.survival)
+            assert.are.same({}, window.energies)
+
+            context.weight_window = {lower = 1, energies = {10, 1}}
+            assert.are.same({1, 10}, context.weight_window.energies)
+
+            context.weight_window = nil
+            assert.is_nil(context.weight_window)
+        end)
+
+        it('should play the roulette at boundaries', function ()
+            local geometry = pumas.EarthGeometry(
+                {'Water', 100}, {'StandardRock', 0})
+            local context = physics.muon:Context{
+                geometry = geometry, mode = 'backward csda',
+                weight_window = {lower = 1, survival = 10}}
+            context.limit = {energy = 1E+03}
+
+            local position = pumas.GeodeticPoint(45, 3, -10)
+            local frame = pumas.LocalFrame(position)
+            local direction = pumas.HorizontalVector{
+                norm = 1, elevation = math.rad(-90), azimuth = 0,
+                frame = frame}
+
+            local n_killed, n = 0, 100
+            for _ = 1, n do
+                local state = pumas.State{position = position,
+                    direction = direction, energy = 1, weight = 1E-03}
+                local event = context:transport(state)
+                if event.weight then
+                    assert.is.equal(0, state.weight)
+                    n_killed = n_killed + 1
+                else
+                    assert.is_true(event.limit or (state.weight >= 1))
+                end
+            end
+            assert.is_true(n_killed > 0)
+        end)
+
+        it('should play the roulette at energy thresholds', function ()
+            local context = physics.muon:Context{geometry = 'StandardRock',
+                mode = 'backward csda',
+                weight_window = {lower = 1, survival = 2,
+                    energies = {2, 4, 8, 16}}}
+            context.limit = {energy = 1E+02}
+
+            local n_killed, n = 0, 100
+            for _ = 1, n do
+                local state = pumas.State{energy = 1, weight = 0.5}
+                local event = context:transport(state)
+                if event.weight then
+                    assert.is.equal(0, state.weight)
+                    assert.is_true(state.energy < 1E+02)
+                    n_killed = n_killed + 1
+                else
+                    assert.is_true(event.limit)
+                end
+            end
+            assert.is_true(n_killed > 0)
+            assert.is_true(n_killed < n)
+        end)
+
+        it('should play the roulette with medium events', function ()
+            local geometry = pumas.EarthGeometry(
+                {'Water', 100}, {'StandardRock', 0})
+            local context = physics.muon:Context{
+                geometry = geometry, mode = 'backward csda',
+                weight_window = {lower = 1, survival = 1E+06}}
+            context.event = pumas.Event('medium')
+            context.limit = {energy = 1E+03}
+
+            local position = pumas.GeodeticPoint(45, 3, -10)
+            local frame = pumas.LocalFrame(position)
+            local direction = pumas.HorizontalVector{
+                norm = 1, elevation = math.rad(-90), azimuth = 0,
+                frame = frame}
+
+            local state = pumas.State{position = position,
+                direction = direction, energy = 1, weight = 1E-03}
+            local event = context:transport(state)
+            assert.is_true(event.weight)
+            assert.is.equal(0, state.weight)
+        end)
+
+        it('should catch errors', function ()
+            local context = physics.muon:Context()
+
+            assert.has_error(
+                function () context.weight_window = {lower = 1,
+                    survival = 0.5} end,
+                "bad attribute 'weight_window' for 'Context' ('survival' \z
+                must be a number not smaller than 'lower')")
+        end)
+    end)
+
     describe('transport', function ()
         it('should work with user limits', function ()
             local c = physics.muon:Context('backward csda longitudinal')
@@ -243,4 +456,121 @@ describe('context', function ()
                 (expected a Context table, got a number)")
         end)
     end)
+
+    describe('transport_into', function ()
+        it('should recycle the result', function ()
+            local c = physics.muon:Context('backward csda longitudinal')
+            local m = pumas.UniformMedium('StandardRock')
+            c.geometry = pumas.InfiniteGeometry(m)
+            c.limit.energy = 2
+            assert.is_false(c.frozen)
+            c.frozen = true
+            assert.is_true(c.frozen)
+
+            local result = {}
+            local s = pumas.State{energy = 1}
+            assert.is.equal(result, c:transport_into(s, result))
+            local event, media = result.event, result.media
+            assert.is.equal(2, util.round(s.energy))
+            assert.is_true(event.limit_energy)
+            assert.is.equal(m, media[1])
+            assert.is.equal(m, media[2])
+
+            c.limit.energy = nil
+            c.limit.distance = 1
+            s:set(pumas.State{energy = 1})
+            c:transport_into(s, result)
+            assert.is.equal(event, result.event)
+            assert.is.equal(media, result.media)
+            assert.is_true(event.limit_distance)
+            assert.is_false(event.limit_energy)
+
+            assert.has_error(function ()
+                c.geometry = 'StandardRock'
+            end, "bad attribute 'geometry' for 'Context' \z
+                (the context is frozen)")
+
+            c.frozen = false
+            c.geometry = 'StandardRock'
+        end)
+
+        it('should catch errors', function ()
+            local c = physics.muon:Context('backward csda longitudinal')
+            local s = pumas.State()
+
+            assert.has_error(
+                function () c:transport_into(s, 1) end,
+                "bad argument #3 to 'transport_into' \z
+                (expected a table, got a number)")
+        end)
+    end)
+
+    describe('checkpoint', function ()
+        local path = 'test.checkpoint'
+
+        after_each(function ()
+            os.remove(path)
+        end)
+
+        local function run (c, s, n)
+            local energies = {}
+            for i = 1, n do
+                s:set(pumas.State{energy = 1})
+                c:transport(s)
+                energies[i] = s.energy
+            end
+            return energies
+        end
+
+        it('should resume a run bit-identically', function ()
+            -- A stochastic mode is used, such that the run depends on the
+            -- restored PRNG state
+            local c = physics.muon:Context('forward hybrid')
+            c.geometry = 'StandardRock'
+            c.limit.distance = 1E+03
+            c.random_seed = 1
+            local t = pumas.Tally{x = {field = 'energy', bins = 10,
+                range = {0, 1}}}
+            c.tallies = {t}
+
+            local s = pumas.State()
+            run(c, s, 5)
+            c:checkpoint(path)
+            assert.is.equal(5, c.events)
+            local expected = run(c, s, 5)
+            local mean = t.mean
+            local draws = {c:random(3)}
+
+            t:clear()
+            c.random_seed = 2
+            c:restore(path)
+            assert.is.equal(5, c.events)
+            assert.is.equal(5, t.entries)
+            assert.are.same(expected, run(c, s, 5))
+            assert.is.equal(10, c.events)
+            assert.is.equal(mean, t.mean)
+            assert.are.same(draws, {c:random(3)})
+        end)
+
+        it('should catch errors', function ()
+            local c = physics.muon:Context('forward csda longitudinal')
+            c.tallies = {pumas.Tally{x = 'energy'}}
+            c:checkpoint(path)
+
+            c.tallies = {pumas.Tally{x = 'distance'}}
+            assert.has_error(function ()
+                c:restore(path)
+            end, "bad argument #2 to 'restore' \z
+                (inconsistent tallies in 'test.checkpoint')")
+
+            assert.has_error(function ()
+                c:restore('missing.checkpoint')
+            end, "bad argument #2 to 'restore' \z
+                (could not open 'missing.checkpoint')")
+
+            assert.has_error(function ()
+                c.events = 0
+            end, "cannot modify 'events' for 'Context'")
+        end)
+    end)
 end)
@@ -0,0 +1,119 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.EventWriter and pumas.EventReader metatypes
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local metatype = require('pumas.metatype')
+local physics = require('spec.physics')
+local util = require('spec.util')
+
+
+describe('EventWriter', function ()
+    local path = 'test.events'
+
+    after_each(function ()
+        os.remove(path)
+    end)
+
+    describe('constructor', function ()
+        it('should set attributes', function ()
+            local w = pumas.EventWriter{path = path,
+                fields = {'energy', 'event'}, chunk = 8}
+            assert.is.equal('EventWriter', metatype(w))
+            assert.is.equal(8, w.chunk)
+            assert.is_false(w.closed)
+            assert.is.equal(0, w.entries)
+            assert.are.same({'energy', 'event'}, w.fields)
+            assert.are.same({}, w.media)
+            assert.is.equal(path, w.path)
+            w:close()
+            assert.is_true(w.closed)
+
+            w = pumas.EventWriter{path = path}
+            assert.is.equal(15, #w.fields)
+            w:close()
+        end)
+
+        it('should catch errors', function ()
+            assert.has_error(function ()
+                pumas.EventWriter{path = path, fields = {'momentum'}}
+            end, "bad argument 'fields' to 'EventWriter' \z
+                (unknown field 'momentum')")
+
+            assert.has_error(function ()
+                pumas.EventWriter{path = path, chunk = 0}
+            end, "bad argument 'chunk' to 'EventWriter' \z
+                (must be a strictly positive integer)")
+        end)
+    end)
+
+    describe('write', function ()
+        it('should be read back', function ()
+            local w = pumas.EventWriter{path = path,
+                fields = {'energy', 'weight', 'event', 'medium_end'},
+                chunk = 4}
+            local s = pumas.State()
+            local event = pumas.Event('limit')
+            local rock = pumas.UniformMedium('StandardRock')
+            for i = 1, 10 do
+                s.energy, s.weight = i, 2 * i
+                w:write(s, event, {nil, rock})
+            end
+            assert.is.equal(10, w.entries)
+            w:flush()
+            w:write(s)
+            w:close()
+
+            assert.has_error(function ()
+                w:write(s)
+            end, "bad argument #1 to 'write' (the writer is closed)")
+
+            local r = pumas.EventReader(path)
+            assert.is.equal('EventReader', metatype(r))
+            assert.is.equal(4, r.chunks)
+            assert.is.equal(11, r.entries)
+            assert.are.same({'energy', 'weight', 'event', 'medium_end'},
+                r.fields)
+            assert.are.same({'StandardRock'}, r.media)
+
+            local events, n = r:read()
+            assert.is.equal(11, n)
+            for i = 1, 10 do
+                assert.is.equal(i, events.energy[i - 1])
+                assert.is.equal(2 * i, events.weight[i - 1])
+                assert.is.equal(tonumber(event._value), events.event[i - 1])
+                assert.is.equal(1, events.medium_end[i - 1])
+            end
+            assert.is.equal(0, events.event[10])
+            assert.is.equal(0, events.medium_end[10])
+
+            local chunk, m = r:chunk(3)
+            assert.is.equal(2, m)
+            assert.is.equal(9, chunk.energy[0])
+            assert.is.equal(10, chunk.energy[1])
+        end)
+
+        it('should store transported events', function ()
+            local c = physics.muon:Context('backward csda longitudinal')
+            c.geometry = 'StandardRock'
+            c.limit.energy = 2
+
+            local w = pumas.EventWriter{path = path}
+            local s, result = pumas.State(), {}
+            for _ = 1, 10 do
+                s:set(pumas.State{energy = 1})
+                c:transport_into(s, result)
+                w:write(s, result.event, result.media)
+            end
+            w:close()
+
+            local events, n = pumas.EventReader(path):read()
+            assert.is.equal(10, n)
+            for i = 0, n - 1 do
+                assert.is.equal(2, util.round(events.energy[i]))
+                assert.is.equal(1, events.medium_start[i])
+            end
+        end)
+    end)
+end)
@@ -0,0 +1,169 @@
+-------------------------------------------------------------------------------
+-- Spec of the pumas.Tally metatype
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local pumas = require('pumas')
+local metatype = require('pumas.metatype')
+local physics = require('spec.physics')
+local util = require('spec.util')
+
+
+describe('Tally', function ()
+    describe('constructor', function ()
+        it('should set attributes', function ()
+            local t = pumas.Tally{x = 'energy'}
+            assert.is.equal('Tally', metatype(t))
+            assert.is.equal(0, t.entries)
+            assert.is.equal(0, t.sum)
+            assert.is_nil(t.mean)
+            assert.is_false(t.step)
+            assert.is_true(t.weighted)
+            assert.are.same({field = 'energy'}, t.x)
+            assert.is_nil(t.y)
+
+            t = pumas.Tally{
+                x = {field = 'energy', bins = 10, range = {1, 1E+03},
+                    log = true},
+                y = {field = 'position_z', bins = 5, range = {-1, 1}},
+                step = true, weighted = false}
+            assert.is_true(t.step)
+            assert.is_false(t.weighted)
+            assert.are.same({field = 'energy', bins = 10, range = {1, 1E+03},
+                log = true}, t.x)
+            assert.are.same({field = 'position_z', bins = 5, range = {-1, 1},
+                log = false}, t.y)
+        end)
+
+        it('should catch errors', function ()
+            assert.has_error(function ()
+                pumas.Tally{x = 'momentum'}
+            end, "bad argument 'x' to 'Tally' (unknown field 'momentum')")
+
+            assert.has_error(function ()
+                pumas.Tally{x = 'energy', y = 'distance'}
+            end, "bad argument 'y' to 'Tally' (requires a binning of 'x')")
+
+            assert.has_error(function ()
+                pumas.Tally{x = {field = 'energy', bins = 10,
+                    range = {0, 1}, log = true}}
+            end, "bad argument 'x' to 'Tally' (invalid 'range')")
+        end)
+    end)
+
+    describe('update', function ()
+        it('should compute weighted statistics', function ()
+            local t = pumas.Tally{x = {field = 'distance', bins = 4,
+                range = {0, 4}}}
+            local s = pumas.State()
+            local values = {{0.5, 1}, {1.5, 2}, {1.5, 1}, {3.5, 4}, {5, 2}}
+            local sw, swx, swx2 = 0, 0, 0
+            for _, v in ipairs(values) do
+                s.distance, s.weight = v[1], v[2]
+                t:update(s)
+                sw = sw + v[2]
+                swx = swx + v[2] * v[1]
+                swx2 = swx2 + v[2] * v[1] * v[1]
+            end
+
+            local mean = swx / sw
+            assert.is.equal(5, t.entries)
+            assert.is.equal(sw, t.sum)
+            assert.is.equal(util.round(mean, 12), util.round(t.mean, 12))
+            assert.is.equal(util.round(math.sqrt(swx2 / sw - mean * mean), 12),
+                util.round(t.std, 12))
+
+            local values_, sigmas, edges = t:histogram()
+            assert.are.same({0, 1, 2, 3, 4}, edges)
+            for i, v in ipairs{1, 3, 0, 4} do
+                assert.is.equal(v, values_[i - 1])
+            end
+            assert.is.equal(math.sqrt(5), sigmas[1])
+
+            t:clear()
+            assert.is.equal(0, t.entries)
+            assert.is.equal(0, t:histogram()[1])
+        end)
+    end)
+
+    describe('merge', function ()
+        it('should match a single tally', function ()
+            local t, t0, t1 = pumas.Tally{x = 'energy'},
+                pumas.Tally{x = 'energy'}, pumas.Tally{x = 'energy'}
+            local s = pumas.State{weight = 1}
+            for i = 1, 10 do
+                s.energy = i * i
+                t:update(s)
+                if i % 3 == 0 then t0:update(s) else t1:update(s) end
+            end
+
+            t0:merge(t1)
+            assert.is.equal(t.entries, t0.entries)
+            assert.is.equal(util.round(t.mean, 12), util.round(t0.mean, 12))
+            assert.is.equal(util.round(t.std, 12), util.round(t0.std, 12))
+
+            local restored = pumas.Tally(t:dump())
+            assert.is.equal(t.mean, restored.mean)
+            assert.is.equal(t.entries, restored.entries)
+        end)
+
+        it('should catch inconsistent tallies', function ()
+            assert.has_error(function ()
+                pumas.Tally{x = 'energy'}:merge(pumas.Tally{x = 'distance'})
+            end, "bad argument(s) to 'merge' (inconsistent tallies)")
+        end)
+    end)
+
+    describe('context', function ()
+        it('should update event and step tallies', function ()
+            local c = physics.muon:Context('backward csda longitudinal')
+            c.geometry = 'StandardRock'
+            c.limit.energy = 2
+
+            local event_tally = pumas.Tally{x = 'energy'}
+            local step_tally = pumas.Tally{x = 'energy', step = true}
+            c.tallies = {event_tally, step_tally}
+            assert.is.equal(2, #c.tallies)
+
+            local s = pumas.State()
+            for _ = 1, 10 do
+                s:set(pumas.State{energy = 1})
+                c:transport(s)
+            end
+            assert.is.equal(10, event_tally.entries)
+            assert.is.equal(2, util.round(event_tally.mean))
+            assert.is_true(step_tally.entries > 10)
+
+            assert.has_error(function ()
+                c.recorder = function () end
+            end, "bad attribute 'recorder' for 'Context' \z
+                (step tallies are attached)")
+
+            c.tallies = nil
+            assert.is.equal(0, #c.tallies)
+            c:transport(pumas.State{energy = 1})
+            assert.is.equal(10, event_tally.entries)
+        end)
+
+        it('should record states once when the transport restarts', function ()
+            local c = physics.muon:Context('backward csda longitudinal')
+            c.geometry = 'StandardRock'
+            c.limit.energy = 2
+
+            -- The weight window stops and restarts the transport at 1.5 GeV
+            c.weight_window = {lower = 1E-03, energies = {1.5}}
+            local step_tally = pumas.Tally{x = {field = 'energy', bins = 1,
+                range = {1.5 - 1E-06, 1.5 + 1E-06}}, step = true,
+                weighted = false}
+            c.tallies = {step_tally}
+
+            local s = pumas.State()
+            for _ = 1, 10 do
+                s:set(pumas.State{energy = 1})
+                c:transport(s)
+            end
+            local counts = step_tally:histogram()
+            assert.is.equal(10, counts[0])
+        end)
+    end)
+end)
@@ -35,15 +35,21 @@ register('pumas.context')
 register('pumas.coordinates')
 register('pumas.element')
 register('pumas.flux')
+register('pumas.generator')
 register('pumas.geometry')
 register('pumas.enum')
+register('pumas.job')
 register('pumas.material')
 register('pumas.medium')
 register('pumas.metatype')
 register('pumas.pdg')
 register('pumas.physics')
+register('pumas.plugin')
+register('pumas.profile')
 register('pumas.recorder')
 register('pumas.state')
+register('pumas.tally')
+register('pumas.writer')
 
 pumas.constants = require('pumas.constants')
 
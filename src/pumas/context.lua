@@ -4,14 +4,18 @@
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
 local ffi = require('ffi')
+local base = require('pumas.geometry.base')
 local call = require('pumas.call')
 local clib = require('pumas.clib')
 local compat = require('pumas.compat')
+local coordinates = require('pumas.coordinates')
 local enum = require('pumas.enum')
 local error = require('pumas.error')
 local infinite = require('pumas.geometry.infinite')
+local job = require('pumas.job')
 local medium = require('pumas.medium')
 local metatype = require('pumas.metatype')
+local profile = require('pumas.profile')
 local recorder = require('pumas.recorder')
 local state = require('pumas.state')
 
@@ -99,6 +103,8 @@ end
 -- XXX  support multi threading?
 local Context = {}
 
+local update_geometry
+
 function Context:__newindex (k, v)
     if k == 'limit' then
         self._limit:set(v)
@@ -108,6 +114,11 @@ function Context:__newindex (k, v)
         local current_geometry = rawget(self, '_geometry')
         if current_geometry == v then return end
 
+        if rawget(self, '_frozen') then
+            error.raise{['type'] = 'Context', argname = 'geometry',
+                description = 'the context is frozen'}
+        end
+
         if type(v) == 'string' then
             local m = self._physics.materials[v] or self._physics.composites[v]
             if m then
@@ -119,7 +130,7 @@ function Context:__newindex (k, v)
         end
 
         if current_geometry ~= nil then
-            clib.pumas_geometry_destroy(self._c)
+            base.release(self._c, self._nodes)
         end
 
         if (v ~= nil) and (metatype(v) ~= 'Geometry') then
@@ -131,6 +142,10 @@ function Context:__newindex (k, v)
     elseif k == 'random_seed' then
         if v then
             if type(v) == 'number' then
+                if (v < 0) or (v > 0xffffffff) or (v ~= math.floor(v)) then
+                    error.raise{header = 'bad value',
+                        expected = 'an integer in [0, 2^32 - 1]', got = v}
+                end
                 v = ffi.new('unsigned long [1]', v)
             else
                 error.raise{header = 'bad type', expected = 'a number',
@@ -138,11 +153,12 @@ function Context:__newindex (k, v)
             end
         end
         local c = rawget(self, '_c')
-        clib.pumas_context_random_seed_set(c, v)
+        clib.pumas_random_seed_set(c, v)
     elseif k == 'recorder' then
         if v == nil then
             rawset(self, '_recorder', nil)
-            self._c.recorder = nil
+            self._c.recorder = (rawget(self, '_tally_recorder') ~= nil) and
+                self._tally_recorder or nil
         else
             if type(v) == 'function' then
                 v = recorder.Recorder(v)
@@ -150,23 +166,139 @@ function Context:__newindex (k, v)
                 error.raise{header = 'bad type', expected = 'a Recorder table',
                     got = metatype.a(v)}
             end
+            if rawget(self, '_tally_recorder') ~= nil then
+                error.raise{['type'] = 'Context', argname = 'recorder',
+                    description = 'step tallies are attached'}
+            end
             rawset(self, '_recorder', v)
             self._c.recorder = v._c
         end
+    elseif k == 'tallies' then
+        if metatype(v) == 'Tally' then v = {v} end
+        if (v ~= nil) and (type(v) ~= 'table') then
+            error.raise{header = 'bad type', expected = 'a Tally table',
+                got = metatype.a(v)}
+        end
+
+        local tallies, step = {}, false
+        if v ~= nil then
+            for i, t in ipairs(v) do
+                if metatype(t) ~= 'Tally' then
+                    error.raise{['type'] = 'Context', argname = 'tallies',
+                        expected = 'a Tally table for entry #'..i,
+                        got = metatype.a(t)}
+                end
+                tallies[i] = t
+                if t.step then step = true end
+            end
+        end
+
+        -- Step tallies are updated by a native recorder
+        if step then
+            if rawget(self, '_recorder') ~= nil then
+                error.raise{['type'] = 'Context', argname = 'tallies',
+                    description = 'a recorder is attached'}
+            end
+            if rawget(self, '_tally_recorder') == nil then
+                local ptr = ffi.new('struct pumas_recorder *[1]')
+                call(clib.pumas_recorder_create, ptr, 0)
+                local c = ptr[0]
+                ffi.gc(c, function () clib.pumas_recorder_destroy(ptr) end)
+                c.record = clib.pumas_tally_record
+                c.period = 1
+                rawset(self, '_tally_recorder', c)
+            end
+            self._c.recorder = self._tally_recorder
+        elseif rawget(self, '_tally_recorder') ~= nil then
+            self._c.recorder = nil
+            rawset(self, '_tally_recorder', nil)
+        end
+
+        local n = #tallies
+        local c_tallies = (n > 0) and
+            ffi.new('struct pumas_tally *[?]', n) or nil
+        for i, t in ipairs(tallies) do
+            c_tallies[i - 1] = t._c
+        end
+
+        local user_data = ffi.cast('struct pumas_user_data *',
+                                   self._c.user_data)
+        user_data.tallies = c_tallies
+        user_data.n_tallies = n
+        rawset(self, '_tallies', tallies)
+        rawset(self, '_tallies_c', c_tallies)
+    elseif k == 'frozen' then
+        if v then
+            if rawget(self, '_geometry') ~= nil then
+                update_geometry(self, error.ErrorFunction{
+                    ['type'] = 'Context', argname = 'frozen'})
+            end
+            rawset(self, '_frozen', true)
+        else
+            rawset(self, '_frozen', nil)
+        end
     elseif k == 'geometry_callback' then
         -- Set a geometry callback for checking / debugging the geometry
         -- navigation
         local user_data = ffi.cast('struct pumas_user_data *',
                                    self._c.user_data)
         local wrapped_state = state.State()
-        user_data.callback =
+        user_data.callback = profile.callback(
             function (geometry, c_state, c_medium, step)
                 local wrapped_medium = medium.get(c_medium)
                 ffi.copy(wrapped_state._c, c_state,
                     ffi.sizeof('struct pumas_state_extended'))
                 v(geometry, wrapped_state, wrapped_medium, step)
+            end)
+    elseif k == 'weight_window' then
+        local user_data = ffi.cast('struct pumas_user_data *',
+                                   self._c.user_data)
+        if v == nil then
+            user_data.window.enabled = 0
+            rawset(self, '_weight_window', nil)
+            return
+        elseif type(v) ~= 'table' then
+            error.raise{header = 'bad type', expected = 'a table',
+                got = metatype.a(v)}
+        end
+
+        local lower, survival = v.lower, v.survival
+        if type(lower) ~= 'number' then
+            error.raise{['type'] = 'Context', argname = 'weight_window',
+                expected = "a number for 'lower'", got = metatype.a(lower)}
+        end
+        survival = survival or 2 * lower
+        if (type(survival) ~= 'number') or (survival < lower) then
+            error.raise{['type'] = 'Context', argname = 'weight_window',
+                description = "'survival' must be a number not smaller \z
+                than 'lower'"}
+        end
+
+        local energies = v.energies or {}
+        if (type(energies) ~= 'table') or (#energies > 16) then
+            error.raise{['type'] = 'Context', argname = 'weight_window',
+                expected = "a table of at most 16 numbers for 'energies'",
+                got = metatype.a(energies)}
+        end
+        energies = {unpack(energies)}
+        for _, energy in ipairs(energies) do
+            if (type(energy) ~= 'number') or (energy <= 0) then
+                error.raise{['type'] = 'Context', argname = 'weight_window',
+                    description = "'energies' must be positive numbers"}
             end
-    elseif k == 'physics' then
+        end
+        table.sort(energies)
+
+        user_data.window.enabled = 1
+        user_data.window.lower = lower
+        user_data.window.survival = survival
+        user_data.window.n_energies = #energies
+        for i, energy in ipairs(energies) do
+            user_data.window.energies[i - 1] = energy
+        end
+        rawset(self, '_weight_window', {lower = lower, survival = survival,
+            energies = energies})
+    elseif (k == 'physics') or (k == 'events') then
         error.raise{['type'] = 'Context', not_mutable = k}
     else
         error.raise{['type'] = 'Context', bad_member = k}
@@ -176,11 +308,21 @@ end
 
 local pumas_state_extended_ptr = ffi.typeof('struct pumas_state_extended *')
 
-local transport
-do
-    local raise_error = error.ErrorFunction{fname = 'transport'}
+function update_geometry (self, raise_error)
+    self._physics:_update()
+    local ok, m = medium.update(self._physics)
+    if not ok then
+        raise_error{
+            description = "unknown material '"..m.material.."'"
+        }
+    end
+    self._geometry:_update(self)
+end
+
 
-    function transport (self, state_)
+local transport, transport_into
+do
+    local function check_args (self, state_, raise_error)
         if state_ == nil then
             local nargs = (self ~= nil) and 1 or 0
             raise_error{argnum = 'bad', expected = 2, got = nargs}
@@ -193,32 +335,76 @@ do
             raise_error{argnum = 2, expected = 'a State table',
                 got = metatype.a(state_)}
         end
+    end
 
+    local function transport_state (self, state_, raise_error)
         local extended_state = ffi.cast(pumas_state_extended_ptr, state_._c)
         clib.pumas_state_extended_reset(extended_state, self._c)
 
-        self._physics:_update()
-        local ok, m = medium.update(self._physics)
-        if not ok then
-            raise_error{
-                description = "unknown material '"..m.material.."'"
-            }
+        -- The physics and the geometry are not checked for updates once the
+        -- context is frozen
+        if rawget(self, '_frozen') then
+            clib.pumas_geometry_reset(self._c)
+        else
+            update_geometry(self, raise_error)
         end
-        self._geometry:_update(self)
+
         self._c.event = self.event._value
-        call(clib.pumas_context_transport, self._c, state_._c,
+        call(clib.pumas_extended_transport, self._c, state_._c,
             self._cache.event, self._cache.media)
-        local media = compat.table_new(2, 0)
+    end
+
+    do
+        local raise_error = error.ErrorFunction{fname = 'transport'}
 
-        for i = 1, 2 do
-            if self._cache.media[i - 1] ~= nil then
-                media[i] = medium.get(self._cache.media[i - 1])
+        function transport (self, state_)
+            check_args(self, state_, raise_error)
+            transport_state(self, state_, raise_error)
+
+            local media = compat.table_new(2, 0)
+            for i = 1, 2 do
+                if self._cache.media[i - 1] ~= nil then
+                    media[i] = medium.get(self._cache.media[i - 1])
+                end
             end
+            local event = enum.Event()
+            event._value = self._cache.event[0]
+
+            return event, media
         end
-        local event = enum.Event()
-        event._value = self._cache.event[0]
+    end
 
-        return event, media
+    do
+        local raise_error = error.ErrorFunction{fname = 'transport_into'}
+
+        function transport_into (self, state_, result)
+            check_args(self, state_, raise_error)
+            if type(result) ~= 'table' then
+                raise_error{argnum = 3, expected = 'a table',
+                    got = metatype.a(result)}
+            end
+
+            transport_state(self, state_, raise_error)
+
+            -- Recycle the result fields, if already allocated
+            local event, media = result.event, result.media
+            if event == nil then
+                event = enum.Event()
+                result.event = event
+            end
+            if media == nil then
+                media = compat.table_new(2, 0)
+                result.media = media
+            end
+
+            event._value = self._cache.event[0]
+            for i = 1, 2 do
+                local m = self._cache.media[i - 1]
+                media[i] = (m ~= nil) and medium.get(m) or nil
+            end
+
+            return result
+        end
     end
 end
 
@@ -266,6 +452,183 @@ do
 end
 
 
+local function distance_max (self)
+    return self._limit.distance or 0
+end
+
+
+local grammage
+do
+    local raise_error = error.ErrorFunction{fname = 'grammage'}
+    local tmp_state = state.State()
+
+    function grammage (self, position, direction)
+        if direction == nil then
+            local nargs = (position ~= nil) and 2 or ((self ~= nil) and 1 or 0)
+            raise_error{argnum = 'bad', expected = 3, got = nargs}
+        elseif metatype(self) ~= 'Context' then
+            raise_error{argnum = 1, expected = 'a Context table',
+                got = metatype.a(self)}
+        end
+
+        tmp_state:clear()
+        for i, pair in ipairs{{'position', position},
+                              {'direction', direction}} do
+            local ok, msg = pcall(function ()
+                tmp_state[pair[1]] = pair[2]
+            end)
+            if not ok then
+                raise_error{argnum = i + 1, expected = 'a Coordinates cdata',
+                    got = metatype.a(pair[2])}
+            end
+        end
+
+        if rawget(self, '_geometry') == nil then
+            return 0, 0
+        end
+
+        local extended_state = ffi.cast(pumas_state_extended_ptr,
+                                        tmp_state._c)
+        clib.pumas_state_extended_reset(extended_state, self._c)
+        update_geometry(self, raise_error)
+
+        local x = clib.pumas_geometry_grammage(self._c, tmp_state._c,
+                                               distance_max(self))
+        return x, tmp_state.distance
+    end
+end
+
+
+local opacity_map
+do
+    local raise_error = error.ErrorFunction{fname = 'opacity_map'}
+    local tmp_state = state.State()
+
+    local function get_angles (args, k)
+        local v = args[k]
+        if type(v) == 'number' then
+            return {v}
+        elseif type(v) ~= 'table' or #v == 0 then
+            raise_error{argname = k, expected = 'a number or a table',
+                got = metatype.a(v)}
+        end
+        for _, vi in ipairs(v) do
+            if type(vi) ~= 'number' then
+                raise_error{argname = k, expected = 'a table of numbers',
+                    got = 'a table of '..metatype(vi)..'s'}
+            end
+        end
+        return v
+    end
+
+    function opacity_map (self, args)
+        if args == nil then
+            local nargs = (self ~= nil) and 1 or 0
+            raise_error{argnum = 'bad', expected = 2, got = nargs}
+        elseif metatype(self) ~= 'Context' then
+            raise_error{argnum = 1, expected = 'a Context table',
+                got = metatype.a(self)}
+        elseif type(args) ~= 'table' then
+            raise_error{argnum = 2, expected = 'a table',
+                got = metatype.a(args)}
+        end
+
+        local origin = args.origin
+        if metatype(origin) ~= 'Coordinates' then
+            raise_error{argname = 'origin', expected = 'a Coordinates cdata',
+                got = metatype.a(origin)}
+        end
+
+        local frame = args.frame
+        if frame == nil then
+            frame = coordinates.LocalFrame(origin)
+        elseif metatype(frame) ~= 'UnitaryTransformation' then
+            raise_error{argname = 'frame',
+                expected = 'a UnitaryTransformation cdata',
+                got = metatype.a(frame)}
+        end
+
+        local azimuth = get_angles(args, 'azimuth')
+        local elevation = get_angles(args, 'elevation')
+        local n_az, n_el = #azimuth, #elevation
+
+        -- Directions are stored row wise, i.e. elevation major
+        local horizontal = coordinates.HorizontalVectorArray(
+            n_az * n_el, frame)
+        local k = 0
+        for i = 1, n_el do
+            for j = 1, n_az do
+                horizontal.norm[k] = 1
+                horizontal.elevation[k] = elevation[i]
+                horizontal.azimuth[k] = azimuth[j]
+                k = k + 1
+            end
+        end
+        local directions = coordinates.CartesianVectorArray(horizontal)
+
+        local map = ffi.new('double [?]['..n_az..']', n_el)
+        if rawget(self, '_geometry') == nil then
+            return map
+        end
+
+        tmp_state:clear()
+        tmp_state.position = origin
+        local extended_state = ffi.cast(pumas_state_extended_ptr,
+                                        tmp_state._c)
+        clib.pumas_state_extended_reset(extended_state, self._c)
+        update_geometry(self, raise_error)
+
+        clib.pumas_geometry_grammage_map(self._c, tmp_state._c,
+            directions._c, distance_max(self), ffi.cast('double *', map))
+        return map
+    end
+end
+
+
+local checkpoint, restore
+do
+    local function check_args (self, path, fname)
+        if metatype(self) ~= 'Context' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a Context table', got = metatype.a(self)}
+        end
+        if type(path) ~= 'string' then
+            error.raise{fname = fname, argnum = 2, expected = 'a string',
+                got = metatype.a(path)}
+        end
+    end
+
+    local descriptions = {
+        [tonumber(ffi.C.PUMAS_RETURN_FORMAT_ERROR)] = "bad format for '%s'",
+        [tonumber(ffi.C.PUMAS_RETURN_IO_ERROR)] = "could not write '%s'",
+        [tonumber(ffi.C.PUMAS_RETURN_MEMORY_ERROR)] =
+            'could not allocate memory',
+        [tonumber(ffi.C.PUMAS_RETURN_PATH_ERROR)] = "could not open '%s'",
+        [tonumber(ffi.C.PUMAS_RETURN_VALUE_ERROR)] =
+            "inconsistent tallies in '%s'"
+    }
+
+    local function raise_error (rc, path, fname)
+        local description = descriptions[tonumber(rc)] or
+            "unexpected error for '%s' (code "..tonumber(rc)..")"
+        error.raise{fname = fname, argnum = 2, description =
+            string.format(description, path)}
+    end
+
+    function checkpoint (self, path)
+        check_args(self, path, 'checkpoint')
+        local rc = clib.pumas_context_checkpoint(self._c, path)
+        if rc ~= 0 then raise_error(rc, path, 'checkpoint') end
+    end
+
+    function restore (self, path)
+        check_args(self, path, 'restore')
+        local rc = clib.pumas_context_restore(self._c, path)
+        if rc ~= 0 then raise_error(rc, path, 'restore') end
+    end
+end
+
+
 local function random (self, n)
     if self == nil then
         error.raise{fname = 'random', argnum = 'bad', expected = '1 or 2',
@@ -302,9 +665,14 @@ end
 do
     local index = {
         __metatype = 'Context',
+        checkpoint = checkpoint,
+        grammage = grammage,
         medium = medium_callback,
+        opacity_map = opacity_map,
         random = random,
-        transport = transport
+        restore = restore,
+        transport = transport,
+        transport_into = transport_into
     }
 
     for k, v in pairs(index) do
@@ -328,9 +696,27 @@ do
         if v then return rawget(self, v) end
 
         if k == 'random_seed' then
-            local seed = ffi.new('unsigned long [1]')
-            clib.pumas_context_random_seed_get(self._c, seed)
-            return tonumber(seed[0])
+            return tonumber(clib.pumas_random_seed_get(self._c))
+        elseif k == 'events' then
+            local user_data = ffi.cast('struct pumas_user_data *',
+                                       self._c.user_data)
+            return user_data.events
+        elseif k == 'frozen' then
+            return rawget(self, '_frozen') or false
+        elseif k == 'tallies' then
+            local tallies = {}
+            for i, t in ipairs(rawget(self, '_tallies') or {}) do
+                tallies[i] = t
+            end
+            return tallies
+        elseif k == 'weight_window' then
+            local window = rawget(self, '_weight_window')
+            if window then
+                return {lower = window.lower, survival = window.survival,
+                    energies = {unpack(window.energies)}}
+            else
+                return nil
+            end
         end
 
         error.raise{['type'] = 'Context', bad_member = k}
@@ -392,20 +778,44 @@ do
         call(clib.pumas_context_create, ptr, physics._c[0],
                 ffi.sizeof('struct pumas_user_data'))
         local c = ptr[0]
-        ffi.gc(c, function () clib.pumas_context_destroy(ptr) end)
+
+        -- The cache of C geometry nodes is held by the finalizer, which must
+        -- not reference the context itself
+        local nodes = {}
+        ffi.gc(c, function ()
+            base.release(ptr[0], nodes)
+            clib.pumas_context_destroy(ptr)
+        end)
 
         c.medium = clib.pumas_geometry_medium
+        c.random = clib.pumas_random_uniform01
 
         local user_data = ffi.cast('struct pumas_user_data *', c.user_data)
         user_data.top = nil
         user_data.current = nil
+        user_data.resets = nil
+        user_data.flat = nil
+        user_data.current_index = 0
         user_data.callback = nil
+        user_data.window.enabled = 0
+        user_data.tallies = nil
+        user_data.n_tallies = 0
+        user_data.scoring = 0
+        user_data.restart = 0
+        user_data.events = 0
+        local seed = job.next_seed()
+        if seed then
+            clib.pumas_random_seed_set(c, ffi.new('unsigned long [1]', seed))
+        else
+            clib.pumas_random_seed_set(c, nil)
+        end
 
         local event = enum.Event()
         event._value = c.event
 
         local self = setmetatable({
             _c = c,
+            _nodes = nodes,
             _physics = physics,
             event = event,
             _mode = enum.Mode(c),
@@ -4,6 +4,7 @@
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
 local ffi = require('ffi')
+local array = require('pumas.coordinates.array')
 local frame = require('pumas.coordinates.frame')
 local transform = require('pumas.coordinates.transform')
 local type_ = require('pumas.coordinates.type')
@@ -16,6 +17,9 @@ coordinates.UnitaryTransformation = transform.UnitaryTransformation
 for k, v in pairs(type_) do
     coordinates[k] = v
 end
+for k, v in pairs(array) do
+    coordinates[k] = v
+end
 
 
 -------------------------------------------------------------------------------
@@ -0,0 +1,240 @@
+-------------------------------------------------------------------------------
+-- Arrays of coordinates for PUMAS
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local clib = require('pumas.clib')
+local error = require('pumas.error')
+local metatype = require('pumas.metatype')
+
+local array = {}
+
+
+-------------------------------------------------------------------------------
+-- Generic constructor for arrays of coordinates
+-------------------------------------------------------------------------------
+local function ArrayType (name, ctype, columns, framed, setter, transform)
+    local Array = {}
+    local ctype_ptr = ffi.typeof(ctype .. ' *')
+    local size_of = ffi.sizeof(ctype)
+    local column = {}
+    for _, k in ipairs(columns) do column[k] = true end
+
+    local function check_self (self, fname)
+        if self == nil then
+            error.raise{fname = fname, argnum = 'bad', expected = 1, got = 0}
+        elseif metatype(self) ~= 'CoordinatesArray' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a CoordinatesArray table', got = metatype.a(self)}
+        end
+    end
+
+    local function check_frame (frame, fname, argnum)
+        if (frame ~= nil) and (metatype(frame) ~= 'UnitaryTransformation') then
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a UnitaryTransformation cdata',
+                got = metatype.a(frame)}
+        end
+    end
+
+    local function new (size, frame)
+        local c = ffi.cast(ctype_ptr, ffi.C.calloc(1,
+            size_of + 3 * size * ffi.sizeof('double')))
+        if c == nil then
+            error.raise{fname = name,
+                description = 'could not allocate memory'}
+        end
+        ffi.gc(c, ffi.C.free)
+
+        local data = ffi.cast('double *', c + 1)
+        c.size = size
+        for i, k in ipairs(columns) do
+            c[k] = data + (i - 1) * size
+        end
+
+        local self = setmetatable({_c = c}, Array)
+        if framed then
+            rawset(self, '_frame', frame)
+            c.frame = frame
+        end
+        return self
+    end
+
+    local function set (self, other)
+        check_self(self, 'set')
+        if other == nil then
+            error.raise{fname = 'set', argnum = 'bad', expected = 2, got = 1}
+        elseif metatype(other) ~= 'CoordinatesArray' then
+            error.raise{fname = 'set', argnum = 2,
+                expected = 'a CoordinatesArray table', got = metatype.a(other)}
+        elseif other._c.size ~= self._c.size then
+            error.raise{fname = 'set', description =
+                'inconsistent sizes (' .. self._c.size .. ' ~= ' ..
+                other._c.size .. ')'}
+        end
+
+        if other._type == name then
+            ffi.copy(self._c[columns[1]], other._c[columns[1]],
+                3 * self._c.size * ffi.sizeof('double'))
+            if framed then
+                rawset(self, '_frame', other._frame)
+                self._c.frame = other._c.frame
+            end
+        else
+            local set_ = setter(other._type)
+            if set_ == nil then
+                error.raise{fname = 'set', description = 'not implemented'}
+            end
+            set_(self._c, other._c)
+            if framed then
+                rawset(self, '_frame', other._frame)
+            end
+        end
+        return self
+    end
+
+    local function clone (self)
+        check_self(self, 'clone')
+        return new(self._c.size, self._frame):set(self)
+    end
+
+    local function transform_ (self, frame)
+        check_self(self, 'transform')
+        check_frame(frame, 'transform', 2)
+
+        transform(self._c, frame)
+        rawset(self, '_frame', frame)
+        return self
+    end
+
+    error.register(name .. '.__index.clone', clone)
+    error.register(name .. '.__index.set', set)
+    if transform ~= nil then
+        error.register(name .. '.__index.transform', transform_)
+    end
+
+    function Array:__index (k)
+        if k == '__metatype' then
+            return 'CoordinatesArray'
+        elseif k == 'clone' then
+            return clone
+        elseif k == 'set' then
+            return set
+        elseif (k == 'transform') and (transform ~= nil) then
+            return transform_
+        elseif k == '_type' then
+            return name
+        elseif k == 'size' then
+            return self._c.size
+        elseif column[k] then
+            return self._c[k]
+        elseif (k == 'frame') and framed then
+            return self._frame
+        end
+    end
+
+    function Array:__newindex (k, v)
+        if (k == 'frame') and framed then
+            if (v ~= nil) and (metatype(v) ~= 'UnitaryTransformation') then
+                error.raise{['type'] = name, argname = k,
+                    expected = 'a UnitaryTransformation cdata',
+                    got = metatype.a(v)}
+            end
+            rawset(self, '_frame', v)
+            self._c.frame = v
+        else
+            error.raise{['type'] = name, bad_member = k}
+        end
+    end
+
+    function Array:__len ()
+        return self._c.size
+    end
+
+    return setmetatable(Array, {
+        __call = function (_, size, frame)
+            if type(size) == 'table' then
+                if metatype(size) == 'CoordinatesArray' then
+                    local other = size
+                    return new(other.size):set(other)
+                else
+                    size, frame = size.size, size.frame
+                end
+            end
+
+            if type(size) ~= 'number' then
+                error.raise{fname = name, argnum = 1,
+                    expected = 'a number or a table', got = metatype.a(size)}
+            elseif (size < 0) or (size % 1 ~= 0) then
+                error.raise{fname = name, argnum = 1,
+                    description = 'size must be a non negative integer'}
+            end
+            if framed then
+                check_frame(frame, name, 2)
+            end
+
+            return new(size, frame)
+        end})
+end
+
+
+-------------------------------------------------------------------------------
+-- Array of points using Cartesian coordinates
+-------------------------------------------------------------------------------
+array.CartesianPointArray = ArrayType('CartesianPointArray',
+    'struct pumas_cartesian_point_array', {'x', 'y', 'z'}, true,
+    function (t)
+        if t == 'GeodeticPointArray' then
+            return clib.pumas_coordinates_cartesian_point_array_from_geodetic
+        end
+    end,
+    clib.pumas_coordinates_cartesian_point_array_transform)
+
+
+-------------------------------------------------------------------------------
+-- Array of vectors using Cartesian coordinates
+-------------------------------------------------------------------------------
+array.CartesianVectorArray = ArrayType('CartesianVectorArray',
+    'struct pumas_cartesian_vector_array', {'x', 'y', 'z'}, true,
+    function (t)
+        if t == 'HorizontalVectorArray' then
+            return
+                clib.pumas_coordinates_cartesian_vector_array_from_horizontal
+        end
+    end,
+    clib.pumas_coordinates_cartesian_vector_array_transform)
+
+
+-------------------------------------------------------------------------------
+-- Array of points using geodetic coordinates
+-------------------------------------------------------------------------------
+array.GeodeticPointArray = ArrayType('GeodeticPointArray',
+    'struct pumas_geodetic_point_array',
+    {'latitude', 'longitude', 'altitude'}, false,
+    function (t)
+        if t == 'CartesianPointArray' then
+            return clib.pumas_coordinates_geodetic_point_array_from_cartesian
+        end
+    end)
+
+
+-------------------------------------------------------------------------------
+-- Array of vectors using horizontal coordinates
+-------------------------------------------------------------------------------
+array.HorizontalVectorArray = ArrayType('HorizontalVectorArray',
+    'struct pumas_horizontal_vector_array',
+    {'norm', 'elevation', 'azimuth'}, true,
+    function (t)
+        if t == 'CartesianVectorArray' then
+            return
+                clib.pumas_coordinates_horizontal_vector_array_from_cartesian
+        end
+    end,
+    clib.pumas_coordinates_horizontal_vector_array_transform)
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return array
@@ -1,247 +1,250 @@
 -- Tabulated atomic elements from the Particle Data Group (PDG)
 -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/index.html
+--
+-- Entries are stored as compact records, decoded on first access. A record
+-- lists the Z, A and I properties.
 return {
 
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hydrogen_gas.html
-    H  = {A = 1.0087, I = 1.92E-08, Z = 1},
+    H  = '1 1.0087 1.92E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/deuterium_gas.html
-    D  = {A = 2.0141, I = 1.92E-08, Z = 1},
+    D  = '1 2.0141 1.92E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/helium_gas_He.html
-    He = {A = 4.0026, I = 4.18E-08, Z = 2},
+    He = '2 4.0026 4.18E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_Li.html
-    Li = {A = 6.942, I = 4E-08, Z = 3},
+    Li = '3 6.942 4E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/beryllium_Be.html
-    Be = {A = 9.01218, I = 6.37E-08, Z = 4},
+    Be = '4 9.01218 6.37E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/boron_B.html
-    B  = {A = 10.817, I = 7.6E-08, Z = 5},
+    B  = '5 10.817 7.6E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_amorphous_C.html
-    C  = {A = 12.0108, I = 7.8E-08, Z = 6},
+    C  = '6 12.0108 7.8E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nitrogen_gas.html
-    N  = {A = 14.0072, I = 8.2E-08, Z = 7},
+    N  = '7 14.0072 8.2E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/oxygen_gas.html
-    O  = {A = 15.9993, I = 9.5E-08, Z = 8},
+    O  = '8 15.9993 9.5E-08',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/fluorine_gas.html
-    F  = {A = 18.9984, I = 1.15E-07, Z = 9},
+    F  = '9 18.9984 1.15E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neon_gas_Ne.html
-    Ne = {A = 20.1798, I = 1.37E-07, Z = 10},
+    Ne = '10 20.1798 1.37E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_Na.html
-    Na = {A = 22.9898, I = 1.49E-07, Z = 11},
+    Na = '11 22.9898 1.49E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_Mg.html
-    Mg = {A = 24.3056, I = 1.56E-07, Z = 12},
+    Mg = '12 24.3056 1.56E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/aluminum_Al.html
-    Al = {A = 26.9815, I = 1.66E-07, Z = 13},
+    Al = '13 26.9815 1.66E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silicon_Si.html
-    Si = {A = 28.0855, I = 1.73E-07, Z = 14},
+    Si = '14 28.0855 1.73E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/phosphorus_P.html
-    P  = {A = 30.9738, I = 1.73E-07, Z = 15},
+    P  = '15 30.9738 1.73E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sulfur_S.html
-    S  = {A = 32.0655, I = 1.8E-07, Z = 16},
+    S  = '16 32.0655 1.8E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chlorine_gas.html
-    Cl = {A = 35.4532, I = 1.74E-07, Z = 17},
+    Cl = '17 35.4532 1.74E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/argon_gas_Ar.html
-    Ar = {A = 39.9481, I = 1.88E-07, Z = 18},
+    Ar = '18 39.9481 1.88E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/potassium_K.html
-    K  = {A = 39.0983, I = 1.9E-07, Z = 19},
+    K  = '19 39.0983 1.9E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_Ca.html
-    Ca = {A = 40.0784, I = 1.91E-07, Z = 20},
+    Ca = '20 40.0784 1.91E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/scandium_Sc.html
-    Sc = {A = 44.9559, I = 2.16E-07, Z = 21},
+    Sc = '21 44.9559 2.16E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/titanium_Ti.html
-    Ti = {A = 47.8671, I = 2.33E-07, Z = 22},
+    Ti = '22 47.8671 2.33E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/vanadium_V.html
-    V  = {A = 50.9415, I = 2.45E-07, Z = 23},
+    V  = '23 50.9415 2.45E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chromium_Cr.html
-    Cr = {A = 51.9962, I = 2.57E-07, Z = 24},
+    Cr = '24 51.9962 2.57E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/manganese_Mn.html
-    Mn = {A = 54.938, I = 2.72E-07, Z = 25},
+    Mn = '25 54.938 2.72E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iron_Fe.html
-    Fe = {A = 55.8452, I = 2.86E-07, Z = 26},
+    Fe = '26 55.8452 2.86E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cobalt_Co.html
-    Co = {A = 58.9332, I = 2.97E-07, Z = 27},
+    Co = '27 58.9332 2.97E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nickel_Ni.html
-    Ni = {A = 58.6934, I = 3.11E-07, Z = 28},
+    Ni = '28 58.6934 3.11E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/copper_Cu.html
-    Cu = {A = 63.5463, I = 3.22E-07, Z = 29},
+    Cu = '29 63.5463 3.22E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/zinc_Zn.html
-    Zn = {A = 65.382, I = 3.3E-07, Z = 30},
+    Zn = '30 65.382 3.3E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gallium_Ga.html
-    Ga = {A = 69.7231, I = 3.34E-07, Z = 31},
+    Ga = '31 69.7231 3.34E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/germanium_Ge.html
-    Ge = {A = 72.6301, I = 3.5E-07, Z = 32},
+    Ge = '32 72.6301 3.5E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/arsenic_As.html
-    As = {A = 74.9216, I = 3.47E-07, Z = 33},
+    As = '33 74.9216 3.47E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/selenium_Se.html
-    Se = {A = 78.9718, I = 3.48E-07, Z = 34},
+    Se = '34 78.9718 3.48E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_bromine.html
-    Br = {A = 79.9041, I = 3.57E-07, Z = 35},
+    Br = '35 79.9041 3.57E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/krypton_gas_Kr.html
-    Kr = {A = 83.7982, I = 3.52E-07, Z = 36},
+    Kr = '36 83.7982 3.52E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rubidium_Rb.html
-    Rb = {A = 85.4678, I = 3.63E-07, Z = 37},
+    Rb = '37 85.4678 3.63E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/strontium_Sr.html
-    Sr = {A = 87.621, I = 3.66E-07, Z = 38},
+    Sr = '38 87.621 3.66E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_Y.html
-    Y  = {A = 88.9058, I = 3.79E-07, Z = 39},
+    Y  = '39 88.9058 3.79E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/zirconium_Zr.html
-    Zr = {A = 91.2242, I = 3.93E-07, Z = 40},
+    Zr = '40 91.2242 3.93E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/niobium_Nb.html
-    Nb = {A = 92.9064, I = 4.17E-07, Z = 41},
+    Nb = '41 92.9064 4.17E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/molybdenum_Mo.html
-    Mo = {A = 95.951, I = 4.24E-07, Z = 42},
+    Mo = '42 95.951 4.24E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/technetium_Tc.html
-    Tc = {A = 97.9072, I = 4.28E-07, Z = 43},
+    Tc = '43 97.9072 4.28E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ruthenium_Ru.html
-    Ru = {A = 101.072, I = 4.41E-07, Z = 44},
+    Ru = '44 101.072 4.41E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rhodium_Rh.html
-    Rh = {A = 102.906, I = 4.49E-07, Z = 45},
+    Rh = '45 102.906 4.49E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/palladium_Pd.html
-    Pd = {A = 106.421, I = 4.7E-07, Z = 46},
+    Pd = '46 106.421 4.7E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silver_Ag.html
-    Ag = {A = 107.868, I = 4.7E-07, Z = 47},
+    Ag = '47 107.868 4.7E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cadmium_Cd.html
-    Cd = {A = 112.414, I = 4.69E-07, Z = 48},
+    Cd = '48 112.414 4.69E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/indium_In.html
-    In = {A = 114.818, I = 4.88E-07, Z = 49},
+    In = '49 114.818 4.88E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tin_Sn.html
-    Sn = {A = 118.711, I = 4.88E-07, Z = 50},
+    Sn = '50 118.711 4.88E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/antimony_Sb.html
-    Sb = {A = 121.76, I = 4.87E-07, Z = 51},
+    Sb = '51 121.76 4.87E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tellurium_Te.html
-    Te = {A = 127.603, I = 4.85E-07, Z = 52},
+    Te = '52 127.603 4.85E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iodine_I.html
-    I  = {A = 126.904, I = 4.91E-07, Z = 53},
+    I  = '53 126.904 4.91E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/xenon_gas_Xe.html
-    Xe = {A = 131.294, I = 4.82E-07, Z = 54},
+    Xe = '54 131.294 4.82E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/caesium_Cs.html
-    Cs = {A = 132.905, I = 4.88E-07, Z = 55},
+    Cs = '55 132.905 4.88E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/barium_Ba.html
-    Ba = {A = 137.328, I = 4.91E-07, Z = 56},
+    Ba = '56 137.328 4.91E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_La.html
-    La = {A = 138.905, I = 5.01E-07, Z = 57},
+    La = '57 138.905 5.01E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cerium_Ce.html
-    Ce = {A = 140.116, I = 5.23E-07, Z = 58},
+    Ce = '58 140.116 5.23E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/praseodymium_Pr.html
-    Pr = {A = 140.908, I = 5.35E-07, Z = 59},
+    Pr = '59 140.908 5.35E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neodymium_Nd.html
-    Nd = {A = 144.242, I = 5.46E-07, Z = 60},
+    Nd = '60 144.242 5.46E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/promethium_Pm.html
-    Pm = {A = 144.913, I = 5.6E-07, Z = 61},
+    Pm = '61 144.913 5.6E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/samarium_Sm.html
-    Sm = {A = 150.362, I = 5.74E-07, Z = 62},
+    Sm = '62 150.362 5.74E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/europium_Eu.html
-    Eu = {A = 151.964, I = 5.8E-07, Z = 63},
+    Eu = '63 151.964 5.8E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gadolinium_Gd.html
-    Gd = {A = 157.253, I = 5.91E-07, Z = 64},
+    Gd = '64 157.253 5.91E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/terbium_Tb.html
-    Tb = {A = 158.925, I = 6.14E-07, Z = 65},
+    Tb = '65 158.925 6.14E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dysprosium_Dy.html
-    Dy = {A = 162.5, I = 6.28E-07, Z = 66},
+    Dy = '66 162.5 6.28E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/holmium_Ho.html
-    Ho = {A = 164.93, I = 6.5E-07, Z = 67},
+    Ho = '67 164.93 6.5E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/erbium_Er.html
-    Er = {A = 167.259, I = 6.58E-07, Z = 68},
+    Er = '68 167.259 6.58E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thulium_Tm.html
-    Tm = {A = 168.934, I = 6.74E-07, Z = 69},
+    Tm = '69 168.934 6.74E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ytterbium_Yb.html
-    Yb = {A = 173.054, I = 6.84E-07, Z = 70},
+    Yb = '70 173.054 6.84E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_Lu.html
-    Lu = {A = 174.967, I = 6.94E-07, Z = 71},
+    Lu = '71 174.967 6.94E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hafnium_Hf.html
-    Hf = {A = 178.492, I = 7.05E-07, Z = 72},
+    Hf = '72 178.492 7.05E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tantalum_Ta.html
-    Ta = {A = 180.948, I = 7.18E-07, Z = 73},
+    Ta = '73 180.948 7.18E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tungsten_W.html
-    W  = {A = 183.841, I = 7.27E-07, Z = 74},
+    W  = '74 183.841 7.27E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rhenium_Re.html
-    Re = {A = 186.207, I = 7.36E-07, Z = 75},
+    Re = '75 186.207 7.36E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/osmium_Os.html
-    Os = {A = 190.233, I = 7.46E-07, Z = 76},
+    Os = '76 190.233 7.46E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iridium_Ir.html
-    Ir = {A = 192.217, I = 7.57E-07, Z = 77},
+    Ir = '77 192.217 7.57E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/platinum_Pt.html
-    Pt = {A = 195.085, I = 7.9E-07, Z = 78},
+    Pt = '78 195.085 7.9E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gold_Au.html
-    Au = {A = 196.967, I = 7.9E-07, Z = 79},
+    Au = '79 196.967 7.9E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mercury_Hg.html
-    Hg = {A = 200.592, I = 8E-07, Z = 80},
+    Hg = '80 200.592 8E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thallium_Tl.html
-    Tl = {A = 204.382, I = 8.1E-07, Z = 81},
+    Tl = '81 204.382 8.1E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_Pb.html
-    Pb = {A = 207.21, I = 8.23E-07, Z = 82},
+    Pb = '82 207.21 8.23E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bismuth_Bi.html
-    Bi = {A = 208.98, I = 8.23E-07, Z = 83},
+    Bi = '83 208.98 8.23E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polonium_Po.html
-    Po = {A = 208.982, I = 8.3E-07, Z = 84},
+    Po = '84 208.982 8.3E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/astatine_At.html
-    At = {A = 209.987, I = 8.25E-07, Z = 85},
+    At = '85 209.987 8.25E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/radon_Rn.html
-    Rn = {A = 222.018, I = 7.94E-07, Z = 86},
+    Rn = '86 222.018 7.94E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/francium_Fr.html
-    Fr = {A = 223.02, I = 8.27E-07, Z = 87},
+    Fr = '87 223.02 8.27E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/radium_Ra.html
-    Ra = {A = 226.025, I = 8.26E-07, Z = 88},
+    Ra = '88 226.025 8.26E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/actinium_Ac.html
-    Ac = {A = 227.028, I = 8.41E-07, Z = 89},
+    Ac = '89 227.028 8.41E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thorium_Th.html
-    Th = {A = 232.038, I = 8.47E-07, Z = 90},
+    Th = '90 232.038 8.47E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/protactinium_Pa.html
-    Pa = {A = 231.036, I = 8.78E-07, Z = 91},
+    Pa = '91 231.036 8.78E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/uranium_U.html
-    U  = {A = 238.029, I = 8.9E-07, Z = 92},
+    U  = '92 238.029 8.9E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neptunium_Np.html
-    Np = {A = 237.048, I = 9.02E-07, Z = 93},
+    Np = '93 237.048 9.02E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/plutonium_Pu.html
-    Pu = {A = 244.064, I = 9.21E-07, Z = 94},
+    Pu = '94 244.064 9.21E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/americium_Am.html
-    Am = {A = 243.061, I = 9.34E-07, Z = 95},
+    Am = '95 243.061 9.34E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/curium_Cm.html
-    Cm = {A = 247.07, I = 9.39E-07, Z = 96},
+    Cm = '96 247.07 9.39E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/berkelium_Bk.html
-    Bk = {A = 247.07, I = 9.52E-07, Z = 97},
+    Bk = '97 247.07 9.52E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/californium_Cf.html
-    Cf = {A = 251.08, I = 9.66E-07, Z = 98},
+    Cf = '98 251.08 9.66E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/einsteinium_Es.html
-    Es = {A = 252.083, I = 9.8E-07, Z = 99},
+    Es = '99 252.083 9.8E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/fermium_Fm.html
-    Fm = {A = 257.095, I = 9.94E-07, Z = 100},
+    Fm = '100 257.095 9.94E-07',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mendelevium_Md.html
-    Md = {A = 258.098, I = 1.007E-06, Z = 101},
+    Md = '101 258.098 1.007E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nobelium_No.html
-    No = {A = 259.101, I = 1.02E-06, Z = 102},
+    No = '102 259.101 1.02E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lawrencium_Lr.html
-    Lr = {A = 262.11, I = 1.034E-06, Z = 103},
+    Lr = '103 262.11 1.034E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rutherfordium_Rf.html
-    Rf = {A = 267.122, I = 1.047E-06, Z = 104},
+    Rf = '104 267.122 1.047E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dubnium_Db.html
-    Db = {A = 268.126, I = 1.061E-06, Z = 105},
+    Db = '105 268.126 1.061E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/seaborgium_Sg.html
-    Sg = {A = 269.129, I = 1.074E-06, Z = 106},
+    Sg = '106 269.129 1.074E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bohrium_Bh.html
-    Bh = {A = 270.133, I = 1.087E-06, Z = 107},
+    Bh = '107 270.133 1.087E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hassium_Hs.html
-    Hs = {A = 269.134, I = 1.102E-06, Z = 108},
+    Hs = '108 269.134 1.102E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/meitnerium_Mt.html
-    Mt = {A = 278.156, I = 1.115E-06, Z = 109},
+    Mt = '109 278.156 1.115E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/darmstadtium_Ds.html
-    Ds = {A = 281.165, I = 1.129E-06, Z = 110},
+    Ds = '110 281.165 1.129E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/roentgenium_Rg.html
-    Rg = {A = 282.169, I = 1.143E-06, Z = 111},
+    Rg = '111 282.169 1.143E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/copernicium_Cn.html
-    Cn = {A = 285.177, I = 1.156E-06, Z = 112},
+    Cn = '112 285.177 1.156E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nihonium_Nh.html
-    Nh = {A = 286.182, I = 1.171E-06, Z = 113},
+    Nh = '113 286.182 1.171E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/flerovium_Fl.html
-    Fl = {A = 289.19, I = 1.185E-06, Z = 114},
+    Fl = '114 289.19 1.185E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/moscovium_Mc.html
-    Mc = {A = 289.194, I = 1.199E-06, Z = 115},
+    Mc = '115 289.194 1.199E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/livermorium_Lv.html
-    Lv = {A = 293.205, I = 1.213E-06, Z = 116},
+    Lv = '116 293.205 1.213E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tennessine_Ts.html
-    Ts = {A = 294.211, I = 1.227E-06, Z = 117},
+    Ts = '117 294.211 1.227E-06',
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/oganesson_Og.html
-    Og = {A = 294.214, I = 1.242E-06, Z = 118},
+    Og = '118 294.214 1.242E-06',
 
     -- Fictious Rockium element for Standard Rock
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/standardrock.html
-    Rk = {A = 22, I = 1.364E-07, Z = 11}
+    Rk = '11 22 1.364E-07'
 }
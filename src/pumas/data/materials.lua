@@ -1,3128 +1,2383 @@
 -- Tabulated materials from the Particle Data Group (PDG)
 -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/index.html
+--
+-- Entries are stored as compact records, decoded on first access. A record
+-- lists the ZoA, I, density, state, x0, x1, a, k, Cbar and delta0 properties,
+-- followed by (symbol, mass fraction) pairs for the elemental composition.
 
 return {
 
     -- A-150 tissue-equivalent plastic
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/a-150_tissue-equivalent_plastic.html
-    A150TissueEquivalentPlastic = {
-        ZoA = 0.5489578, x0 = 0.1329, I = 6.51E-08, x1 = 2.6234, density = 1127,
-        delta0 = 0, state = 'liquid', k = 3.4442, a = 0.1078, Cbar = 3.11,
-        elements = {O = 0.052316, N = 0.035057, Ca = 0.018378, H = 0.101327,
-        C = 0.775501, F = 0.017422}
-    },
+    A150TissueEquivalentPlastic =
+        '0.5489578 6.51E-08 1127 liquid 0.1329 2.6234 0.1078 3.4442 3.11 0 O \z
+        0.052316 N 0.035057 Ca 0.018378 H 0.101327 C 0.775501 F 0.017422',
 
     -- Acetone
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/acetone.html
-    Acetone = {
-        ZoA = 0.55089, x0 = 0.2197, I = 6.42E-08, x1 = 2.6928, density = 789.9,
-        delta0 = 0, state = 'liquid', k = 3.4047, a = 0.111, Cbar = 3.4341,
-        elements = {H = 0.104122, C = 0.620405, O = 0.275473}
-    },
+    Acetone =
+        '0.55089 6.42E-08 789.9 liquid 0.2197 2.6928 0.111 3.4047 3.4341 0 H \z
+        0.104122 C 0.620405 O 0.275473',
 
     -- Acetylene CHCH
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/acetylene_CHCH.html
-    Acetylene = {
-        ZoA = 0.5376265, x0 = 1.6017, I = 5.82E-08, x1 = 4.0074,
-        density = 1.097, delta0 = 0, state = 'gas', k = 3.4277, a = 0.1217,
-        Cbar = 9.8419, elements = {C = 0.922582, H = 0.077418}
-    },
+    Acetylene =
+        '0.5376265 5.82E-08 1.097 gas 1.6017 4.0074 0.1217 3.4277 9.8419 0 C \z
+        0.922582 H 0.077418',
 
     -- Polymethylmethacrylate acrylic
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polymethylmethacrylate_acrylic.html
-    Acrylic = {
-        ZoA = 0.5393117, x0 = 0.1824, I = 7.4E-08, x1 = 2.6681, density = 1190,
-        delta0 = 0, state = 'liquid', k = 3.3836, a = 0.1143, Cbar = 3.3297,
-        elements = {H = 0.080538, C = 0.599848, O = 0.319614}
-    },
+    Acrylic =
+        '0.5393117 7.4E-08 1190 liquid 0.1824 2.6681 0.1143 3.3836 3.3297 0 H \z
+        0.080538 C 0.599848 O 0.319614',
 
     -- Actinium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/actinium_Ac.html
-    Actinium = {
-        ZoA = 0.3920221, x0 = 0.4559, I = 8.41E-07, x1 = 3.7966,
-        density = 10070, delta0 = 0.14, state = 'liquid', k = 3.2683,
-        a = 0.0857, Cbar = 6.3742, elements = {Ac = 1}
-    },
+    Actinium =
+        '0.3920221 8.41E-07 10070 liquid 0.4559 3.7966 0.0857 3.2683 6.3742 \z
+        0.14 Ac 1',
 
     -- Adenine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/adenine.html
-    Adenine = {
-        ZoA = 0.5179918, x0 = 0.1295, I = 7.14E-08, x1 = 2.4219, density = 1350,
-        delta0 = 0, state = 'liquid', k = 3.0271, a = 0.2091, Cbar = 3.1724,
-        elements = {H = 0.037294, C = 0.44443, N = 0.518275}
-    },
+    Adenine =
+        '0.5179918 7.14E-08 1350 liquid 0.1295 2.4219 0.2091 3.0271 3.1724 0 \z
+        H 0.037294 C 0.44443 N 0.518275',
 
     -- Adipose tissue ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/adipose_tissue_ICRP.html
-    AdiposeTissue = {
-        ZoA = 0.55838, x0 = 0.1827, I = 6.32E-08, x1 = 2.653, density = 920,
-        delta0 = 0, state = 'liquid', k = 3.4817, a = 0.1028, Cbar = 3.2367,
-        elements = {K = 0.00032, O = 0.232333, S = 0.00073, H = 0.119477,
-        P = 0.00016, Fe = 2E-05, Zn = 2E-05, Ca = 2E-05, Na = 0.0005,
-        Cl = 0.00119, Mg = 2E-05, C = 0.63724, N = 0.00797}
-    },
+    AdiposeTissue =
+        '0.55838 6.32E-08 920 liquid 0.1827 2.653 0.1028 3.4817 3.2367 0 K \z
+        0.00032 O 0.232333 S 0.00073 H 0.119477 P 0.00016 Fe 2E-05 Zn 2E-05 \z
+        Ca 2E-05 Na 0.0005 Cl 0.00119 Mg 2E-05 C 0.63724 N 0.00797',
 
     -- Ag halides in phot emulsion
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ag_halides_in_phot_emulsion.html
-    AgHalidesInPhotEmulsion = {
-        ZoA = 0.4366328, x0 = 0.0353, I = 4.871E-07, x1 = 3.2117,
-        density = 6470, delta0 = 0, state = 'liquid', k = 2.6814, a = 0.2459,
-        Cbar = 5.6166, elements = {I = 0.003357, Br = 0.422895, Ag = 0.573748}
-    },
+    AgHalidesInPhotEmulsion =
+        '0.4366328 4.871E-07 6470 liquid 0.0353 3.2117 0.2459 2.6814 5.6166 0 \z
+        I 0.003357 Br 0.422895 Ag 0.573748',
 
     -- Air dry 1 atm
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/air_dry_1_atm.html
-    Air = {
-        ZoA = 0.4991766, x0 = 1.7418, I = 8.57E-08, x1 = 4.2759,
-        density = 1.205, delta0 = 0, state = 'gas', k = 3.3994, a = 0.1091,
-        Cbar = 10.5961, elements = {Ar = 0.012827, O = 0.231781, C = 0.000124,
-        N = 0.755267}
-    },
+    Air =
+        '0.4991766 8.57E-08 1.205 gas 1.7418 4.2759 0.1091 3.3994 10.5961 0 \z
+        Ar 0.012827 O 0.231781 C 0.000124 N 0.755267',
 
     -- Alanine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/alanine.html
-    Alanine = {
-        ZoA = 0.5386981, x0 = 0.1354, I = 7.19E-08, x1 = 2.6336, density = 1420,
-        delta0 = 0, state = 'liquid', k = 3.3526, a = 0.1148, Cbar = 3.0965,
-        elements = {O = 0.359159, H = 0.07919, C = 0.404439, N = 0.157213}
-    },
+    Alanine =
+        '0.5386981 7.19E-08 1420 liquid 0.1354 2.6336 0.1148 3.3526 3.0965 0 \z
+        O 0.359159 H 0.07919 C 0.404439 N 0.157213',
 
     -- Aluminum
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/aluminum_Al.html
-    Aluminum = {
-        ZoA = 0.4818116, x0 = 0.1708, I = 1.66E-07, x1 = 3.0127, density = 2699,
-        delta0 = 0.12, state = 'liquid', k = 3.6345, a = 0.0802, Cbar = 4.2395,
-        elements = {Al = 1}
-    },
+    Aluminum =
+        '0.4818116 1.66E-07 2699 liquid 0.1708 3.0127 0.0802 3.6345 4.2395 \z
+        0.12 Al 1',
 
     -- Aluminum oxide sapphire
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/aluminum_oxide_sapphire.html
-    AluminumOxideSapphire = {
-        ZoA = 0.4903841, x0 = 0.0402, I = 1.452E-07, x1 = 2.8665,
-        density = 3970, delta0 = 0, state = 'liquid', k = 3.5458, a = 0.085,
-        Cbar = 3.5682, elements = {Al = 0.529251, O = 0.470749}
-    },
+    AluminumOxideSapphire =
+        '0.4903841 1.452E-07 3970 liquid 0.0402 2.8665 0.085 3.5458 3.5682 0 \z
+        Al 0.529251 O 0.470749',
 
     -- Amber
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/amber.html
-    Amber = {
-        ZoA = 0.5516984, x0 = 0.1335, I = 6.32E-08, x1 = 2.561, density = 1100,
-        delta0 = 0, state = 'liquid', k = 3.4098, a = 0.1193, Cbar = 3.0701,
-        elements = {H = 0.10593, C = 0.788973, O = 0.105096}
-    },
+    Amber =
+        '0.5516984 6.32E-08 1100 liquid 0.1335 2.561 0.1193 3.4098 3.0701 0 H \z
+        0.10593 C 0.788973 O 0.105096',
 
     -- Americium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/americium_Am.html
-    Americium = {
-        ZoA = 0.3908484, x0 = 0.2274, I = 9.34E-07, x1 = 3.5021,
-        density = 13670, delta0 = 0.14, state = 'liquid', k = 2.7615,
-        a = 0.2031, Cbar = 6.2813, elements = {Am = 1}
-    },
+    Americium =
+        '0.3908484 9.34E-07 13670 liquid 0.2274 3.5021 0.2031 2.7615 6.2813 \z
+        0.14 Am 1',
 
     -- Ammonia
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ammonia.html
-    Ammonia = {
-        ZoA = 0.5870308, x0 = 1.6822, I = 5.37E-08, x1 = 4.1158,
-        density = 0.826, delta0 = 0, state = 'gas', k = 3.6464, a = 0.0831,
-        Cbar = 9.8763, elements = {N = 0.822453, H = 0.177547}
-    },
+    Ammonia =
+        '0.5870308 5.37E-08 0.826 gas 1.6822 4.1158 0.0831 3.6464 9.8763 0 N \z
+        0.822453 H 0.177547',
 
     -- Aniline
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/aniline.html
-    Aniline = {
-        ZoA = 0.5368395, x0 = 0.1618, I = 6.62E-08, x1 = 2.5805, density = 1023,
-        delta0 = 0, state = 'liquid', k = 3.3434, a = 0.1313, Cbar = 3.2622,
-        elements = {H = 0.075759, C = 0.773838, N = 0.150403}
-    },
+    Aniline =
+        '0.5368395 6.62E-08 1023 liquid 0.1618 2.5805 0.1313 3.3434 3.2622 0 \z
+        H 0.075759 C 0.773838 N 0.150403',
 
     -- Anthracene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/anthracene.html
-    Anthracene = {
-        ZoA = 0.5273631, x0 = 0.1146, I = 6.95E-08, x1 = 2.5213, density = 1283,
-        delta0 = 0, state = 'liquid', k = 3.2831, a = 0.1468, Cbar = 3.1514,
-        elements = {C = 0.94345, H = 0.05655}
-    },
+    Anthracene =
+        '0.5273631 6.95E-08 1283 liquid 0.1146 2.5213 0.1468 3.2831 3.1514 0 \z
+        C 0.94345 H 0.05655',
 
     -- Antimony
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/antimony_Sb.html
-    Antimony = {
-        ZoA = 0.4188568, x0 = 0.3189, I = 4.87E-07, x1 = 3.3489, density = 6691,
-        delta0 = 0.14, state = 'liquid', k = 2.9319, a = 0.1665, Cbar = 5.6241,
-        elements = {Sb = 1}
-    },
+    Antimony =
+        '0.4188568 4.87E-07 6691 liquid 0.3189 3.3489 0.1665 2.9319 5.6241 \z
+        0.14 Sb 1',
 
     -- Argon gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/argon_gas_Ar.html
-    ArgonGas = {
-        ZoA = 0.4505846, x0 = 1.7635, I = 1.88E-07, x1 = 4.4855,
-        density = 1.662, delta0 = 0, state = 'gas', k = 2.9618, a = 0.1971,
-        Cbar = 11.948, elements = {Ar = 1}
-    },
+    ArgonGas =
+        '0.4505846 1.88E-07 1.662 gas 1.7635 4.4855 0.1971 2.9618 11.948 0 Ar \z
+        1',
 
     -- Arsenic
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/arsenic_As.html
-    Arsenic = {
-        ZoA = 0.4404604, x0 = 0.1767, I = 3.47E-07, x1 = 3.5702, density = 5730,
-        delta0 = 0.08, state = 'liquid', k = 3.4176, a = 0.0663, Cbar = 5.051,
-        elements = {As = 1}
-    },
+    Arsenic =
+        '0.4404604 3.47E-07 5730 liquid 0.1767 3.5702 0.0663 3.4176 5.051 \z
+        0.08 As 1',
 
     -- Astatine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/astatine_At.html
-    Astatine = {
-        ZoA = 0.404787, x0 = 0.7833, I = 8.25E-07, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.3118, Cbar = 7.0039,
-        elements = {At = 1}
-    },
+    Astatine =
+        '0.404787 8.25E-07 14000 liquid 0.7833 3 0.3118 3 7.0039 0 At 1',
 
     -- B-100 Bone-equivalent plastic
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/b-100_Bone-equivalent_plastic.html
-    B100BoneEquivalentPlastic = {
-        ZoA = 0.5273535, x0 = 0.1252, I = 8.59E-08, x1 = 3.042, density = 1450,
-        delta0 = 0, state = 'liquid', k = 3.7365, a = 0.0527, Cbar = 3.4528,
-        elements = {O = 0.032085, N = 0.0215, Ca = 0.176589, H = 0.065471,
-        C = 0.536945, F = 0.167411}
-    },
+    B100BoneEquivalentPlastic =
+        '0.5273535 8.59E-08 1450 liquid 0.1252 3.042 0.0527 3.7365 3.4528 0 O \z
+        0.032085 N 0.0215 Ca 0.176589 H 0.065471 C 0.536945 F 0.167411',
 
     -- Bakelite
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bakelite.html
-    Bakelite = {
-        ZoA = 0.5278805, x0 = 0.1471, I = 7.24E-08, x1 = 2.6055, density = 1250,
-        delta0 = 0, state = 'liquid', k = 3.347, a = 0.1271, Cbar = 3.2582,
-        elements = {H = 0.057441, C = 0.774591, O = 0.167968}
-    },
+    Bakelite =
+        '0.5278805 7.24E-08 1250 liquid 0.1471 2.6055 0.1271 3.347 3.2582 0 H \z
+        0.057441 C 0.774591 O 0.167968',
 
     -- Barium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/barium_Ba.html
-    Barium = {
-        ZoA = 0.4077828, x0 = 0.419, I = 4.91E-07, x1 = 3.4547, density = 3500,
-        delta0 = 0.14, state = 'liquid', k = 2.8906, a = 0.1827, Cbar = 6.3153,
-        elements = {Ba = 1}
-    },
+    Barium =
+        '0.4077828 4.91E-07 3500 liquid 0.419 3.4547 0.1827 2.8906 6.3153 \z
+        0.14 Ba 1',
 
     -- Barium fluoride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/barium_fluoride.html
-    BariumFluoride = {
-        ZoA = 0.4220736, x0 = 0.0099, I = 3.759E-07, x1 = 3.387, density = 4893,
-        delta0 = 0, state = 'liquid', k = 2.8867, a = 0.1599, Cbar = 5.4116,
-        elements = {Ba = 0.78328, F = 0.21672}
-    },
+    BariumFluoride =
+        '0.4220736 3.759E-07 4893 liquid 0.0099 3.387 0.1599 2.8867 5.4116 0 \z
+        Ba 0.78328 F 0.21672',
 
     -- Barium sulfate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/barium_sulfate.html
-    BariumSulfate = {
-        ZoA = 0.4456033, x0 = 0.0128, I = 2.857E-07, x1 = 3.4069,
-        density = 4500, delta0 = 0, state = 'liquid', k = 3.0427, a = 0.1175,
-        Cbar = 4.8923, elements = {O = 0.274212, S = 0.137368, Ba = 0.58842}
-    },
+    BariumSulfate =
+        '0.4456033 2.857E-07 4500 liquid 0.0128 3.4069 0.1175 3.0427 4.8923 0 \z
+        O 0.274212 S 0.137368 Ba 0.58842',
 
     -- Benzene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/benzene.html
-    Benzene = {
-        ZoA = 0.5376265, x0 = 0.171, I = 6.34E-08, x1 = 2.5091, density = 878.7,
-        delta0 = 0, state = 'liquid', k = 3.2174, a = 0.1652, Cbar = 3.3269,
-        elements = {C = 0.922582, H = 0.077418}
-    },
+    Benzene =
+        '0.5376265 6.34E-08 878.7 liquid 0.171 2.5091 0.1652 3.2174 3.3269 0 \z
+        C 0.922582 H 0.077418',
 
     -- Berkelium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/berkelium_Bk.html
-    Berkelium = {
-        ZoA = 0.3926013, x0 = 0.0509, I = 9.52E-07, x1 = 2.5, density = 9860,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2556, Cbar = 3.9886,
-        elements = {Bk = 1}
-    },
+    Berkelium =
+        '0.3926013 9.52E-07 9860 liquid 0.0509 2.5 0.2556 3 3.9886 0 Bk 1',
 
     -- Beryllium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/beryllium_Be.html
-    Beryllium = {
-        ZoA = 0.4438438, x0 = 0.0592, I = 6.37E-08, x1 = 1.6922, density = 1848,
-        delta0 = 0.14, state = 'liquid', k = 2.4339, a = 0.8039, Cbar = 2.7847,
-        elements = {Be = 1}
-    },
+    Beryllium =
+        '0.4438438 6.37E-08 1848 liquid 0.0592 1.6922 0.8039 2.4339 2.7847 \z
+        0.14 Be 1',
 
     -- Beryllium oxide BeO
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/beryllium_oxide_BeO.html
-    BerylliumOxide = {
-        ZoA = 0.4797798, x0 = 0.0241, I = 9.32E-08, x1 = 2.5846, density = 3010,
-        delta0 = 0, state = 'liquid', k = 3.4927, a = 0.1076, Cbar = 2.9801,
-        elements = {Be = 0.36032, O = 0.63968}
-    },
+    BerylliumOxide =
+        '0.4797798 9.32E-08 3010 liquid 0.0241 2.5846 0.1076 3.4927 2.9801 0 \z
+        Be 0.36032 O 0.63968',
 
     -- Bismuth
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bismuth_Bi.html
-    Bismuth = {
-        ZoA = 0.3971672, x0 = 0.4152, I = 8.23E-07, x1 = 3.8248, density = 9747,
-        delta0 = 0.14, state = 'liquid', k = 3.1671, a = 0.0941, Cbar = 6.3505,
-        elements = {Bi = 1}
-    },
+    Bismuth =
+        '0.3971672 8.23E-07 9747 liquid 0.4152 3.8248 0.0941 3.1671 6.3505 \z
+        0.14 Bi 1',
 
     -- Bismuth germanate BGO
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bismuth_germanate_BGO.html
-    BismuthGermanate = {
-        ZoA = 0.4206107, x0 = 0.0456, I = 5.341E-07, x1 = 3.7816,
-        density = 7130, delta0 = 0, state = 'liquid', k = 3.0781, a = 0.0957,
-        Cbar = 5.7409, elements = {O = 0.154126, Bi = 0.671054, Ge = 0.17482}
-    },
+    BismuthGermanate =
+        '0.4206107 5.341E-07 7130 liquid 0.0456 3.7816 0.0957 3.0781 5.7409 0 \z
+        O 0.154126 Bi 0.671054 Ge 0.17482',
 
     -- Bismuth silicate BSO
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bismuth_silicate_BSO.html
-    BismuthSilicate = {
-        ZoA = 0.4225985, x0 = 0.4077, I = 5.192E-07, x1 = 3.0557,
-        density = 7120, delta0 = 0, state = 'liquid', k = 3, a = 0.2187,
-        Cbar = 5.9374, elements = {Si = 0.075759, O = 0.172629, Bi = 0.751613}
-    },
+    BismuthSilicate =
+        '0.4225985 5.192E-07 7120 liquid 0.4077 3.0557 0.2187 3 5.9374 0 Si \z
+        0.075759 O 0.172629 Bi 0.751613',
 
     -- Blood ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/blood_ICRP.html
-    Blood = {
-        ZoA = 0.5498747, x0 = 0.2239, I = 7.52E-08, x1 = 2.8017, density = 1060,
-        delta0 = 0, state = 'liquid', k = 3.5406, a = 0.0849, Cbar = 3.4581,
-        elements = {K = 0.00163, O = 0.759414, S = 0.00185, H = 0.101866,
-        Fe = 0.00046, P = 0.00035, Si = 3E-05, Zn = 1E-05, Ca = 6E-05,
-        Na = 0.00185, Cl = 0.00278, Mg = 4E-05, C = 0.10002, N = 0.02964}
-    },
+    Blood =
+        '0.5498747 7.52E-08 1060 liquid 0.2239 2.8017 0.0849 3.5406 3.4581 0 \z
+        K 0.00163 O 0.759414 S 0.00185 H 0.101866 Fe 0.00046 P 0.00035 Si \z
+        3E-05 Zn 1E-05 Ca 6E-05 Na 0.00185 Cl 0.00278 Mg 4E-05 C 0.10002 N \z
+        0.02964',
 
     -- Bohrium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bohrium_Bh.html
-    Bohrium = {
-        ZoA = 0.3961012, x0 = 0.6345, I = 1.087E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2739, Cbar = 6.5475,
-        elements = {Bh = 1}
-    },
+    Bohrium =
+        '0.3961012 1.087E-06 14000 liquid 0.6345 3 0.2739 3 6.5475 0 Bh 1',
 
     -- Boron
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/boron_B.html
-    Boron = {
-        ZoA = 0.4622354, x0 = 0.0305, I = 7.6E-08, x1 = 1.9688, density = 2370,
-        delta0 = 0.14, state = 'liquid', k = 2.4512, a = 0.5622, Cbar = 2.8477,
-        elements = {B = 1}
-    },
+    Boron =
+        '0.4622354 7.6E-08 2370 liquid 0.0305 1.9688 0.5622 2.4512 2.8477 \z
+        0.14 B 1',
 
     -- Boron carbide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/boron_carbide.html
-    BoronCarbide = {
-        ZoA = 0.4703473, x0 = 0.0093, I = 8.47E-08, x1 = 2.1006, density = 2520,
-        delta0 = 0, state = 'liquid', k = 2.8076, a = 0.3709, Cbar = 2.9859,
-        elements = {B = 0.78261, C = 0.21739}
-    },
+    BoronCarbide =
+        '0.4703473 8.47E-08 2520 liquid 0.0093 2.1006 0.3709 2.8076 2.9859 0 \z
+        B 0.78261 C 0.21739',
 
     -- Boron oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/boron_oxide.html
-    BoronOxide = {
-        ZoA = 0.4882872, x0 = 0.1843, I = 9.96E-08, x1 = 2.7379, density = 1812,
-        delta0 = 0, state = 'liquid', k = 3.3832, a = 0.1155, Cbar = 3.6027,
-        elements = {B = 0.310551, O = 0.689449}
-    },
+    BoronOxide =
+        '0.4882872 9.96E-08 1812 liquid 0.1843 2.7379 0.1155 3.3832 3.6027 0 \z
+        B 0.310551 O 0.689449',
 
     -- Borosilicate glass Pyrex Corning 7740
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/borosilicate_glass_Pyrex_Corning_7740.html
-    BorosilicateGlass = {
-        ZoA = 0.4970599, x0 = 0.1479, I = 1.34E-07, x1 = 2.9933, density = 2230,
-        delta0 = 0, state = 'liquid', k = 3.5224, a = 0.0827, Cbar = 3.9708,
-        elements = {B = 0.040061, O = 0.539564, Na = 0.028191, Al = 0.011644,
-        K = 0.003321, Si = 0.37722}
-    },
+    BorosilicateGlass =
+        '0.4970599 1.34E-07 2230 liquid 0.1479 2.9933 0.0827 3.5224 3.9708 0 \z
+        B 0.040061 O 0.539564 Na 0.028191 Al 0.011644 K 0.003321 Si 0.37722',
 
     -- Brain ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/brain_ICRP.html
-    Brain = {
-        ZoA = 0.5541432, x0 = 0.2206, I = 7.33E-08, x1 = 2.8021, density = 1030,
-        delta0 = 0, state = 'liquid', k = 3.5585, a = 0.0825, Cbar = 3.4279,
-        elements = {K = 0.0031, O = 0.737723, S = 0.00177, H = 0.110667,
-        P = 0.00354, Fe = 5E-05, Zn = 1E-05, Ca = 9E-05, Na = 0.00184,
-        Cl = 0.00236, Mg = 0.00015, C = 0.12542, N = 0.01328}
-    },
+    Brain =
+        '0.5541432 7.33E-08 1030 liquid 0.2206 2.8021 0.0825 3.5585 3.4279 0 \z
+        K 0.0031 O 0.737723 S 0.00177 H 0.110667 P 0.00354 Fe 5E-05 Zn 1E-05 \z
+        Ca 9E-05 Na 0.00184 Cl 0.00236 Mg 0.00015 C 0.12542 N 0.01328',
 
     -- Bromine gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/bromine_gas.html
-    BromineGas = {
-        ZoA = 0.4380251, x0 = 1.5262, I = 3.43E-07, x1 = 4.9899,
-        density = 7.072, delta0 = 0, state = 'gas', k = 3.467, a = 0.0633,
-        Cbar = 11.7307, elements = {Br = 1}
-    },
+    BromineGas =
+        '0.4380251 3.43E-07 7.072 gas 1.5262 4.9899 0.0633 3.467 11.7307 0 Br \z
+        1',
 
     -- Butane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/butane.html
-    Butane = {
-        ZoA = 0.5848367, x0 = 1.3792, I = 4.83E-08, x1 = 3.7528,
-        density = 2.489, delta0 = 0, state = 'gas', k = 3.4884, a = 0.1085,
-        Cbar = 8.5651, elements = {C = 0.826592, H = 0.173408}
-    },
+    Butane =
+        '0.5848367 4.83E-08 2.489 gas 1.3792 3.7528 0.1085 3.4884 8.5651 0 C \z
+        0.826592 H 0.173408',
 
     -- C-552 air-equivalent plastic
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/C-552_air-equivalent_plastic.html
-    C552AirEquivalentPlastic = {
-        ZoA = 0.4996714, x0 = 0.151, I = 8.68E-08, x1 = 2.7083, density = 1760,
-        delta0 = 0, state = 'liquid', k = 3.4344, a = 0.1049, Cbar = 3.3338,
-        elements = {Si = 0.003973, F = 0.465209, H = 0.02468, C = 0.50161,
-        O = 0.004527}
-    },
+    C552AirEquivalentPlastic =
+        '0.4996714 8.68E-08 1760 liquid 0.151 2.7083 0.1049 3.4344 3.3338 0 \z
+        Si 0.003973 F 0.465209 H 0.02468 C 0.50161 O 0.004527',
 
     -- Cadmium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cadmium_Cd.html
-    Cadmium = {
-        ZoA = 0.4269931, x0 = 0.1281, I = 4.69E-07, x1 = 3.1667, density = 8650,
-        delta0 = 0.14, state = 'liquid', k = 2.6772, a = 0.2461, Cbar = 5.2727,
-        elements = {Cd = 1}
-    },
+    Cadmium =
+        '0.4269931 4.69E-07 8650 liquid 0.1281 3.1667 0.2461 2.6772 5.2727 \z
+        0.14 Cd 1',
 
     -- Cadmium telluride CdTe
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cadmium_telluride_CdTe.html
-    CadmiumTelluride = {
-        ZoA = 0.4166371, x0 = 0.0438, I = 5.393E-07, x1 = 3.2836,
-        density = 6200, delta0 = 0, state = 'liquid', k = 2.6665, a = 0.2484,
-        Cbar = 5.9096, elements = {Te = 0.531645, Cd = 0.468355}
-    },
+    CadmiumTelluride =
+        '0.4166371 5.393E-07 6200 liquid 0.0438 3.2836 0.2484 2.6665 5.9096 0 \z
+        Te 0.531645 Cd 0.468355',
 
     -- Cadmium tungstate
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cadmium_tungstate.html
-    CadmiumTungstate = {
-        ZoA = 0.4274778, x0 = 0.0123, I = 4.683E-07, x1 = 3.5941,
-        density = 7900, delta0 = 0, state = 'liquid', k = 2.915, a = 0.1286,
-        Cbar = 5.3594, elements = {Cd = 0.312027, O = 0.177644, W = 0.510329}
-    },
+    CadmiumTungstate =
+        '0.4274778 4.683E-07 7900 liquid 0.0123 3.5941 0.1286 2.915 5.3594 0 \z
+        Cd 0.312027 O 0.177644 W 0.510329',
 
     -- Caesium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/caesium_Cs.html
-    Caesium = {
-        ZoA = 0.4138294, x0 = 0.5473, I = 4.88E-07, x1 = 3.5914, density = 1873,
-        delta0 = 0.14, state = 'liquid', k = 2.8866, a = 0.1823, Cbar = 6.9135,
-        elements = {Cs = 1}
-    },
+    Caesium =
+        '0.4138294 4.88E-07 1873 liquid 0.5473 3.5914 0.1823 2.8866 6.9135 \z
+        0.14 Cs 1',
 
     -- Calcium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_Ca.html
-    Calcium = {
-        ZoA = 0.4990219, x0 = 0.3228, I = 1.91E-07, x1 = 3.1191, density = 1550,
-        delta0 = 0.14, state = 'liquid', k = 3.0745, a = 0.1564, Cbar = 5.0396,
-        elements = {Ca = 1}
-    },
+    Calcium =
+        '0.4990219 1.91E-07 1550 liquid 0.3228 3.1191 0.1564 3.0745 5.0396 \z
+        0.14 Ca 1',
 
     -- Calcium carbonate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_carbonate.html
-    CalciumCarbonate = {
-        ZoA = 0.4995649, x0 = 0.0492, I = 1.364E-07, x1 = 3.0549,
-        density = 2800, delta0 = 0, state = 'liquid', k = 3.412, a = 0.083,
-        Cbar = 3.7738, elements = {O = 0.479554, C = 0.120003, Ca = 0.400443}
-    },
+    CalciumCarbonate =
+        '0.4995649 1.364E-07 2800 liquid 0.0492 3.0549 0.083 3.412 3.7738 0 O \z
+        0.479554 C 0.120003 Ca 0.400443',
 
     -- Calcium fluoride
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_fluoride.html
-    CalciumFluoride = {
-        ZoA = 0.4867105, x0 = 0.0676, I = 1.66E-07, x1 = 3.1683, density = 3180,
-        delta0 = 0, state = 'liquid', k = 3.5263, a = 0.0694, Cbar = 4.0653,
-        elements = {Ca = 0.513341, F = 0.486659}
-    },
+    CalciumFluoride =
+        '0.4867105 1.66E-07 3180 liquid 0.0676 3.1683 0.0694 3.5263 4.0653 0 \z
+        Ca 0.513341 F 0.486659',
 
     -- Calcium oxide CaO
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_oxide_CaO.html
-    CalciumOxide = {
-        ZoA = 0.4993072, x0 = 0.0172, I = 1.761E-07, x1 = 3.0171,
-        density = 3300, delta0 = 0, state = 'liquid', k = 3.1936, a = 0.1213,
-        Cbar = 4.1209, elements = {Ca = 0.714701, O = 0.285299}
-    },
+    CalciumOxide =
+        '0.4993072 1.761E-07 3300 liquid 0.0172 3.0171 0.1213 3.1936 4.1209 0 \z
+        Ca 0.714701 O 0.285299',
 
     -- Calcium sulfate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_sulfate.html
-    CalciumSulfate = {
-        ZoA = 0.4994818, x0 = 0.0587, I = 1.523E-07, x1 = 3.1229,
-        density = 2960, delta0 = 0, state = 'liquid', k = 3.4495, a = 0.0771,
-        Cbar = 3.9388, elements = {O = 0.470095, S = 0.235497, Ca = 0.294408}
-    },
+    CalciumSulfate =
+        '0.4994818 1.523E-07 2960 liquid 0.0587 3.1229 0.0771 3.4495 3.9388 0 \z
+        O 0.470095 S 0.235497 Ca 0.294408',
 
     -- Calcium tungstate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/calcium_tungstate.html
-    CalciumTungstate = {
-        ZoA = 0.4376265, x0 = 0.0323, I = 3.95E-07, x1 = 3.8932, density = 6062,
-        delta0 = 0, state = 'liquid', k = 3.2649, a = 0.0621, Cbar = 5.2603,
-        elements = {O = 0.22227, Ca = 0.139202, W = 0.638529}
-    },
+    CalciumTungstate =
+        '0.4376265 3.95E-07 6062 liquid 0.0323 3.8932 0.0621 3.2649 5.2603 0 \z
+        O 0.22227 Ca 0.139202 W 0.638529',
 
     -- Californium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/californium_Cf.html
-    Californium = {
-        ZoA = 0.3903138, x0 = 0.0623, I = 9.66E-07, x1 = 2.5, density = 15100,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.258, Cbar = 4.0236,
-        elements = {Cf = 1}
-    },
+    Californium =
+        '0.3903138 9.66E-07 15100 liquid 0.0623 2.5 0.258 3 4.0236 0 Cf 1',
 
     -- Carbon amorphous
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_amorphous_C.html
-    CarbonAmorphous = {
-        ZoA = 0.4995504, x0 = 0.0351, I = 7.8E-08, x1 = 2.486, density = 2000,
-        delta0 = 0.1, state = 'liquid', k = 3.0036, a = 0.2024, Cbar = 2.9925,
-        elements = {C = 1}
-    },
+    CarbonAmorphous =
+        '0.4995504 7.8E-08 2000 liquid 0.0351 2.486 0.2024 3.0036 2.9925 0.1 \z
+        C 1',
 
     -- Carbon compact
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_compact_C.html
-    CarbonCompact = {
-        ZoA = 0.4995504, x0 = 0.0178, I = 7.8E-08, x1 = 2.3415, density = 2265,
-        delta0 = 0.12, state = 'liquid', k = 2.8697, a = 0.2614, Cbar = 2.868,
-        elements = {C = 1}
-    },
+    CarbonCompact =
+        '0.4995504 7.8E-08 2265 liquid 0.0178 2.3415 0.2614 2.8697 2.868 0.12 \z
+        C 1',
 
     -- Carbon gem diamond
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_gem_diamond.html
-    CarbonDiamond = {
-        ZoA = 0.4995504, x0 = 0.1135, I = 7.8E-08, x1 = 2.2458, density = 3520,
-        delta0 = 0.12, state = 'liquid', k = 2.8697, a = 0.2614, Cbar = 2.4271,
-        elements = {C = 1}
-    },
+    CarbonDiamond =
+        '0.4995504 7.8E-08 3520 liquid 0.1135 2.2458 0.2614 2.8697 2.4271 \z
+        0.12 C 1',
 
     -- Carbon dioxide gas
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_dioxide_gas.html
-    CarbonDioxideGas = {
-        ZoA = 0.4998932, x0 = 1.6294, I = 8.5E-08, x1 = 4.1825, density = 1.842,
-        delta0 = 0, state = 'gas', k = 3.3227, a = 0.1177, Cbar = 10.1537,
-        elements = {C = 0.272916, O = 0.727084}
-    },
+    CarbonDioxideGas =
+        '0.4998932 8.5E-08 1.842 gas 1.6294 4.1825 0.1177 3.3227 10.1537 0 C \z
+        0.272916 O 0.727084',
 
     -- Solid carbon dioxide dry ice
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/solid_carbon_dioxide_dry_ice.html
-    CarbonDioxideIce = {
-        ZoA = 0.4998932, x0 = 0.2, I = 8.5E-08, x1 = 2, density = 1563,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.4339, Cbar = 3.4513,
-        elements = {C = 0.272916, O = 0.727084}
-    },
+    CarbonDioxideIce =
+        '0.4998932 8.5E-08 1563 liquid 0.2 2 0.4339 3 3.4513 0 C 0.272916 O \z
+        0.727084',
 
     -- Carbon graphite
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_graphite_C.html
-    CarbonGraphite = {
-        ZoA = 0.4995504, x0 = 0.009, I = 7.8E-08, x1 = 2.4817, density = 2210,
-        delta0 = 0.14, state = 'liquid', k = 2.9532, a = 0.2076, Cbar = 2.8926,
-        elements = {C = 1}
-    },
+    CarbonGraphite =
+        '0.4995504 7.8E-08 2210 liquid 0.009 2.4817 0.2076 2.9532 2.8926 0.14 \z
+        C 1',
 
     -- Carbon tetrachloride
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_tetrachloride.html
-    CarbonTetrachloride = {
-        ZoA = 0.4810706, x0 = 0.1773, I = 1.663E-07, x1 = 2.9165,
-        density = 1594, delta0 = 0, state = 'liquid', k = 3.0116, a = 0.1902,
-        Cbar = 4.7712, elements = {C = 0.078083, Cl = 0.921917}
-    },
+    CarbonTetrachloride =
+        '0.4810706 1.663E-07 1594 liquid 0.1773 2.9165 0.1902 3.0116 4.7712 0 \z
+        C 0.078083 Cl 0.921917',
 
     -- Carbon tetrafluoride
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/carbon_tetrafluoride.html
-    CarbonTetrafluoride = {
-        ZoA = 0.4772497, x0 = 1.7, I = 1.15E-07, x1 = 4, density = 3.78,
-        delta0 = 0, state = 'gas', k = 3, a = 0.1855, Cbar = 10.0858,
-        elements = {C = 0.136548, F = 0.86345}
-    },
+    CarbonTetrafluoride =
+        '0.4772497 1.15E-07 3.78 gas 1.7 4 0.1855 3 10.0858 0 C 0.136548 F \z
+        0.86345',
 
     -- Cellulose
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cellulose.html
-    Cellulose = {
-        ZoA = 0.5303558, x0 = 0.158, I = 7.76E-08, x1 = 2.6778, density = 1420,
-        delta0 = 0, state = 'liquid', k = 3.381, a = 0.1115, Cbar = 3.2647,
-        elements = {H = 0.062162, C = 0.444462, O = 0.493376}
-    },
+    Cellulose =
+        '0.5303558 7.76E-08 1420 liquid 0.158 2.6778 0.1115 3.381 3.2647 0 H \z
+        0.062162 C 0.444462 O 0.493376',
 
     -- Cellulose acetate butyrate
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cellulose_acetate_butyrate.html
-    CelluloseAcetateButyrate = {
-        ZoA = 0.5327468, x0 = 0.1794, I = 7.46E-08, x1 = 2.6809, density = 1200,
-        delta0 = 0, state = 'liquid', k = 3.3738, a = 0.1144, Cbar = 3.3497,
-        elements = {H = 0.067125, C = 0.545403, O = 0.387472}
-    },
+    CelluloseAcetateButyrate =
+        '0.5327468 7.46E-08 1200 liquid 0.1794 2.6809 0.1144 3.3738 3.3497 0 \z
+        H 0.067125 C 0.545403 O 0.387472',
 
     -- Cellulose nitrate
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cellulose_nitrate.html
-    CelluloseNitrate = {
-        ZoA = 0.5142155, x0 = 0.1897, I = 8.7E-08, x1 = 2.7253, density = 1490,
-        delta0 = 0, state = 'liquid', k = 3.3237, a = 0.1181, Cbar = 3.4762,
-        elements = {O = 0.578212, H = 0.029216, C = 0.271296, N = 0.121276}
-    },
+    CelluloseNitrate =
+        '0.5142155 8.7E-08 1490 liquid 0.1897 2.7253 0.1181 3.3237 3.4762 0 O \z
+        0.578212 H 0.029216 C 0.271296 N 0.121276',
 
     -- Ceric sulfate dosimeter solution
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ceric_sulfate_dosimeter_solution.html
-    CericSulfateDosimeterSolution = {
-        ZoA = 0.5527018, x0 = 0.2363, I = 7.67E-08, x1 = 2.8769, density = 1030,
-        delta0 = 0, state = 'liquid', k = 3.5607, a = 0.0767, Cbar = 3.5212,
-        elements = {O = 0.874976, S = 0.014627, N = 0.0008, H = 0.107596,
-        Ce = 0.002001}
-    },
+    CericSulfateDosimeterSolution =
+        '0.5527018 7.67E-08 1030 liquid 0.2363 2.8769 0.0767 3.5607 3.5212 0 \z
+        O 0.874976 S 0.014627 N 0.0008 H 0.107596 Ce 0.002001',
 
     -- Cerium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cerium_Ce.html
-    Cerium = {
-        ZoA = 0.4139427, x0 = 0.2676, I = 5.23E-07, x1 = 3.3395, density = 6770,
-        delta0 = 0.14, state = 'liquid', k = 2.8592, a = 0.1889, Cbar = 5.7669,
-        elements = {Ce = 1}
-    },
+    Cerium =
+        '0.4139427 5.23E-07 6770 liquid 0.2676 3.3395 0.1889 2.8592 5.7669 \z
+        0.14 Ce 1',
 
     -- Cerium fluoride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cerium_fluoride.html
-    CeriumFluoride = {
-        ZoA = 0.4312287, x0 = 0.2, I = 3.484E-07, x1 = 3, density = 6160,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1862, Cbar = 5.0079,
-        elements = {F = 0.289153, Ce = 0.710847}
-    },
+    CeriumFluoride =
+        '0.4312287 3.484E-07 6160 liquid 0.2 3 0.1862 3 5.0079 0 F 0.289153 \z
+        Ce 0.710847',
 
     -- Cesium fluoride CsF
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cesium_fluoride_CsF.html
-    CesiumFluoride = {
-        ZoA = 0.4213204, x0 = 0.0084, I = 4.407E-07, x1 = 3.3374,
-        density = 4115, delta0 = 0, state = 'liquid', k = 2.728, a = 0.2205,
-        Cbar = 5.9046, elements = {Cs = 0.874931, F = 0.125069}
-    },
+    CesiumFluoride =
+        '0.4213204 4.407E-07 4115 liquid 0.0084 3.3374 0.2205 2.728 5.9046 0 \z
+        Cs 0.874931 F 0.125069',
 
     -- Cesium iodide CsI
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cesium_iodide_CsI.html
-    CesiumIodide = {
-        ZoA = 0.41569, x0 = 0.0395, I = 5.531E-07, x1 = 3.3353, density = 4510,
-        delta0 = 0, state = 'liquid', k = 2.6657, a = 0.2538, Cbar = 6.2807,
-        elements = {I = 0.488451, Cs = 0.511549}
-    },
+    CesiumIodide =
+        '0.41569 5.531E-07 4510 liquid 0.0395 3.3353 0.2538 2.6657 6.2807 0 I \z
+        0.488451 Cs 0.511549',
 
     -- Chlorine gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chlorine_gas.html
-    ChlorineGas = {
-        ZoA = 0.4795054, x0 = 1.5566, I = 1.74E-07, x1 = 4.3005, density = 2.98,
-        delta0 = 0, state = 'gas', k = 2.9702, a = 0.1985, Cbar = 11.147,
-        elements = {Cl = 1}
-    },
+    ChlorineGas =
+        '0.4795054 1.74E-07 2.98 gas 1.5566 4.3005 0.1985 2.9702 11.147 0 Cl \z
+        1',
 
     -- Chlorobenzene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chlorobenzene.html
-    Chlorobenzene = {
-        ZoA = 0.5152567, x0 = 0.1714, I = 8.91E-08, x1 = 2.9272, density = 1106,
-        delta0 = 0, state = 'liquid', k = 3.3797, a = 0.0986, Cbar = 3.8201,
-        elements = {H = 0.044772, C = 0.640254, Cl = 0.314974}
-    },
+    Chlorobenzene =
+        '0.5152567 8.91E-08 1106 liquid 0.1714 2.9272 0.0986 3.3797 3.8201 0 \z
+        H 0.044772 C 0.640254 Cl 0.314974',
 
     -- Chloroform
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chloroform.html
-    Chloroform = {
-        ZoA = 0.4858439, x0 = 0.1786, I = 1.56E-07, x1 = 2.9581, density = 1483,
-        delta0 = 0, state = 'liquid', k = 3.0627, a = 0.1696, Cbar = 4.7055,
-        elements = {H = 0.008443, C = 0.100613, Cl = 0.890944}
-    },
+    Chloroform =
+        '0.4858439 1.56E-07 1483 liquid 0.1786 2.9581 0.1696 3.0627 4.7055 0 \z
+        H 0.008443 C 0.100613 Cl 0.890944',
 
     -- Chromium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/chromium_Cr.html
-    Chromium = {
-        ZoA = 0.4615722, x0 = 0.034, I = 2.57E-07, x1 = 3.0451, density = 7180,
-        delta0 = 0.14, state = 'liquid', k = 2.9896, a = 0.1542, Cbar = 4.1781,
-        elements = {Cr = 1}
-    },
+    Chromium =
+        '0.4615722 2.57E-07 7180 liquid 0.034 3.0451 0.1542 2.9896 4.1781 \z
+        0.14 Cr 1',
 
     -- Cobalt
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cobalt_Co.html
-    Cobalt = {
-        ZoA = 0.4581458, x0 = 0.0187, I = 2.97E-07, x1 = 3.179, density = 8900,
-        delta0 = 0.12, state = 'liquid', k = 2.9502, a = 0.1447, Cbar = 4.2601,
-        elements = {Co = 1}
-    },
+    Cobalt =
+        '0.4581458 2.97E-07 8900 liquid 0.0187 3.179 0.1447 2.9502 4.2601 \z
+        0.12 Co 1',
 
     -- Compact bone ICRU
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/compact_bone_ICRU.html
-    CompactBone = {
-        ZoA = 0.5300584, x0 = 0.0944, I = 9.19E-08, x1 = 3.0201, density = 1850,
-        delta0 = 0, state = 'liquid', k = 3.6419, a = 0.0582, Cbar = 3.339,
-        elements = {Ca = 0.147, O = 0.410016, S = 0.002, N = 0.027, Mg = 0.002,
-        H = 0.063984, C = 0.278, P = 0.07}
-    },
+    CompactBone =
+        '0.5300584 9.19E-08 1850 liquid 0.0944 3.0201 0.0582 3.6419 3.339 0 \z
+        Ca 0.147 O 0.410016 S 0.002 N 0.027 Mg 0.002 H 0.063984 C 0.278 P \z
+        0.07',
 
     -- Copernicium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/copernicium_Cn.html
-    Copernicium = {
-        ZoA = 0.3927385, x0 = 0.6774, I = 1.156E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2841, Cbar = 6.6791,
-        elements = {Cn = 1}
-    },
+    Copernicium =
+        '0.3927385 1.156E-06 14000 liquid 0.6774 3 0.2841 3 6.6791 0 Cn 1',
 
     -- Copper
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/copper_Cu.html
-    Copper = {
-        ZoA = 0.4563602, x0 = 0.0254, I = 3.22E-07, x1 = 3.2792, density = 8960,
-        delta0 = 0.08, state = 'liquid', k = 2.9044, a = 0.1434, Cbar = 4.419,
-        elements = {Cu = 1}
-    },
+    Copper =
+        '0.4563602 3.22E-07 8960 liquid 0.0254 3.2792 0.1434 2.9044 4.419 \z
+        0.08 Cu 1',
 
     -- Cortical bone ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cortical_bone_ICRP.html
-    CorticalBone = {
-        ZoA = 0.5212671, x0 = 0.1161, I = 1.064E-07, x1 = 3.0919,
-        density = 1850, delta0 = 0, state = 'liquid', k = 3.5919, a = 0.062,
-        Cbar = 3.6488, elements = {O = 0.446096, S = 0.00315, H = 0.047234,
-        P = 0.10497, Zn = 0.0001, N = 0.04199, C = 0.14433, Ca = 0.20993,
-        Mg = 0.0022}
-    },
+    CorticalBone =
+        '0.5212671 1.064E-07 1850 liquid 0.1161 3.0919 0.062 3.5919 3.6488 0 \z
+        O 0.446096 S 0.00315 H 0.047234 P 0.10497 Zn 0.0001 N 0.04199 C \z
+        0.14433 Ca 0.20993 Mg 0.0022',
 
     -- Curium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/curium_Cm.html
-    Curium = {
-        ZoA = 0.3885539, x0 = 0.2484, I = 9.39E-07, x1 = 3.516, density = 13510,
-        delta0 = 0.14, state = 'liquid', k = 2.7579, a = 0.2026, Cbar = 6.3097,
-        elements = {Cm = 1}
-    },
+    Curium =
+        '0.3885539 9.39E-07 13510 liquid 0.2484 3.516 0.2026 2.7579 6.3097 \z
+        0.14 Cm 1',
 
     -- Cyclohexane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/cyclohexane.html
-    Cyclohexane = {
-        ZoA = 0.570231, x0 = 0.1728, I = 5.64E-08, x1 = 2.5549, density = 779,
-        delta0 = 0, state = 'liquid', k = 3.4278, a = 0.1204, Cbar = 3.1544,
-        elements = {C = 0.856289, H = 0.143711}
-    },
+    Cyclohexane =
+        '0.570231 5.64E-08 779 liquid 0.1728 2.5549 0.1204 3.4278 3.1544 0 C \z
+        0.856289 H 0.143711',
 
     -- Darmstadtium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/darmstadtium_Ds.html
-    Darmstadtium = {
-        ZoA = 0.3912293, x0 = 0.6632, I = 1.129E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2807, Cbar = 6.6357,
-        elements = {Ds = 1}
-    },
+    Darmstadtium =
+        '0.3912293 1.129E-06 14000 liquid 0.6632 3 0.2807 3 6.6357 0 Ds 1',
 
     -- Deuterium gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/deuterium_gas.html
-    DeuteriumGas = {
-        ZoA = 0.4964997, x0 = 1.8793, I = 1.92E-08, x1 = 3.2872,
-        density = 0.1677, delta0 = 0, state = 'gas', k = 5.7273, a = 0.1409,
-        Cbar = 9.6543, elements = {D = 1}
-    },
+    DeuteriumGas =
+        '0.4964997 1.92E-08 0.1677 gas 1.8793 3.2872 0.1409 5.7273 9.6543 0 D \z
+        1',
 
     -- Deuterium oxide liquid
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/deuterium_oxide_liquid.html
-    DeuteriumOxideLiquid = {
-        ZoA = 0.4993134, x0 = 0.24, I = 7.97E-08, x1 = 2.8004, density = 1107,
-        delta0 = 0, state = 'liquid', k = 3.4773, a = 0.0912, Cbar = 3.5017,
-        elements = {D = 0.201133, O = 0.798867}
-    },
+    DeuteriumOxideLiquid =
+        '0.4993134 7.97E-08 1107 liquid 0.24 2.8004 0.0912 3.4773 3.5017 0 D \z
+        0.201133 O 0.798867',
 
     -- 12-dichlorobenzene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/12-dichlorobenzene.html
-    Dichlorobenzene = {
-        ZoA = 0.5033701, x0 = 0.1587, I = 1.065E-07, x1 = 2.8276,
-        density = 1305, delta0 = 0, state = 'liquid', k = 3.0836, a = 0.1601,
-        Cbar = 4.0348, elements = {H = 0.027425, C = 0.490233, Cl = 0.482342}
-    },
+    Dichlorobenzene =
+        '0.5033701 1.065E-07 1305 liquid 0.1587 2.8276 0.1601 3.0836 4.0348 0 \z
+        H 0.027425 C 0.490233 Cl 0.482342',
 
     -- Dichlorodiethyl ether
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dichlorodiethyl_ether.html
-    DichlorodiethylEther = {
-        ZoA = 0.5173938, x0 = 0.1773, I = 1.033E-07, x1 = 3.1586,
-        density = 1220, delta0 = 0, state = 'liquid', k = 3.525, a = 0.068,
-        Cbar = 4.0135, elements = {O = 0.111874, H = 0.056381, C = 0.335942,
-        Cl = 0.495802}
-    },
+    DichlorodiethylEther =
+        '0.5173938 1.033E-07 1220 liquid 0.1773 3.1586 0.068 3.525 4.0135 0 O \z
+        0.111874 H 0.056381 C 0.335942 Cl 0.495802',
 
     -- 12-dichloroethane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/12-dichloroethane.html
-    Dichloroethane = {
-        ZoA = 0.5052253, x0 = 0.1375, I = 1.119E-07, x1 = 2.9529,
-        density = 1235, delta0 = 0, state = 'liquid', k = 3.1675, a = 0.1338,
-        Cbar = 4.1849, elements = {H = 0.04074, C = 0.242746, Cl = 0.716515}
-    },
+    Dichloroethane =
+        '0.5052253 1.119E-07 1235 liquid 0.1375 2.9529 0.1338 3.1675 4.1849 0 \z
+        H 0.04074 C 0.242746 Cl 0.716515',
 
     -- Diethyl ether
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/diethyl_ether.html
-    DiethylEther = {
-        ZoA = 0.5665295, x0 = 0.2231, I = 6E-08, x1 = 2.6745, density = 713.8,
-        delta0 = 0, state = 'liquid', k = 3.4586, a = 0.1055, Cbar = 3.3721,
-        elements = {H = 0.135978, C = 0.648171, O = 0.215851}
-    },
+    DiethylEther =
+        '0.5665295 6E-08 713.8 liquid 0.2231 2.6745 0.1055 3.4586 3.3721 0 H \z
+        0.135978 C 0.648171 O 0.215851',
 
     -- Dimethyl sulfoxide
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dimethyl_sulfoxide.html
-    DimethylSulfoxide = {
-        ZoA = 0.537481, x0 = 0.2021, I = 9.86E-08, x1 = 3.1263, density = 1101,
-        delta0 = 0, state = 'liquid', k = 3.5708, a = 0.0662, Cbar = 3.9844,
-        elements = {S = 0.410348, H = 0.077403, C = 0.307467, O = 0.204782}
-    },
+    DimethylSulfoxide =
+        '0.537481 9.86E-08 1101 liquid 0.2021 3.1263 0.0662 3.5708 3.9844 0 S \z
+        0.410348 H 0.077403 C 0.307467 O 0.204782',
 
     -- Dubnium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dubnium_Db.html
-    Dubnium = {
-        ZoA = 0.3916069, x0 = 0.6224, I = 1.061E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2711, Cbar = 6.5105,
-        elements = {Db = 1}
-    },
+    Dubnium =
+        '0.3916069 1.061E-06 14000 liquid 0.6224 3 0.2711 3 6.5105 0 Db 1',
 
     -- Dysprosium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/dysprosium_Dy.html
-    Dysprosium = {
-        ZoA = 0.4061538, x0 = 0.0822, I = 6.28E-07, x1 = 3.4474, density = 8551,
-        delta0 = 0.14, state = 'liquid', k = 2.5849, a = 0.2466, Cbar = 5.9182,
-        elements = {Dy = 1}
-    },
+    Dysprosium =
+        '0.4061538 6.28E-07 8551 liquid 0.0822 3.4474 0.2466 2.5849 5.9182 \z
+        0.14 Dy 1',
 
     -- E-Glass
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/E-Glass.html
-    EGlass = {
-        ZoA = 0.4968594, x0 = 0.2, I = 1.434E-07, x1 = 3, density = 2610,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.138, Cbar = 3.9495,
-        elements = {B = 0.031058, O = 0.488551, Mg = 0.018094, Al = 0.074093,
-        Ca = 0.135793, Si = 0.252411}
-    },
+    EGlass =
+        '0.4968594 1.434E-07 2610 liquid 0.2 3 0.138 3 3.9495 0 B 0.031058 O \z
+        0.488551 Mg 0.018094 Al 0.074093 Ca 0.135793 Si 0.252411',
 
     -- Einsteinium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/einsteinium_Es.html
-    Einsteinium = {
-        ZoA = 0.3927278, x0 = 0.5697, I = 9.8E-07, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2595, Cbar = 6.3488,
-        elements = {Es = 1}
-    },
+    Einsteinium =
+        '0.3927278 9.8E-07 14000 liquid 0.5697 3 0.2595 3 6.3488 0 Es 1',
 
     -- Epotek-301-1
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Epotek-301-1.html
-    EpoTek301 = {
-        ZoA = 0.5340374, x0 = 0.2, I = 7.67E-08, x1 = 2, density = 1190,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.427, Cbar = 3.4112,
-        elements = {O = 0.231531, H = 0.069894, C = 0.68964, N = 0.008936}
-    },
+    EpoTek301 =
+        '0.5340374 7.67E-08 1190 liquid 0.2 2 0.427 3 3.4112 0 O 0.231531 H \z
+        0.069894 C 0.68964 N 0.008936',
 
     -- Erbium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/erbium_Er.html
-    Erbium = {
-        ZoA = 0.4065551, x0 = 0.0658, I = 6.58E-07, x1 = 3.4932, density = 9026,
-        delta0 = 0.14, state = 'liquid', k = 2.5573, a = 0.2482, Cbar = 5.9565,
-        elements = {Er = 1}
-    },
+    Erbium =
+        '0.4065551 6.58E-07 9026 liquid 0.0658 3.4932 0.2482 2.5573 5.9565 \z
+        0.14 Er 1',
 
     -- Ethane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ethane.html
-    Ethane = {
-        ZoA = 0.5984637, x0 = 1.509, I = 4.54E-08, x1 = 3.8726, density = 1.263,
-        delta0 = 0, state = 'gas', k = 3.6095, a = 0.0963, Cbar = 9.0965,
-        elements = {C = 0.798885, H = 0.201115}
-    },
+    Ethane =
+        '0.5984637 4.54E-08 1.263 gas 1.509 3.8726 0.0963 3.6095 9.0965 0 C \z
+        0.798885 H 0.201115',
 
     -- Ethanol
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ethanol.html
-    Ethanol = {
-        ZoA = 0.564276, x0 = 0.2218, I = 6.29E-08, x1 = 2.7052, density = 789.3,
-        delta0 = 0, state = 'liquid', k = 3.4834, a = 0.0988, Cbar = 3.3699,
-        elements = {H = 0.131269, C = 0.521438, O = 0.347294}
-    },
+    Ethanol =
+        '0.564276 6.29E-08 789.3 liquid 0.2218 2.7052 0.0988 3.4834 3.3699 0 \z
+        H 0.131269 C 0.521438 O 0.347294',
 
     -- Ethyl cellulose
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ethyl_cellulose.html
-    EthylCellulose = {
-        ZoA = 0.543981, x0 = 0.1683, I = 6.93E-08, x1 = 2.6527, density = 1130,
-        delta0 = 0, state = 'liquid', k = 3.4098, a = 0.1108, Cbar = 3.2415,
-        elements = {H = 0.090027, C = 0.585182, O = 0.324791}
-    },
+    EthylCellulose =
+        '0.543981 6.93E-08 1130 liquid 0.1683 2.6527 0.1108 3.4098 3.2415 0 H \z
+        0.090027 C 0.585182 O 0.324791',
 
     -- Ethylene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ethylene.html
-    Ethylene = {
-        ZoA = 0.570231, x0 = 1.5528, I = 5.07E-08, x1 = 3.9327, density = 1.175,
-        delta0 = 0, state = 'gas', k = 3.5387, a = 0.1064, Cbar = 9.438,
-        elements = {C = 0.856289, H = 0.143711}
-    },
+    Ethylene =
+        '0.570231 5.07E-08 1.175 gas 1.5528 3.9327 0.1064 3.5387 9.438 0 C \z
+        0.856289 H 0.143711',
 
     -- Europium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/europium_Eu.html
-    Europium = {
-        ZoA = 0.4145719, x0 = 0.1888, I = 5.8E-07, x1 = 3.4633, density = 5244,
-        delta0 = 0.14, state = 'liquid', k = 2.6245, a = 0.2445, Cbar = 6.2276,
-        elements = {Eu = 1}
-    },
+    Europium =
+        '0.4145719 5.8E-07 5244 liquid 0.1888 3.4633 0.2445 2.6245 6.2276 \z
+        0.14 Eu 1',
 
     -- Eye lens ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/eye_lens_ICRP.html
-    EyeLens = {
-        ZoA = 0.5486918, x0 = 0.207, I = 7.33E-08, x1 = 2.7446, density = 1100,
-        delta0 = 0, state = 'liquid', k = 3.455, a = 0.0969, Cbar = 3.372,
-        elements = {O = 0.653751, H = 0.099269, C = 0.19371, N = 0.05327}
-    },
+    EyeLens =
+        '0.5486918 7.33E-08 1100 liquid 0.207 2.7446 0.0969 3.455 3.372 0 O \z
+        0.653751 H 0.099269 C 0.19371 N 0.05327',
 
     -- Fermium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/fermium_Fm.html
-    Fermium = {
-        ZoA = 0.3889613, x0 = 0.5821, I = 9.94E-07, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2622, Cbar = 6.3868,
-        elements = {Fm = 1}
-    },
+    Fermium =
+        '0.3889613 9.94E-07 14000 liquid 0.5821 3 0.2622 3 6.3868 0 Fm 1',
 
     -- Ferric oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ferric_oxide.html
-    FerricOxide = {
-        ZoA = 0.475927, x0 = 0.0074, I = 2.273E-07, x1 = 3.2573, density = 5200,
-        delta0 = 0, state = 'liquid', k = 3.1313, a = 0.1048, Cbar = 4.2245,
-        elements = {Fe = 0.699433, O = 0.300567}
-    },
+    FerricOxide =
+        '0.475927 2.273E-07 5200 liquid 0.0074 3.2573 0.1048 3.1313 4.2245 0 \z
+        Fe 0.699433 O 0.300567',
 
     -- Ferroboride FeB
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ferroboride_FeB.html
-    Ferroboride = {
-        ZoA = 0.4650315, x0 = 0.0988, I = 2.61E-07, x1 = 3.1749, density = 7150,
-        delta0 = 0, state = 'liquid', k = 3.024, a = 0.1291, Cbar = 4.2057,
-        elements = {B = 0.162174, Fe = 0.837826}
-    },
+    Ferroboride =
+        '0.4650315 2.61E-07 7150 liquid 0.0988 3.1749 0.1291 3.024 4.2057 0 B \z
+        0.162174 Fe 0.837826',
 
     -- Ferrous oxide FeO
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ferrous_oxide_FeO.html
-    FerrousOxide = {
-        ZoA = 0.4732441, x0 = 0.0279, I = 2.486E-07, x1 = 3.2002,
-        density = 5700, delta0 = 0, state = 'liquid', k = 3.0168, a = 0.1296,
-        Cbar = 4.3175, elements = {Fe = 0.777311, O = 0.222689}
-    },
+    FerrousOxide =
+        '0.4732441 2.486E-07 5700 liquid 0.0279 3.2002 0.1296 3.0168 4.3175 0 \z
+        Fe 0.777311 O 0.222689',
 
     -- Ferrous sulfate dosimeter solution
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ferrous_sulfate_dosimeter_solution.html
-    FerrousSulfateDosimeterSolution = {
-        ZoA = 0.5531987, x0 = 0.2378, I = 7.64E-08, x1 = 2.8254, density = 1024,
-        delta0 = 0, state = 'liquid', k = 3.4923, a = 0.0876, Cbar = 3.5183,
-        elements = {Fe = 5.4E-05, O = 0.878636, S = 0.012968, Na = 2.2E-05,
-        H = 0.108259, N = 2.7E-05, Cl = 3.4E-05}
-    },
+    FerrousSulfateDosimeterSolution =
+        '0.5531987 7.64E-08 1024 liquid 0.2378 2.8254 0.0876 3.4923 3.5183 0 \z
+        Fe 5.4E-05 O 0.878636 S 0.012968 Na 2.2E-05 H 0.108259 N 2.7E-05 Cl \z
+        3.4E-05',
 
     -- Flerovium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/flerovium_Fl.html
-    Flerovium = {
-        ZoA = 0.3942045, x0 = 0.6923, I = 1.185E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2878, Cbar = 6.7249,
-        elements = {Fl = 1}
-    },
+    Flerovium =
+        '0.3942045 1.185E-06 14000 liquid 0.6923 3 0.2878 3 6.7249 0 Fl 1',
 
     -- Fluorine gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/fluorine_gas.html
-    FluorineGas = {
-        ZoA = 0.4737241, x0 = 1.8433, I = 1.15E-07, x1 = 4.4096, density = 1.58,
-        delta0 = 0, state = 'gas', k = 3.2962, a = 0.1108, Cbar = 10.9653,
-        elements = {F = 1}
-    },
+    FluorineGas =
+        '0.4737241 1.15E-07 1.58 gas 1.8433 4.4096 0.1108 3.2962 10.9653 0 F \z
+        1',
 
     -- Francium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/francium_Fr.html
-    Francium = {
-        ZoA = 0.3900995, x0 = 1.1175, I = 8.27E-07, x1 = 3, density = 1870,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.4321, Cbar = 8.0292,
-        elements = {Fr = 1}
-    },
+    Francium =
+        '0.3900995 8.27E-07 1870 liquid 1.1175 3 0.4321 3 8.0292 0 Fr 1',
 
     -- Freon-12
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Freon-12.html
-    Freon12 = {
-        ZoA = 0.4796798, x0 = 0.3035, I = 1.43E-07, x1 = 3.2659, density = 1120,
-        delta0 = 0, state = 'liquid', k = 3.4626, a = 0.0798, Cbar = 4.8251,
-        elements = {F = 0.314247, C = 0.099335, Cl = 0.586418}
-    },
+    Freon12 =
+        '0.4796798 1.43E-07 1120 liquid 0.3035 3.2659 0.0798 3.4626 4.8251 0 \z
+        F 0.314247 C 0.099335 Cl 0.586418',
 
     -- Freon-13
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Freon-13.html
-    Freon13 = {
-        ZoA = 0.4786563, x0 = 0.3659, I = 1.266E-07, x1 = 3.2337, density = 950,
-        delta0 = 0, state = 'liquid', k = 3.5551, a = 0.0724, Cbar = 4.7483,
-        elements = {F = 0.545622, C = 0.114983, Cl = 0.339396}
-    },
+    Freon13 =
+        '0.4786563 1.266E-07 950 liquid 0.3659 3.2337 0.0724 3.5551 4.7483 0 \z
+        F 0.545622 C 0.114983 Cl 0.339396',
 
     -- Freon-13b1
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Freon-13b1.html
-    Freon13b1 = {
-        ZoA = 0.4566514, x0 = 0.3522, I = 2.105E-07, x1 = 3.7554,
-        density = 1500, delta0 = 0, state = 'liquid', k = 3.7194, a = 0.0393,
-        Cbar = 5.3555, elements = {F = 0.382749, C = 0.080659, Br = 0.536592}
-    },
+    Freon13b1 =
+        '0.4566514 2.105E-07 1500 liquid 0.3522 3.7554 0.0393 3.7194 5.3555 0 \z
+        F 0.382749 C 0.080659 Br 0.536592',
 
     -- Freon-13i1
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Freon-13i1.html
-    Freon13i1 = {
-        ZoA = 0.4389771, x0 = 0.2847, I = 2.935E-07, x1 = 3.728, density = 1800,
-        delta0 = 0, state = 'liquid', k = 3.1658, a = 0.0911, Cbar = 5.8774,
-        elements = {I = 0.647767, F = 0.290924, C = 0.061309}
-    },
+    Freon13i1 =
+        '0.4389771 2.935E-07 1800 liquid 0.2847 3.728 0.0911 3.1658 5.8774 0 \z
+        I 0.647767 F 0.290924 C 0.061309',
 
     -- G10
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/G10.html
-    G10 = {
-        ZoA = 0.6336556, x0 = 0.2, I = 1.104E-07, x1 = 3, density = 1800,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1297, Cbar = 3.7685,
-        elements = {B = 0.01864, O = 0.385764, H = 0.275853, Si = 0.151423,
-        Mg = 0.010842, N = 0.027945, Ca = 0.081496, C = 0.003583,
-        Al = 0.044453}
-    },
+    G10 =
+        '0.6336556 1.104E-07 1800 liquid 0.2 3 0.1297 3 3.7685 0 B 0.01864 O \z
+        0.385764 H 0.275853 Si 0.151423 Mg 0.010842 N 0.027945 Ca 0.081496 C \z
+        0.003583 Al 0.044453',
 
     -- Gadolinium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gadolinium_Gd.html
-    Gadolinium = {
-        ZoA = 0.4069875, x0 = 0.1058, I = 5.91E-07, x1 = 3.3932, density = 7901,
-        delta0 = 0.14, state = 'liquid', k = 2.5977, a = 0.2511, Cbar = 5.8737,
-        elements = {Gd = 1}
-    },
+    Gadolinium =
+        '0.4069875 5.91E-07 7901 liquid 0.1058 3.3932 0.2511 2.5977 5.8737 \z
+        0.14 Gd 1',
 
     -- Gadolinium oxysulfide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gadolinium_oxysulfide.html
-    GadoliniumOxysulfide = {
-        ZoA = 0.4226422, x0 = 0.1774, I = 4.933E-07, x1 = 3.4045,
-        density = 7440, delta0 = 0, state = 'liquid', k = 2.63, a = 0.2216,
-        Cbar = 5.5347, elements = {O = 0.084528, S = 0.08469, Gd = 0.830782}
-    },
+    GadoliniumOxysulfide =
+        '0.4226422 4.933E-07 7440 liquid 0.1774 3.4045 0.2216 2.63 5.5347 0 O \z
+        0.084528 S 0.08469 Gd 0.830782',
 
     -- Gadolinium silicate
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gadolinium_silicate.html
-    GadoliniumSilicate = {
-        ZoA = 0.43068, x0 = 0.2039, I = 4.054E-07, x1 = 3, density = 6710,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1961, Cbar = 5.2267,
-        elements = {Si = 0.066462, Gd = 0.744233, O = 0.189305}
-    },
+    GadoliniumSilicate =
+        '0.43068 4.054E-07 6710 liquid 0.2039 3 0.1961 3 5.2267 0 Si 0.066462 \z
+        Gd 0.744233 O 0.189305',
 
     -- Gallium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gallium_Ga.html
-    Gallium = {
-        ZoA = 0.4446159, x0 = 0.2267, I = 3.34E-07, x1 = 3.5434, density = 5904,
-        delta0 = 0.14, state = 'liquid', k = 3.1314, a = 0.0944, Cbar = 4.9353,
-        elements = {Ga = 1}
-    },
+    Gallium =
+        '0.4446159 3.34E-07 5904 liquid 0.2267 3.5434 0.0944 3.1314 4.9353 \z
+        0.14 Ga 1',
 
     -- Gallium arsenide GaAs
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gallium_arsenide_GaAs.html
-    GalliumArsenide = {
-        ZoA = 0.4424635, x0 = 0.1764, I = 3.849E-07, x1 = 3.642, density = 5310,
-        delta0 = 0, state = 'liquid', k = 3.3356, a = 0.0715, Cbar = 5.3299,
-        elements = {Ga = 0.482019, As = 0.517981}
-    },
+    GalliumArsenide =
+        '0.4424635 3.849E-07 5310 liquid 0.1764 3.642 0.0715 3.3356 5.3299 0 \z
+        Ga 0.482019 As 0.517981',
 
     -- Gel in photographic emulsion
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gel_in_photographic_emulsion.html
-    GelInPhotographicEmulsion = {
-        ZoA = 0.5396714, x0 = 0.1709, I = 7.48E-08, x1 = 2.7058, density = 1291,
-        delta0 = 0, state = 'liquid', k = 3.4418, a = 0.101, Cbar = 3.2687,
-        elements = {O = 0.38064, S = 0.01088, N = 0.11124, H = 0.08118,
-        C = 0.41606}
-    },
+    GelInPhotographicEmulsion =
+        '0.5396714 7.48E-08 1291 liquid 0.1709 2.7058 0.101 3.4418 3.2687 0 O \z
+        0.38064 S 0.01088 N 0.11124 H 0.08118 C 0.41606',
 
     -- Germanium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/germanium_Ge.html
-    Germanium = {
-        ZoA = 0.4405887, x0 = 0.3376, I = 3.5E-07, x1 = 3.6096, density = 5323,
-        delta0 = 0.14, state = 'liquid', k = 3.3306, a = 0.0719, Cbar = 5.1411,
-        elements = {Ge = 1}
-    },
+    Germanium =
+        '0.4405887 3.5E-07 5323 liquid 0.3376 3.6096 0.0719 3.3306 5.1411 \z
+        0.14 Ge 1',
 
     -- Glucose dextrose monohydrate
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/glucose_dextrose_monohydrate.html
-    Glucose = {
-        ZoA = 0.5348367, x0 = 0.1411, I = 7.72E-08, x1 = 2.67, density = 1540,
-        delta0 = 0, state = 'liquid', k = 3.3946, a = 0.1078, Cbar = 3.1649,
-        elements = {H = 0.071204, C = 0.363652, O = 0.565144}
-    },
+    Glucose =
+        '0.5348367 7.72E-08 1540 liquid 0.1411 2.67 0.1078 3.3946 3.1649 0 H \z
+        0.071204 C 0.363652 O 0.565144',
 
     -- Glutamine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/glutamine.html
-    Glutamine = {
-        ZoA = 0.5336603, x0 = 0.1347, I = 7.33E-08, x1 = 2.6301, density = 1460,
-        delta0 = 0, state = 'liquid', k = 3.3254, a = 0.1193, Cbar = 3.1167,
-        elements = {O = 0.328427, H = 0.068965, C = 0.410926, N = 0.191681}
-    },
+    Glutamine =
+        '0.5336603 7.33E-08 1460 liquid 0.1347 2.6301 0.1193 3.3254 3.1167 0 \z
+        O 0.328427 H 0.068965 C 0.410926 N 0.191681',
 
     -- Glycerol
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/glycerol.html
-    Glycerol = {
-        ZoA = 0.5428578, x0 = 0.1653, I = 7.26E-08, x1 = 2.6862, density = 1261,
-        delta0 = 0, state = 'liquid', k = 3.4481, a = 0.1017, Cbar = 3.2267,
-        elements = {H = 0.087554, C = 0.391262, O = 0.521185}
-    },
+    Glycerol =
+        '0.5428578 7.26E-08 1261 liquid 0.1653 2.6862 0.1017 3.4481 3.2267 0 \z
+        H 0.087554 C 0.391262 O 0.521185',
 
     -- Gold
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gold_Au.html
-    Gold = {
-        ZoA = 0.4010824, x0 = 0.2021, I = 7.9E-07, x1 = 3.6979, density = 19320,
-        delta0 = 0.14, state = 'liquid', k = 3.1101, a = 0.0976, Cbar = 5.5747,
-        elements = {Au = 1}
-    },
+    Gold =
+        '0.4010824 7.9E-07 19320 liquid 0.2021 3.6979 0.0976 3.1101 5.5747 \z
+        0.14 Au 1',
 
     -- Guanine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/guanine.html
-    Guanine = {
-        ZoA = 0.5160899, x0 = 0.1163, I = 7.5E-08, x1 = 2.4296, density = 1580,
-        delta0 = 0, state = 'liquid', k = 3.0186, a = 0.2053, Cbar = 3.1171,
-        elements = {O = 0.105867, H = 0.033346, C = 0.39738, N = 0.463407}
-    },
+    Guanine =
+        '0.5160899 7.5E-08 1580 liquid 0.1163 2.4296 0.2053 3.0186 3.1171 0 O \z
+        0.105867 H 0.033346 C 0.39738 N 0.463407',
 
     -- Gypsum plaster of Paris
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/gypsum_plaster_of_Paris.html
-    GypsumPlasterOfParis = {
-        ZoA = 0.5111004, x0 = 0.0995, I = 1.297E-07, x1 = 3.1206,
-        density = 2320, delta0 = 0, state = 'liquid', k = 3.5134, a = 0.0695,
-        Cbar = 3.8382, elements = {Ca = 0.232797, O = 0.557572, S = 0.186215,
-        H = 0.023416}
-    },
+    GypsumPlasterOfParis =
+        '0.5111004 1.297E-07 2320 liquid 0.0995 3.1206 0.0695 3.5134 3.8382 0 \z
+        Ca 0.232797 O 0.557572 S 0.186215 H 0.023416',
 
     -- Hafnium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hafnium_Hf.html
-    Hafnium = {
-        ZoA = 0.4033794, x0 = 0.1965, I = 7.05E-07, x1 = 3.4337,
-        density = 13310, delta0 = 0.14, state = 'liquid', k = 2.6155,
-        a = 0.2292, Cbar = 5.7139, elements = {Hf = 1}
-    },
+    Hafnium =
+        '0.4033794 7.05E-07 13310 liquid 0.1965 3.4337 0.2292 2.6155 5.7139 \z
+        0.14 Hf 1',
 
     -- Hassium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hassium_Hs.html
-    Hassium = {
-        ZoA = 0.4012871, x0 = 0.6392, I = 1.102E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.275, Cbar = 6.5619,
-        elements = {Hs = 1}
-    },
+    Hassium =
+        '0.4012871 1.102E-06 14000 liquid 0.6392 3 0.275 3 6.5619 0 Hs 1',
 
     -- Heavymet in ATLAS calorimeter
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/heavymet_in_ATLAS_calorimeter.html
-    HeavymetInATLASCalorimeter = {
-        ZoA = 0.405938, x0 = 0.2167, I = 7.27E-07, x1 = 3.496, density = 19300,
-        delta0 = 0.14, state = 'liquid', k = 2.8447, a = 0.1551, Cbar = 5.4059,
-        elements = {Ni = 0.035, W = 0.95, Cu = 0.015}
-    },
+    HeavymetInATLASCalorimeter =
+        '0.405938 7.27E-07 19300 liquid 0.2167 3.496 0.1551 2.8447 5.4059 \z
+        0.14 Ni 0.035 W 0.95 Cu 0.015',
 
     -- Heavymet in Rochester gamma stop
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/heavymet_in_Rochester_gamma_stop.html
-    HeavymetInRochesterGammaStop = {
-        ZoA = 0.4091473, x0 = 0.2167, I = 7.27E-07, x1 = 3.496, density = 19300,
-        delta0 = 0.14, state = 'liquid', k = 2.8447, a = 0.1551, Cbar = 5.4059,
-        elements = {Ni = 0.06, W = 0.9, Cu = 0.04}
-    },
+    HeavymetInRochesterGammaStop =
+        '0.4091473 7.27E-07 19300 liquid 0.2167 3.496 0.1551 2.8447 5.4059 \z
+        0.14 Ni 0.06 W 0.9 Cu 0.04',
 
     -- Helium gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/helium_gas_He.html
-    HeliumGas = {
-        ZoA = 0.4996752, x0 = 2.2017, I = 4.18E-08, x1 = 3.6122,
-        density = 0.1663, delta0 = 0, state = 'gas', k = 5.8347, a = 0.1344,
-        Cbar = 11.1393, elements = {He = 1}
-    },
+    HeliumGas =
+        '0.4996752 4.18E-08 0.1663 gas 2.2017 3.6122 0.1344 5.8347 11.1393 0 \z
+        He 1',
 
     -- Holmium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/holmium_Ho.html
-    Holmium = {
-        ZoA = 0.4062329, x0 = 0.0761, I = 6.5E-07, x1 = 3.4782, density = 8795,
-        delta0 = 0.14, state = 'liquid', k = 2.5726, a = 0.2464, Cbar = 5.9587,
-        elements = {Ho = 1}
-    },
+    Holmium =
+        '0.4062329 6.5E-07 8795 liquid 0.0761 3.4782 0.2464 2.5726 5.9587 \z
+        0.14 Ho 1',
 
     -- Hydrogen gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/hydrogen_gas.html
-    HydrogenGas = {
-        ZoA = 0.991375, x0 = 1.8639, I = 1.92E-08, x1 = 3.2718,
-        density = 0.08376, delta0 = 0, state = 'gas', k = 5.7273, a = 0.1409,
-        Cbar = 9.5834, elements = {H = 1}
-    },
+    HydrogenGas =
+        '0.991375 1.92E-08 0.08376 gas 1.8639 3.2718 0.1409 5.7273 9.5834 0 H \z
+        1',
 
     -- Indium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/indium_In.html
-    Indium = {
-        ZoA = 0.4267624, x0 = 0.2406, I = 4.88E-07, x1 = 3.2032, density = 7310,
-        delta0 = 0.14, state = 'liquid', k = 2.7144, a = 0.2388, Cbar = 5.5211,
-        elements = {In = 1}
-    },
+    Indium =
+        '0.4267624 4.88E-07 7310 liquid 0.2406 3.2032 0.2388 2.7144 5.5211 \z
+        0.14 In 1',
 
     -- Iodine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iodine_I.html
-    Iodine = {
-        ZoA = 0.4176385, x0 = 0.0549, I = 4.91E-07, x1 = 3.2596, density = 4930,
-        delta0 = 0, state = 'liquid', k = 2.7276, a = 0.2377, Cbar = 5.9488,
-        elements = {I = 1}
-    },
+    Iodine =
+        '0.4176385 4.91E-07 4930 liquid 0.0549 3.2596 0.2377 2.7276 5.9488 0 \z
+        I 1',
 
     -- Iridium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iridium_Ir.html
-    Iridium = {
-        ZoA = 0.4005889, x0 = 0.0819, I = 7.57E-07, x1 = 3.548, density = 22420,
-        delta0 = 0.1, state = 'liquid', k = 2.9658, a = 0.1269, Cbar = 5.3418,
-        elements = {Ir = 1}
-    },
+    Iridium =
+        '0.4005889 7.57E-07 22420 liquid 0.0819 3.548 0.1269 2.9658 5.3418 \z
+        0.1 Ir 1',
 
     -- Iron
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/iron_Fe.html
-    Iron = {
-        ZoA = 0.4655727, x0 = 0.0012, I = 2.86E-07, x1 = 3.1531, density = 7874,
-        delta0 = 0.12, state = 'liquid', k = 2.9632, a = 0.1468, Cbar = 4.2911,
-        elements = {Fe = 1}
-    },
+    Iron =
+        '0.4655727 2.86E-07 7874 liquid 0.0012 3.1531 0.1468 2.9632 4.2911 \z
+        0.12 Fe 1',
 
     -- Krypton gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/krypton_gas_Kr.html
-    KryptonGas = {
-        ZoA = 0.4296035, x0 = 1.7153, I = 3.52E-07, x1 = 5.0743,
-        density = 3.486, delta0 = 0, state = 'gas', k = 3.4051, a = 0.0745,
-        Cbar = 12.5094, elements = {Kr = 1}
-    },
+    KryptonGas =
+        '0.4296035 3.52E-07 3.486 gas 1.7153 5.0743 0.0745 3.4051 12.5094 0 \z
+        Kr 1',
 
     -- Lanthanum
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_La.html
-    Lanthanum = {
-        ZoA = 0.4103524, x0 = 0.3164, I = 5.01E-07, x1 = 3.3296, density = 6145,
-        delta0 = 0.14, state = 'liquid', k = 2.8828, a = 0.1859, Cbar = 5.7865,
-        elements = {La = 1}
-    },
+    Lanthanum =
+        '0.4103524 5.01E-07 6145 liquid 0.3164 3.3296 0.1859 2.8828 5.7865 \z
+        0.14 La 1',
 
     -- Lanthanum bromide
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_bromide.html
-    LanthanumBromide = {
-        ZoA = 0.4278722, x0 = 0.3581, I = 4.545E-07, x1 = 3, density = 5290,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2197, Cbar = 5.6997,
-        elements = {Br = 0.633124, La = 0.366875}
-    },
+    LanthanumBromide =
+        '0.4278722 4.545E-07 5290 liquid 0.3581 3 0.2197 3 5.6997 0 Br \z
+        0.633124 La 0.366875',
 
     -- Lanthanum chloride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_chloride.html
-    LanthanumChloride = {
-        ZoA = 0.4403406, x0 = 0.2418, I = 3.295E-07, x1 = 3, density = 3860,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2016, Cbar = 5.3428,
-        elements = {Cl = 0.43365, La = 0.56635}
-    },
+    LanthanumChloride =
+        '0.4403406 3.295E-07 3860 liquid 0.2418 3 0.2016 3 5.3428 0 Cl \z
+        0.43365 La 0.56635',
 
     -- Lanthanum fluoride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_fluoride.html
-    LanthanumFluoride = {
-        ZoA = 0.4287897, x0 = 0.2, I = 3.363E-07, x1 = 3, density = 5900,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1852, Cbar = 4.986,
-        elements = {F = 0.290939, La = 0.709061}
-    },
+    LanthanumFluoride =
+        '0.4287897 3.363E-07 5900 liquid 0.2 3 0.1852 3 4.986 0 F 0.290939 La \z
+        0.709061',
 
     -- Lanthanum oxybromide LaOBr
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_oxybromide_LaOBr.html
-    LanthanumOxybromide = {
-        ZoA = 0.4258791, x0 = 0.035, I = 4.397E-07, x1 = 3.3288, density = 6280,
-        delta0 = 0, state = 'liquid', k = 2.8457, a = 0.1783, Cbar = 5.4666,
-        elements = {O = 0.068138, Br = 0.340294, La = 0.591568}
-    },
+    LanthanumOxybromide =
+        '0.4258791 4.397E-07 6280 liquid 0.035 3.3288 0.1783 2.8457 5.4666 0 \z
+        O 0.068138 Br 0.340294 La 0.591568',
 
     -- Lanthanum oxysulfide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lanthanum_oxysulfide.html
-    LanthanumOxysulfide = {
-        ZoA = 0.4270567, x0 = 0.0906, I = 4.212E-07, x1 = 3.2664,
-        density = 5860, delta0 = 0, state = 'liquid', k = 2.7298, a = 0.215,
-        Cbar = 5.447, elements = {O = 0.0936, S = 0.093778, La = 0.812622}
-    },
+    LanthanumOxysulfide =
+        '0.4270567 4.212E-07 5860 liquid 0.0906 3.2664 0.215 2.7298 5.447 0 O \z
+        0.0936 S 0.093778 La 0.812622',
 
     -- Lawrencium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lawrencium_Lr.html
-    Lawrencium = {
-        ZoA = 0.3929648, x0 = 0.6045, I = 1.034E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2671, Cbar = 6.4555,
-        elements = {Lr = 1}
-    },
+    Lawrencium =
+        '0.3929648 1.034E-06 14000 liquid 0.6045 3 0.2671 3 6.4555 0 Lr 1',
 
     -- Lead
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_Pb.html
-    Lead = {
-        ZoA = 0.3957338, x0 = 0.3776, I = 8.23E-07, x1 = 3.8073,
-        density = 11350, delta0 = 0.14, state = 'liquid', k = 3.1608,
-        a = 0.0936, Cbar = 6.2018, elements = {Pb = 1}
-    },
+    Lead =
+        '0.3957338 8.23E-07 11350 liquid 0.3776 3.8073 0.0936 3.1608 6.2018 \z
+        0.14 Pb 1',
 
     -- Lead fluoride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_fluoride.html
-    LeadFluoride = {
-        ZoA = 0.4078196, x0 = 0.4668, I = 6.354E-07, x1 = 3, density = 7770,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2389, Cbar = 6.0333,
-        elements = {Pb = 0.845035, F = 0.154965}
-    },
+    LeadFluoride =
+        '0.4078196 6.354E-07 7770 liquid 0.4668 3 0.2389 3 6.0333 0 Pb \z
+        0.845035 F 0.154965',
 
     -- Lead glass
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_glass.html
-    LeadGlass = {
-        ZoA = 0.4209939, x0 = 0.0614, I = 5.264E-07, x1 = 3.8146,
-        density = 6220, delta0 = 0, state = 'liquid', k = 3.074, a = 0.0954,
-        Cbar = 5.8476, elements = {Si = 0.080866, O = 0.156453, Ti = 0.008092,
-        Pb = 0.751938, As = 0.002651}
-    },
+    LeadGlass =
+        '0.4209939 5.264E-07 6220 liquid 0.0614 3.8146 0.0954 3.074 5.8476 0 \z
+        Si 0.080866 O 0.156453 Ti 0.008092 Pb 0.751938 As 0.002651',
 
     -- Lead oxide PbO
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_oxide_PbO.html
-    LeadOxide = {
-        ZoA = 0.4032094, x0 = 0.0356, I = 7.667E-07, x1 = 3.5456,
-        density = 9530, delta0 = 0, state = 'liquid', k = 2.7299, a = 0.1964,
-        Cbar = 6.2162, elements = {Pb = 0.928318, O = 0.071682}
-    },
+    LeadOxide =
+        '0.4032094 7.667E-07 9530 liquid 0.0356 3.5456 0.1964 2.7299 6.2162 0 \z
+        Pb 0.928318 O 0.071682',
 
     -- Lead tungstate
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lead_tungstate.html
-    LeadTungstate = {
-        ZoA = 0.4130535, x0 = 0.4068, I = 6.007E-07, x1 = 3.0023,
-        density = 8300, delta0 = 0, state = 'liquid', k = 3, a = 0.2276,
-        Cbar = 5.8528, elements = {Pb = 0.455347, O = 0.140462, W = 0.404011}
-    },
+    LeadTungstate =
+        '0.4130535 6.007E-07 8300 liquid 0.4068 3.0023 0.2276 3 5.8528 0 Pb \z
+        0.455347 O 0.140462 W 0.404011',
 
     -- Liquid argon
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_argon.html
-    LiquidArgon = {
-        ZoA = 0.4505846, x0 = 0.2, I = 1.88E-07, x1 = 3, density = 1396,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1956, Cbar = 5.2146,
-        elements = {Ar = 1}
-    },
+    LiquidArgon =
+        '0.4505846 1.88E-07 1396 liquid 0.2 3 0.1956 3 5.2146 0 Ar 1',
 
     -- Liquid bromine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_bromine.html
-    LiquidBromine = {
-        ZoA = 0.4380251, x0 = 0.3669, I = 3.57E-07, x1 = 3, density = 3103,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2211, Cbar = 5.7268,
-        elements = {Br = 1}
-    },
+    LiquidBromine =
+        '0.4380251 3.57E-07 3103 liquid 0.3669 3 0.2211 3 5.7268 0 Br 1',
 
     -- Liquid chlorine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_chlorine.html
-    LiquidChlorine = {
-        ZoA = 0.4795054, x0 = 0.2, I = 1.74E-07, x1 = 3, density = 1574,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1802, Cbar = 4.8776,
-        elements = {Cl = 1}
-    },
+    LiquidChlorine =
+        '0.4795054 1.74E-07 1574 liquid 0.2 3 0.1802 3 4.8776 0 Cl 1',
 
     -- Liquid deuterium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_deuterium.html
-    LiquidDeuterium = {
-        ZoA = 0.4964997, x0 = 0.4467, I = 2.18E-08, x1 = 1.8923,
-        density = 163.8, delta0 = 0, state = 'liquid', k = 5.6249, a = 0.1348,
-        Cbar = 3.1288, elements = {D = 1}
-    },
+    LiquidDeuterium =
+        '0.4964997 2.18E-08 163.8 liquid 0.4467 1.8923 0.1348 5.6249 3.1288 0 \z
+        D 1',
 
     -- Liquid fluorine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_fluorine.html
-    LiquidFluorine = {
-        ZoA = 0.4737241, x0 = 0.2, I = 1.15E-07, x1 = 3, density = 1507,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.145, Cbar = 4.105,
-        elements = {F = 1}
-    },
+    LiquidFluorine =
+        '0.4737241 1.15E-07 1507 liquid 0.2 3 0.145 3 4.105 0 F 1',
 
     -- Liquid helium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_helium.html
-    LiquidHelium = {
-        ZoA = 0.4996752, x0 = 0.4729, I = 4.18E-08, x1 = 2, density = 124.9,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.6571, Cbar = 4.518,
-        elements = {He = 1}
-    },
+    LiquidHelium =
+        '0.4996752 4.18E-08 124.9 liquid 0.4729 2 0.6571 3 4.518 0 He 1',
 
     -- Liquid hydrogen
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_hydrogen.html
-    LiquidHydrogen = {
-        ZoA = 0.991375, x0 = 0.44, I = 2.18E-08, x1 = 1.8856, density = 70.8,
-        delta0 = 0, state = 'gas', k = 5.6249, a = 0.1348, Cbar = 3.0977,
-        elements = {H = 1}
-    },
+    LiquidHydrogen =
+        '0.991375 2.18E-08 70.8 gas 0.44 1.8856 0.1348 5.6249 3.0977 0 H 1',
 
     -- Liquid krypton
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_krypton_Kr.html
-    LiquidKrypton = {
-        ZoA = 0.4296035, x0 = 0.4454, I = 3.52E-07, x1 = 3, density = 2418,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2349, Cbar = 5.9674,
-        elements = {Kr = 1}
-    },
+    LiquidKrypton =
+        '0.4296035 3.52E-07 2418 liquid 0.4454 3 0.2349 3 5.9674 0 Kr 1',
 
     -- Liquid neon
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_neon.html
-    LiquidNeon = {
-        ZoA = 0.4955451, x0 = 0.2, I = 1.37E-07, x1 = 3, density = 1204,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1692, Cbar = 4.6345,
-        elements = {Ne = 1}
-    },
+    LiquidNeon =
+        '0.4955451 1.37E-07 1204 liquid 0.2 3 0.1692 3 4.6345 0 Ne 1',
 
     -- Liquid nitrogen
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_nitrogen.html
-    LiquidNitrogen = {
-        ZoA = 0.499743, x0 = 0.3039, I = 8.2E-08, x1 = 2, density = 807,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.5329, Cbar = 3.9996,
-        elements = {N = 1}
-    },
+    LiquidNitrogen =
+        '0.499743 8.2E-08 807 liquid 0.3039 2 0.5329 3 3.9996 0 N 1',
 
     -- Liquid oxygen
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_oxygen.html
-    LiquidOxygen = {
-        ZoA = 0.5000219, x0 = 0.2868, I = 9.5E-08, x1 = 2, density = 1141,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.5223, Cbar = 3.9471,
-        elements = {O = 1}
-    },
+    LiquidOxygen =
+        '0.5000219 9.5E-08 1141 liquid 0.2868 2 0.5223 3 3.9471 0 O 1',
 
     -- Liquid propane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_propane.html
-    LiquidPropane = {
-        ZoA = 0.589483, x0 = 0.2564, I = 5.2E-08, x1 = 2.6271, density = 493,
-        delta0 = 0, state = 'liquid', k = 3.562, a = 0.1033, Cbar = 3.4162,
-        elements = {C = 0.817145, H = 0.182855}
-    },
+    LiquidPropane =
+        '0.589483 5.2E-08 493 liquid 0.2564 2.6271 0.1033 3.562 3.4162 0 C \z
+        0.817145 H 0.182855',
 
     -- Liquid xenon
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/liquid_xenon_Xe.html
-    LiquidXenon = {
-        ZoA = 0.4112907, x0 = 0.5993, I = 4.82E-07, x1 = 3, density = 2953,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2659, Cbar = 6.4396,
-        elements = {Xe = 1}
-    },
+    LiquidXenon =
+        '0.4112907 4.82E-07 2953 liquid 0.5993 3 0.2659 3 6.4396 0 Xe 1',
 
     -- Lithium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_Li.html
-    Lithium = {
-        ZoA = 0.4321521, x0 = 0.1304, I = 4E-08, x1 = 1.6397, density = 534,
-        delta0 = 0.14, state = 'liquid', k = 2.4993, a = 0.9514, Cbar = 3.1221,
-        elements = {Li = 1}
-    },
+    Lithium =
+        '0.4321521 4E-08 534 liquid 0.1304 1.6397 0.9514 2.4993 3.1221 0.14 \z
+        Li 1',
 
     -- Lithium amide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_amide.html
-    LithiumAmide = {
-        ZoA = 0.5224698, x0 = 0.0198, I = 5.55E-08, x1 = 2.5152, density = 1178,
-        delta0 = 0, state = 'liquid', k = 3.7534, a = 0.0874, Cbar = 2.7961,
-        elements = {H = 0.087783, N = 0.609955, Li = 0.302262}
-    },
+    LithiumAmide =
+        '0.5224698 5.55E-08 1178 liquid 0.0198 2.5152 0.0874 3.7534 2.7961 0 \z
+        H 0.087783 N 0.609955 Li 0.302262',
 
     -- Lithium carbonate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_carbonate.html
-    LithiumCarbonate = {
-        ZoA = 0.4871945, x0 = 0.0551, I = 8.79E-08, x1 = 2.6598, density = 2110,
-        delta0 = 0, state = 'liquid', k = 3.5417, a = 0.0994, Cbar = 3.2029,
-        elements = {O = 0.649579, C = 0.16255, Li = 0.187871}
-    },
+    LithiumCarbonate =
+        '0.4871945 8.79E-08 2110 liquid 0.0551 2.6598 0.0994 3.5417 3.2029 0 \z
+        O 0.649579 C 0.16255 Li 0.187871',
 
     -- Lithium fluoride LiF
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_fluoride_LiF.html
-    LithiumFluoride = {
-        ZoA = 0.4626001, x0 = 0.0171, I = 9.4E-08, x1 = 2.7049, density = 2635,
-        delta0 = 0, state = 'liquid', k = 3.7478, a = 0.0759, Cbar = 3.1667,
-        elements = {F = 0.732415, Li = 0.267585}
-    },
+    LithiumFluoride =
+        '0.4626001 9.4E-08 2635 liquid 0.0171 2.7049 0.0759 3.7478 3.1667 0 F \z
+        0.732415 Li 0.267585',
 
     -- Lithium hydride LiH
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_hydride_LiH.html
-    LithiumHydride = {
-        ZoA = 0.5030599, x0 = 0.0988, I = 3.65E-08, x1 = 1.4515, density = 820,
-        delta0 = 0, state = 'liquid', k = 2.5849, a = 0.9057, Cbar = 2.358,
-        elements = {Li = 0.873203, H = 0.126797}
-    },
+    LithiumHydride =
+        '0.5030599 3.65E-08 820 liquid 0.0988 1.4515 0.9057 2.5849 2.358 0 Li \z
+        0.873203 H 0.126797',
 
     -- Lithium iodide LiI
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_iodide_LiI.html
-    LithiumIodide = {
-        ZoA = 0.4183912, x0 = 0.0892, I = 4.851E-07, x1 = 3.3702,
-        density = 3494, delta0 = 0, state = 'liquid', k = 2.7146, a = 0.2327,
-        Cbar = 6.2671, elements = {I = 0.948142, Li = 0.051858}
-    },
+    LithiumIodide =
+        '0.4183912 4.851E-07 3494 liquid 0.0892 3.3702 0.2327 2.7146 6.2671 0 \z
+        I 0.948142 Li 0.051858',
 
     -- Lithium oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_oxide.html
-    LithiumOxide = {
-        ZoA = 0.4684916, x0 = 0.0511, I = 7.36E-08, x1 = 2.5874, density = 2013,
-        delta0 = 0, state = 'liquid', k = 3.7878, a = 0.0803, Cbar = 2.934,
-        elements = {O = 0.53543, Li = 0.46457}
-    },
+    LithiumOxide =
+        '0.4684916 7.36E-08 2013 liquid 0.0511 2.5874 0.0803 3.7878 2.934 0 O \z
+        0.53543 Li 0.46457',
 
     -- Lithium tetraborate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lithium_tetraborate.html
-    LithiumTetraborate = {
-        ZoA = 0.4847895, x0 = 0.0737, I = 9.46E-08, x1 = 2.6502, density = 2440,
-        delta0 = 0, state = 'liquid', k = 3.4389, a = 0.1107, Cbar = 3.2093,
-        elements = {B = 0.25568, O = 0.662235, Li = 0.082085}
-    },
+    LithiumTetraborate =
+        '0.4847895 9.46E-08 2440 liquid 0.0737 2.6502 0.1107 3.4389 3.2093 0 \z
+        B 0.25568 O 0.662235 Li 0.082085',
 
     -- Livermorium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/livermorium_Lv.html
-    Livermorium = {
-        ZoA = 0.3956276, x0 = 0.7064, I = 1.213E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2913, Cbar = 6.7681,
-        elements = {Lv = 1}
-    },
+    Livermorium =
+        '0.3956276 1.213E-06 14000 liquid 0.7064 3 0.2913 3 6.7681 0 Lv 1',
 
     -- Lung ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lung_ICRP.html
-    Lung = {
-        ZoA = 0.5495746, x0 = 0.2261, I = 7.53E-08, x1 = 2.8001, density = 1050,
-        delta0 = 0, state = 'liquid', k = 3.5353, a = 0.0859, Cbar = 3.4708,
-        elements = {K = 0.00194, O = 0.757072, S = 0.00225, H = 0.101278,
-        P = 0.0008, Fe = 0.00037, Zn = 1E-05, Ca = 9E-05, Na = 0.00184,
-        Cl = 0.00266, Mg = 0.00073, C = 0.10231, N = 0.02865}
-    },
+    Lung =
+        '0.5495746 7.53E-08 1050 liquid 0.2261 2.8001 0.0859 3.5353 3.4708 0 \z
+        K 0.00194 O 0.757072 S 0.00225 H 0.101278 P 0.0008 Fe 0.00037 Zn \z
+        1E-05 Ca 9E-05 Na 0.00184 Cl 0.00266 Mg 0.00073 C 0.10231 N 0.02865',
 
     -- Lutetium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_Lu.html
-    Lutetium = {
-        ZoA = 0.4057908, x0 = 0.156, I = 6.94E-07, x1 = 3.5218, density = 9841,
-        delta0 = 0.14, state = 'liquid', k = 2.5643, a = 0.2403, Cbar = 5.9784,
-        elements = {Lu = 1}
-    },
+    Lutetium =
+        '0.4057908 6.94E-07 9841 liquid 0.156 3.5218 0.2403 2.5643 5.9784 \z
+        0.14 Lu 1',
 
     -- Lutetium aluminum oxide 1
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_aluminum_oxide_1.html
-    LutetiumAluminumOxide1 = {
-        ZoA = 0.4320927, x0 = 0.2, I = 4.232E-07, x1 = 3, density = 8300,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1902, Cbar = 5.0967,
-        elements = {Al = 0.107949, Lu = 0.700017, O = 0.192034}
-    },
+    LutetiumAluminumOxide1 =
+        '0.4320927 4.232E-07 8300 liquid 0.2 3 0.1902 3 5.0967 0 Al 0.107949 \z
+        Lu 0.700017 O 0.192034',
 
     -- Lutetium aluminum oxide 2
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_aluminum_oxide_2.html
-    LutetiumAluminumOxide2 = {
-        ZoA = 0.4390698, x0 = 0.2, I = 3.659E-07, x1 = 3, density = 6730,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1858, Cbar = 4.9994,
-        elements = {Al = 0.158379, Lu = 0.616224, O = 0.225396}
-    },
+    LutetiumAluminumOxide2 =
+        '0.4390698 3.659E-07 6730 liquid 0.2 3 0.1858 3 4.9994 0 Al 0.158379 \z
+        Lu 0.616224 O 0.225396',
 
     -- Lutetium fluoride
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_fluoride.html
-    LutetiumFluoride = {
-        ZoA = 0.4224826, x0 = 0.2214, I = 4.587E-07, x1 = 3, density = 8300,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1986, Cbar = 5.2803,
-        elements = {Lu = 0.754291, F = 0.245709}
-    },
+    LutetiumFluoride =
+        '0.4224826 4.587E-07 8300 liquid 0.2214 3 0.1986 3 5.2803 0 Lu \z
+        0.754291 F 0.245709',
 
     -- Lutetium silicon oxide
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/lutetium_silicon_oxide.html
-    LutetiumSiliconOxide = {
-        ZoA = 0.4279328, x0 = 0.2732, I = 4.72E-07, x1 = 3, density = 7400,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2062, Cbar = 5.4394,
-        elements = {Si = 0.06132, O = 0.17466, Lu = 0.76402}
-    },
+    LutetiumSiliconOxide =
+        '0.4279328 4.72E-07 7400 liquid 0.2732 3 0.2062 3 5.4394 0 Si 0.06132 \z
+        O 0.17466 Lu 0.76402',
 
     -- M3 WAX
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/M3_WAX.html
-    M3Wax = {
-        ZoA = 0.5550295, x0 = 0.1523, I = 6.79E-08, x1 = 2.7529, density = 1050,
-        delta0 = 0, state = 'liquid', k = 3.6412, a = 0.0786, Cbar = 3.254,
-        elements = {O = 0.092183, Mg = 0.134792, H = 0.114318, C = 0.655823,
-        Ca = 0.002883}
-    },
+    M3Wax =
+        '0.5550295 6.79E-08 1050 liquid 0.1523 2.7529 0.0786 3.6412 3.254 0 O \z
+        0.092183 Mg 0.134792 H 0.114318 C 0.655823 Ca 0.002883',
 
     -- Magnesium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_Mg.html
-    Magnesium = {
-        ZoA = 0.4937134, x0 = 0.1499, I = 1.56E-07, x1 = 3.0668, density = 1740,
-        delta0 = 0.08, state = 'liquid', k = 3.6166, a = 0.0816, Cbar = 4.5297,
-        elements = {Mg = 1}
-    },
+    Magnesium =
+        '0.4937134 1.56E-07 1740 liquid 0.1499 3.0668 0.0816 3.6166 4.5297 \z
+        0.08 Mg 1',
 
     -- Magnesium carbonate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_carbonate.html
-    MagnesiumCarbonate = {
-        ZoA = 0.4981362, x0 = 0.086, I = 1.18E-07, x1 = 2.7997, density = 2958,
-        delta0 = 0, state = 'liquid', k = 3.5003, a = 0.0922, Cbar = 3.4319,
-        elements = {O = 0.569278, C = 0.142455, Mg = 0.288267}
-    },
+    MagnesiumCarbonate =
+        '0.4981362 1.18E-07 2958 liquid 0.086 2.7997 0.0922 3.5003 3.4319 0 O \z
+        0.569278 C 0.142455 Mg 0.288267',
 
     -- Magnesium fluoride
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_fluoride.html
-    MagnesiumFluoride = {
-        ZoA = 0.4815223, x0 = 0.1369, I = 1.343E-07, x1 = 2.863, density = 3000,
-        delta0 = 0, state = 'liquid', k = 3.6485, a = 0.0793, Cbar = 3.7105,
-        elements = {Mg = 0.390117, F = 0.609883}
-    },
+    MagnesiumFluoride =
+        '0.4815223 1.343E-07 3000 liquid 0.1369 2.863 0.0793 3.6485 3.7105 0 \z
+        Mg 0.390117 F 0.609883',
 
     -- Magnesium oxide MgO
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_oxide_MgO.html
-    MagnesiumOxide = {
-        ZoA = 0.4962176, x0 = 0.0575, I = 1.438E-07, x1 = 2.858, density = 3580,
-        delta0 = 0, state = 'liquid', k = 3.5968, a = 0.0831, Cbar = 3.6404,
-        elements = {Mg = 0.603036, O = 0.396964}
-    },
+    MagnesiumOxide =
+        '0.4962176 1.438E-07 3580 liquid 0.0575 2.858 0.0831 3.5968 3.6404 0 \z
+        Mg 0.603036 O 0.396964',
 
     -- Magnesium tetraborate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/magnesium_tetraborate.html
-    MagnesiumTetraborate = {
-        ZoA = 0.4900675, x0 = 0.1147, I = 1.083E-07, x1 = 2.7635,
-        density = 2530, delta0 = 0, state = 'liquid', k = 3.4893, a = 0.097,
-        Cbar = 3.4328, elements = {B = 0.240837, O = 0.62379, Mg = 0.135373}
-    },
+    MagnesiumTetraborate =
+        '0.4900675 1.083E-07 2530 liquid 0.1147 2.7635 0.097 3.4893 3.4328 0 \z
+        B 0.240837 O 0.62379 Mg 0.135373',
 
     -- Manganese
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/manganese_Mn.html
-    Manganese = {
-        ZoA = 0.4550584, x0 = 0.0447, I = 2.72E-07, x1 = 3.1074, density = 7440,
-        delta0 = 0.14, state = 'liquid', k = 2.9796, a = 0.1497, Cbar = 4.2702,
-        elements = {Mn = 1}
-    },
+    Manganese =
+        '0.4550584 2.72E-07 7440 liquid 0.0447 3.1074 0.1497 2.9796 4.2702 \z
+        0.14 Mn 1',
 
     -- Meitnerium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/meitnerium_Mt.html
-    Meitnerium = {
-        ZoA = 0.3918664, x0 = 0.6522, I = 1.115E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2781, Cbar = 6.6019,
-        elements = {Mt = 1}
-    },
+    Meitnerium =
+        '0.3918664 1.115E-06 14000 liquid 0.6522 3 0.2781 3 6.6019 0 Mt 1',
 
     -- Mendelevium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mendelevium_Md.html
-    Mendelevium = {
-        ZoA = 0.3913242, x0 = 0.5886, I = 1.007E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2636, Cbar = 6.4068,
-        elements = {Md = 1}
-    },
+    Mendelevium =
+        '0.3913242 1.007E-06 14000 liquid 0.5886 3 0.2636 3 6.4068 0 Md 1',
 
     -- Mercuric iodide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mercuric_iodide.html
-    MercuricIodide = {
-        ZoA = 0.4093311, x0 = 0.104, I = 6.845E-07, x1 = 3.4728, density = 6360,
-        delta0 = 0, state = 'liquid', k = 2.7264, a = 0.2151, Cbar = 6.3787,
-        elements = {I = 0.55856, Hg = 0.44144}
-    },
+    MercuricIodide =
+        '0.4093311 6.845E-07 6360 liquid 0.104 3.4728 0.2151 2.7264 6.3787 0 \z
+        I 0.55856 Hg 0.44144',
 
     -- Mercury
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mercury_Hg.html
-    Mercury = {
-        ZoA = 0.3988195, x0 = 0.2756, I = 8E-07, x1 = 3.7275, density = 13550,
-        delta0 = 0.14, state = 'liquid', k = 3.0519, a = 0.1101, Cbar = 5.9605,
-        elements = {Hg = 1}
-    },
+    Mercury =
+        '0.3988195 8E-07 13550 liquid 0.2756 3.7275 0.1101 3.0519 5.9605 0.14 \z
+        Hg 1',
 
     -- Methane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/methane.html
-    Methane = {
-        ZoA = 0.6231489, x0 = 1.6263, I = 4.17E-08, x1 = 3.9716,
-        density = 0.6672, delta0 = 0, state = 'gas', k = 3.6257, a = 0.0925,
-        Cbar = 9.5243, elements = {C = 0.748694, H = 0.251306}
-    },
+    Methane =
+        '0.6231489 4.17E-08 0.6672 gas 1.6263 3.9716 0.0925 3.6257 9.5243 0 C \z
+        0.748694 H 0.251306',
 
     -- Methanol
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/methanol.html
-    Methanol = {
-        ZoA = 0.5616682, x0 = 0.2529, I = 6.76E-08, x1 = 2.7639,
-        density = 791.4, delta0 = 0, state = 'liquid', k = 3.5477, a = 0.0897,
-        Cbar = 3.516, elements = {H = 0.125822, C = 0.374852, O = 0.499326}
-    },
+    Methanol =
+        '0.5616682 6.76E-08 791.4 liquid 0.2529 2.7639 0.0897 3.5477 3.516 0 \z
+        H 0.125822 C 0.374852 O 0.499326',
 
     -- Mix D wax
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mix_D_wax.html
-    MixDWax = {
-        ZoA = 0.5646912, x0 = 0.1371, I = 6.09E-08, x1 = 2.7145, density = 990,
-        delta0 = 0, state = 'liquid', k = 3.6823, a = 0.0749, Cbar = 3.078,
-        elements = {O = 0.03502, Mg = 0.038594, H = 0.13404, C = 0.77796,
-        Ti = 0.014386}
-    },
+    MixDWax =
+        '0.5646912 6.09E-08 990 liquid 0.1371 2.7145 0.0749 3.6823 3.078 0 O \z
+        0.03502 Mg 0.038594 H 0.13404 C 0.77796 Ti 0.014386',
 
     -- Mn-dimethyl formamide
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/mn-dimethyl_formamide.html
-    MnDimethylFormamide = {
-        ZoA = 0.5471629, x0 = 0.1977, I = 6.66E-08, x1 = 2.6686,
-        density = 948.7, delta0 = 0, state = 'liquid', k = 3.371, a = 0.1147,
-        Cbar = 3.3311, elements = {O = 0.218887, H = 0.096523, C = 0.492965,
-        N = 0.191625}
-    },
+    MnDimethylFormamide =
+        '0.5471629 6.66E-08 948.7 liquid 0.1977 2.6686 0.1147 3.371 3.3311 0 \z
+        O 0.218887 H 0.096523 C 0.492965 N 0.191625',
 
     -- Molybdenum
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/molybdenum_Mo.html
-    Molybdenum = {
-        ZoA = 0.4377234, x0 = 0.2267, I = 4.24E-07, x1 = 3.2784,
-        density = 10220, delta0 = 0.14, state = 'liquid', k = 3.2549,
-        a = 0.1053, Cbar = 4.8793, elements = {Mo = 1}
-    },
+    Molybdenum =
+        '0.4377234 4.24E-07 10220 liquid 0.2267 3.2784 0.1053 3.2549 4.8793 \z
+        0.14 Mo 1',
 
     -- Moscovium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/moscovium_Mc.html
-    Moscovium = {
-        ZoA = 0.3976569, x0 = 0.696, I = 1.199E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2887, Cbar = 6.7363,
-        elements = {Mc = 1}
-    },
+    Moscovium =
+        '0.3976569 1.199E-06 14000 liquid 0.696 3 0.2887 3 6.7363 0 Mc 1',
 
     -- Ms20 tissue substitute
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ms20_tissue_substitute.html
-    Ms20TissueSubstitute = {
-        ZoA = 0.5387954, x0 = 0.1997, I = 7.51E-08, x1 = 2.8033, density = 1000,
-        delta0 = 0, state = 'liquid', k = 3.6061, a = 0.0829, Cbar = 3.5341,
-        elements = {O = 0.186381, N = 0.017798, Mg = 0.130287, H = 0.081192,
-        C = 0.583442, Cl = 0.0009}
-    },
+    Ms20TissueSubstitute =
+        '0.5387954 7.51E-08 1000 liquid 0.1997 2.8033 0.0829 3.6061 3.5341 0 \z
+        O 0.186381 N 0.017798 Mg 0.130287 H 0.081192 C 0.583442 Cl 0.0009',
 
     -- Muscle-equivalent liquid without sucrose
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/muscle-equivalent_liquid_without_sucrose.html
-    MuscleEquivalentLiquidWithoutSucrose = {
-        ZoA = 0.5500582, x0 = 0.2187, I = 7.42E-08, x1 = 2.768, density = 1070,
-        delta0 = 0, state = 'liquid', k = 3.4982, a = 0.0914, Cbar = 3.4216,
-        elements = {O = 0.742522, H = 0.101969, C = 0.120058, N = 0.035451}
-    },
+    MuscleEquivalentLiquidWithoutSucrose =
+        '0.5500582 7.42E-08 1070 liquid 0.2187 2.768 0.0914 3.4982 3.4216 0 O \z
+        0.742522 H 0.101969 C 0.120058 N 0.035451',
 
     -- Muscle-equivalent liquid with sucrose
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/muscle-equivalent_liquid_with_sucrose.html
-    MuscleEquivalentLiquidWithSucrose = {
-        ZoA = 0.5482054, x0 = 0.2098, I = 7.43E-08, x1 = 2.755, density = 1110,
-        delta0 = 0, state = 'liquid', k = 3.4699, a = 0.0948, Cbar = 3.391,
-        elements = {O = 0.7101, H = 0.098234, C = 0.156214, N = 0.035451}
-    },
+    MuscleEquivalentLiquidWithSucrose =
+        '0.5482054 7.43E-08 1110 liquid 0.2098 2.755 0.0948 3.4699 3.391 0 O \z
+        0.7101 H 0.098234 C 0.156214 N 0.035451',
 
     -- Polyethylene terephthalate Mylar
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyethylene_terephthalate_Mylar.html
-    Mylar = {
-        ZoA = 0.5203444, x0 = 0.1562, I = 7.87E-08, x1 = 2.6507, density = 1400,
-        delta0 = 0, state = 'liquid', k = 3.3076, a = 0.1268, Cbar = 3.3262,
-        elements = {H = 0.041959, C = 0.625017, O = 0.333025}
-    },
+    Mylar =
+        '0.5203444 7.87E-08 1400 liquid 0.1562 2.6507 0.1268 3.3076 3.3262 0 \z
+        H 0.041959 C 0.625017 O 0.333025',
 
     -- Naphtalene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/naphtalene.html
-    Naphtalene = {
-        ZoA = 0.5304906, x0 = 0.1374, I = 6.84E-08, x1 = 2.5429, density = 1145,
-        delta0 = 0, state = 'liquid', k = 3.2654, a = 0.1477, Cbar = 3.2274,
-        elements = {C = 0.937091, H = 0.062909}
-    },
+    Naphtalene =
+        '0.5304906 6.84E-08 1145 liquid 0.1374 2.5429 0.1477 3.2654 3.2274 0 \z
+        C 0.937091 H 0.062909',
 
     -- N-butyl alcohol
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/n-butyl_alcohol.html
-    NButylAlcohol = {
-        ZoA = 0.5665295, x0 = 0.1937, I = 5.99E-08, x1 = 2.6439,
-        density = 809.8, delta0 = 0, state = 'liquid', k = 3.5139, a = 0.1008,
-        Cbar = 3.2425, elements = {H = 0.135978, C = 0.648171, O = 0.215851}
-    },
+    NButylAlcohol =
+        '0.5665295 5.99E-08 809.8 liquid 0.1937 2.6439 0.1008 3.5139 3.2425 0 \z
+        H 0.135978 C 0.648171 O 0.215851',
 
     -- Neodymium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neodymium_Nd.html
-    Neodymium = {
-        ZoA = 0.4159676, x0 = 0.195, I = 5.46E-07, x1 = 3.3029, density = 7008,
-        delta0 = 0.14, state = 'liquid', k = 2.705, a = 0.2353, Cbar = 5.8135,
-        elements = {Nd = 1}
-    },
+    Neodymium =
+        '0.4159676 5.46E-07 7008 liquid 0.195 3.3029 0.2353 2.705 5.8135 0.14 \z
+        Nd 1',
 
     -- Neon gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neon_gas_Ne.html
-    NeonGas = {
-        ZoA = 0.4955451, x0 = 2.0735, I = 1.37E-07, x1 = 4.6421,
-        density = 0.8385, delta0 = 0, state = 'gas', k = 3.5771, a = 0.0806,
-        Cbar = 11.9041, elements = {Ne = 1}
-    },
+    NeonGas =
+        '0.4955451 1.37E-07 0.8385 gas 2.0735 4.6421 0.0806 3.5771 11.9041 0 \z
+        Ne 1',
 
     -- Neptunium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/neptunium_Np.html
-    Neptunium = {
-        ZoA = 0.3923256, x0 = 0.1869, I = 9.02E-07, x1 = 3.369, density = 20250,
-        delta0 = 0.14, state = 'liquid', k = 2.8082, a = 0.1974, Cbar = 5.8149,
-        elements = {Np = 1}
-    },
+    Neptunium =
+        '0.3923256 9.02E-07 20250 liquid 0.1869 3.369 0.1974 2.8082 5.8149 \z
+        0.14 Np 1',
 
     -- N-heptane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/n-heptane.html
-    NHeptane = {
-        ZoA = 0.5787032, x0 = 0.1928, I = 5.44E-08, x1 = 2.5706,
-        density = 683.8, delta0 = 0, state = 'liquid', k = 3.4885, a = 0.1125,
-        Cbar = 3.1978, elements = {C = 0.839063, H = 0.160937}
-    },
+    NHeptane =
+        '0.5787032 5.44E-08 683.8 liquid 0.1928 2.5706 0.1125 3.4885 3.1978 0 \z
+        C 0.839063 H 0.160937',
 
     -- N-hexane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/n-hexane.html
-    NHexane = {
-        ZoA = 0.5800823, x0 = 0.1984, I = 5.4E-08, x1 = 2.5757, density = 660.3,
-        delta0 = 0, state = 'liquid', k = 3.5027, a = 0.1108, Cbar = 3.2156,
-        elements = {C = 0.836259, H = 0.163741}
-    },
+    NHexane =
+        '0.5800823 5.4E-08 660.3 liquid 0.1984 2.5757 0.1108 3.5027 3.2156 0 \z
+        C 0.836259 H 0.163741',
 
     -- Nickel
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nickel_Ni.html
-    Nickel = {
-        ZoA = 0.4770553, x0 = 0.0566, I = 3.11E-07, x1 = 3.1851, density = 8902,
-        delta0 = 0.1, state = 'liquid', k = 2.843, a = 0.165, Cbar = 4.3115,
-        elements = {Ni = 1}
-    },
+    Nickel =
+        '0.4770553 3.11E-07 8902 liquid 0.0566 3.1851 0.165 2.843 4.3115 0.1 \z
+        Ni 1',
 
     -- Nihonium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nihonium_Nh.html
-    Nihonium = {
-        ZoA = 0.3948536, x0 = 0.6818, I = 1.171E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2852, Cbar = 6.6925,
-        elements = {Nh = 1}
-    },
+    Nihonium =
+        '0.3948536 1.171E-06 14000 liquid 0.6818 3 0.2852 3 6.6925 0 Nh 1',
 
     -- Niobium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/niobium_Nb.html
-    Niobium = {
-        ZoA = 0.4413044, x0 = 0.1785, I = 4.17E-07, x1 = 3.2201, density = 8570,
-        delta0 = 0.14, state = 'liquid', k = 3.093, a = 0.1388, Cbar = 5.0141,
-        elements = {Nb = 1}
-    },
+    Niobium =
+        '0.4413044 4.17E-07 8570 liquid 0.1785 3.2201 0.1388 3.093 5.0141 \z
+        0.14 Nb 1',
 
     -- Nitrobenzene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nitrobenzene.html
-    Nitrobenzene = {
-        ZoA = 0.5198277, x0 = 0.1777, I = 7.58E-08, x1 = 2.663, density = 1199,
-        delta0 = 0, state = 'liquid', k = 3.3091, a = 0.1273, Cbar = 3.4073,
-        elements = {O = 0.259918, H = 0.040935, C = 0.585374, N = 0.113773}
-    },
+    Nitrobenzene =
+        '0.5198277 7.58E-08 1199 liquid 0.1777 2.663 0.1273 3.3091 3.4073 0 O \z
+        0.259918 H 0.040935 C 0.585374 N 0.113773',
 
     -- Nitrogen gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nitrogen_gas.html
-    NitrogenGas = {
-        ZoA = 0.499743, x0 = 1.7378, I = 8.2E-08, x1 = 4.1323, density = 1.165,
-        delta0 = 0, state = 'gas', k = 3.2125, a = 0.1535, Cbar = 10.54,
-        elements = {N = 1}
-    },
+    NitrogenGas =
+        '0.499743 8.2E-08 1.165 gas 1.7378 4.1323 0.1535 3.2125 10.54 0 N 1',
 
     -- Nitrous oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nitrous_oxide.html
-    NitrousOxide = {
-        ZoA = 0.4998444, x0 = 1.6477, I = 8.49E-08, x1 = 4.1565,
-        density = 1.831, delta0 = 0, state = 'gas', k = 3.3318, a = 0.1199,
-        Cbar = 10.1575, elements = {O = 0.363517, N = 0.636483}
-    },
+    NitrousOxide =
+        '0.4998444 8.49E-08 1.831 gas 1.6477 4.1565 0.1199 3.3318 10.1575 0 O \z
+        0.363517 N 0.636483',
 
     -- Nobelium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/nobelium_No.html
-    Nobelium = {
-        ZoA = 0.3936689, x0 = 0.595, I = 1.02E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.265, Cbar = 6.4264,
-        elements = {No = 1}
-    },
+    Nobelium =
+        '0.3936689 1.02E-06 14000 liquid 0.595 3 0.265 3 6.4264 0 No 1',
 
     -- N-pentane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/n-pentane.html
-    NPentane = {
-        ZoA = 0.5819974, x0 = 0.2086, I = 5.36E-08, x1 = 2.5855,
-        density = 626.2, delta0 = 0, state = 'liquid', k = 3.5265, a = 0.1081,
-        Cbar = 3.2504, elements = {C = 0.832365, H = 0.167635}
-    },
+    NPentane =
+        '0.5819974 5.36E-08 626.2 liquid 0.2086 2.5855 0.1081 3.5265 3.2504 0 \z
+        C 0.832365 H 0.167635',
 
     -- N-propyl alcohol
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/n-propyl_alcohol.html
-    NPropylAlcohol = {
-        ZoA = 0.5656655, x0 = 0.2046, I = 6.11E-08, x1 = 2.6681,
-        density = 803.5, delta0 = 0, state = 'liquid', k = 3.5415, a = 0.0964,
-        Cbar = 3.2915, elements = {H = 0.134173, C = 0.599595, O = 0.266232}
-    },
+    NPropylAlcohol =
+        '0.5656655 6.11E-08 803.5 liquid 0.2046 2.6681 0.0964 3.5415 3.2915 0 \z
+        H 0.134173 C 0.599595 O 0.266232',
 
     -- Nylon du Pont Elvamide 8062M
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Nylon_du_Pont_Elvamide_8062M.html
-    NylonDuPontElvamide = {
-        ZoA = 0.5505474, x0 = 0.1503, I = 6.43E-08, x1 = 2.6004, density = 1080,
-        delta0 = 0, state = 'liquid', k = 3.4044, a = 0.1151, Cbar = 3.125,
-        elements = {O = 0.148539, H = 0.103509, C = 0.648415, N = 0.099536}
-    },
+    NylonDuPontElvamide =
+        '0.5505474 6.43E-08 1080 liquid 0.1503 2.6004 0.1151 3.4044 3.125 0 O \z
+        0.148539 H 0.103509 C 0.648415 N 0.099536',
 
     -- Nylon type 11 Rilsan
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Nylon_type_11_Rilsan.html
-    NylonType11Rilsan = {
-        ZoA = 0.5564007, x0 = 0.0678, I = 6.16E-08, x1 = 2.4281, density = 1425,
-        delta0 = 0, state = 'liquid', k = 3.2576, a = 0.1487, Cbar = 2.7514,
-        elements = {O = 0.087289, H = 0.115476, C = 0.720819, N = 0.076417}
-    },
+    NylonType11Rilsan =
+        '0.5564007 6.16E-08 1425 liquid 0.0678 2.4281 0.1487 3.2576 2.7514 0 \z
+        O 0.087289 H 0.115476 C 0.720819 N 0.076417',
 
     -- Nylon type 6-10
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Nylon_type_6-10.html
-    NylonType610 = {
-        ZoA = 0.5522787, x0 = 0.1304, I = 6.32E-08, x1 = 2.5681, density = 1140,
-        delta0 = 0, state = 'liquid', k = 3.3912, a = 0.1185, Cbar = 3.0333,
-        elements = {O = 0.1133, H = 0.107062, C = 0.680449, N = 0.099189}
-    },
+    NylonType610 =
+        '0.5522787 6.32E-08 1140 liquid 0.1304 2.5681 0.1185 3.3912 3.0333 0 \z
+        O 0.1133 H 0.107062 C 0.680449 N 0.099189',
 
     -- Nylon type 6 6-6
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/Nylon_type_6_6-6.html
-    NylonType666 = {
-        ZoA = 0.5478279, x0 = 0.1261, I = 6.39E-08, x1 = 2.5759, density = 1180,
-        delta0 = 0, state = 'liquid', k = 3.3826, a = 0.1182, Cbar = 3.0289,
-        elements = {O = 0.141389, H = 0.097976, C = 0.636856, N = 0.123779}
-    },
+    NylonType666 =
+        '0.5478279 6.39E-08 1180 liquid 0.1261 2.5759 0.1182 3.3826 3.0289 0 \z
+        O 0.141389 H 0.097976 C 0.636856 N 0.123779',
 
     -- Octane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/octane.html
-    Octane = {
-        ZoA = 0.5776625, x0 = 0.1882, I = 5.47E-08, x1 = 2.5664,
-        density = 702.6, delta0 = 0, state = 'liquid', k = 3.4776, a = 0.1139,
-        Cbar = 3.1834, elements = {C = 0.841179, H = 0.158821}
-    },
+    Octane =
+        '0.5776625 5.47E-08 702.6 liquid 0.1882 2.5664 0.1139 3.4776 3.1834 0 \z
+        C 0.841179 H 0.158821',
 
     -- Oganesson
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/oganesson_Og.html
-    Oganesson = {
-        ZoA = 0.4010686, x0 = 2.0204, I = 1.242E-06, x1 = 1.9972, density = 12,
-        delta0 = 0, state = 'gas', k = 3, a = 0.0703, Cbar = 13.8662,
-        elements = {Og = 1}
-    },
+    Oganesson =
+        '0.4010686 1.242E-06 12 gas 2.0204 1.9972 0.0703 3 13.8662 0 Og 1',
 
     -- Osmium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/osmium_Os.html
-    Osmium = {
-        ZoA = 0.3995101, x0 = 0.0891, I = 7.46E-07, x1 = 3.5414,
-        density = 22570, delta0 = 0.1, state = 'liquid', k = 2.9608, a = 0.1275,
-        Cbar = 5.3083, elements = {Os = 1}
-    },
+    Osmium =
+        '0.3995101 7.46E-07 22570 liquid 0.0891 3.5414 0.1275 2.9608 5.3083 \z
+        0.1 Os 1',
 
     -- Oxygen gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/oxygen_gas.html
-    OxygenGas = {
-        ZoA = 0.5000219, x0 = 1.7541, I = 9.5E-08, x1 = 4.3213, density = 1.332,
-        delta0 = 0, state = 'gas', k = 3.2913, a = 0.1178, Cbar = 10.7004,
-        elements = {O = 1}
-    },
+    OxygenGas =
+        '0.5000219 9.5E-08 1.332 gas 1.7541 4.3213 0.1178 3.2913 10.7004 0 O \z
+        1',
 
     -- Palladium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/palladium_Pd.html
-    Palladium = {
-        ZoA = 0.4322455, x0 = 0.0563, I = 4.7E-07, x1 = 3.0555, density = 12020,
-        delta0 = 0.14, state = 'liquid', k = 2.7239, a = 0.2418, Cbar = 4.9358,
-        elements = {Pd = 1}
-    },
+    Palladium =
+        '0.4322455 4.7E-07 12020 liquid 0.0563 3.0555 0.2418 2.7239 4.9358 \z
+        0.14 Pd 1',
 
     -- Paraffin
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/paraffin.html
-    Paraffin = {
-        ZoA = 0.572638, x0 = 0.1289, I = 5.59E-08, x1 = 2.5084, density = 930,
-        delta0 = 0, state = 'liquid', k = 3.4288, a = 0.1209, Cbar = 2.9551,
-        elements = {C = 0.851395, H = 0.148605}
-    },
+    Paraffin =
+        '0.572638 5.59E-08 930 liquid 0.1289 2.5084 0.1209 3.4288 2.9551 0 C \z
+        0.851395 H 0.148605',
 
     -- Parylene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/parylene.html
-    Parylene = {
-        ZoA = 0.5376289, x0 = 0.2, I = 6.6E-08, x1 = 2, density = 1060,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.3941, Cbar = 3.2197,
-        elements = {C = 0.922577, H = 0.077423}
-    },
+    Parylene =
+        '0.5376289 6.6E-08 1060 liquid 0.2 2 0.3941 3 3.2197 0 C 0.922577 H \z
+        0.077423',
 
     -- Phosphorus
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/phosphorus_P.html
-    Phosphorus = {
-        ZoA = 0.4842803, x0 = 0.1696, I = 1.73E-07, x1 = 2.7815, density = 2200,
-        delta0 = 0.14, state = 'liquid', k = 2.9158, a = 0.2361, Cbar = 4.5214,
-        elements = {P = 1}
-    },
+    Phosphorus =
+        '0.4842803 1.73E-07 2200 liquid 0.1696 2.7815 0.2361 2.9158 4.5214 \z
+        0.14 P 1',
 
     -- Photographic emulsion
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/photographic_emulsion.html
-    PhotographicEmulsion = {
-        ZoA = 0.4545213, x0 = 0.1009, I = 3.31E-07, x1 = 3.4866, density = 3815,
-        delta0 = 0, state = 'liquid', k = 3.0094, a = 0.124, Cbar = 5.3319,
-        elements = {I = 0.00312, O = 0.066101, S = 0.00189, N = 0.01932,
-        Br = 0.349103, H = 0.0141, C = 0.072261, Ag = 0.474105}
-    },
+    PhotographicEmulsion =
+        '0.4545213 3.31E-07 3815 liquid 0.1009 3.4866 0.124 3.0094 5.3319 0 I \z
+        0.00312 O 0.066101 S 0.00189 N 0.01932 Br 0.349103 H 0.0141 C \z
+        0.072261 Ag 0.474105',
 
     -- Plate glass
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/plate_glass.html
-    PlateGlass = {
-        ZoA = 0.4973163, x0 = 0.1237, I = 1.454E-07, x1 = 3.0649,
-        density = 2400, delta0 = 0, state = 'liquid', k = 3.5381, a = 0.0768,
-        Cbar = 4.0602, elements = {Si = 0.336553, O = 0.4598, Ca = 0.107205,
-        Na = 0.096441}
-    },
+    PlateGlass =
+        '0.4973163 1.454E-07 2400 liquid 0.1237 3.0649 0.0768 3.5381 4.0602 0 \z
+        Si 0.336553 O 0.4598 Ca 0.107205 Na 0.096441',
 
     -- Platinum
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/platinum_Pt.html
-    Platinum = {
-        ZoA = 0.3998257, x0 = 0.1484, I = 7.9E-07, x1 = 3.6212, density = 21450,
-        delta0 = 0.12, state = 'liquid', k = 3.0417, a = 0.1113, Cbar = 5.4732,
-        elements = {Pt = 1}
-    },
+    Platinum =
+        '0.3998257 7.9E-07 21450 liquid 0.1484 3.6212 0.1113 3.0417 5.4732 \z
+        0.12 Pt 1',
 
     -- Plutonium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/plutonium_Pu.html
-    Plutonium = {
-        ZoA = 0.3851449, x0 = 0.1557, I = 9.21E-07, x1 = 3.3981,
-        density = 19840, delta0 = 0.14, state = 'liquid', k = 2.7679,
-        a = 0.2042, Cbar = 5.8748, elements = {Pu = 1}
-    },
+    Plutonium =
+        '0.3851449 9.21E-07 19840 liquid 0.1557 3.3981 0.2042 2.7679 5.8748 \z
+        0.14 Pu 1',
 
     -- Plutonium dioxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/plutonium_dioxide.html
-    PlutoniumDioxide = {
-        ZoA = 0.3987067, x0 = 0.2311, I = 7.465E-07, x1 = 3.5554,
-        density = 11460, delta0 = 0, state = 'liquid', k = 2.6522, a = 0.2059,
-        Cbar = 5.9719, elements = {Pu = 0.881945, O = 0.118055}
-    },
+    PlutoniumDioxide =
+        '0.3987067 7.465E-07 11460 liquid 0.2311 3.5554 0.2059 2.6522 5.9719 \z
+        0 Pu 0.881945 O 0.118055',
 
     -- Polonium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polonium_Po.html
-    Polonium = {
-        ZoA = 0.4019485, x0 = 0.4267, I = 8.3E-07, x1 = 3.8293, density = 9320,
-        delta0 = 0.14, state = 'liquid', k = 3.183, a = 0.0928, Cbar = 6.4003,
-        elements = {Po = 1}
-    },
+    Polonium =
+        '0.4019485 8.3E-07 9320 liquid 0.4267 3.8293 0.0928 3.183 6.4003 0.14 \z
+        Po 1',
 
     -- Polyacrylonitrile
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyacrylonitrile.html
-    Polyacrylonitrile = {
-        ZoA = 0.5276274, x0 = 0.1504, I = 6.96E-08, x1 = 2.5159, density = 1170,
-        delta0 = 0, state = 'liquid', k = 3.1975, a = 0.1628, Cbar = 3.2459,
-        elements = {H = 0.056983, C = 0.679056, N = 0.263962}
-    },
+    Polyacrylonitrile =
+        '0.5276274 6.96E-08 1170 liquid 0.1504 2.5159 0.1628 3.1975 3.2459 0 \z
+        H 0.056983 C 0.679056 N 0.263962',
 
     -- Polycarbonate Lexan
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polycarbonate_Lexan.html
-    PolycarbonateLexan = {
-        ZoA = 0.5269312, x0 = 0.1606, I = 7.31E-08, x1 = 2.6225, density = 1200,
-        delta0 = 0, state = 'liquid', k = 3.3288, a = 0.1286, Cbar = 3.3201,
-        elements = {H = 0.055491, C = 0.755751, O = 0.188758}
-    },
+    PolycarbonateLexan =
+        '0.5269312 7.31E-08 1200 liquid 0.1606 2.6225 0.1286 3.3288 3.3201 0 \z
+        H 0.055491 C 0.755751 O 0.188758',
 
     -- Polychlorostyrene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polychlorostyrene.html
-    Polychlorostyrene = {
-        ZoA = 0.5251321, x0 = 0.1238, I = 8.17E-08, x1 = 2.9241, density = 1300,
-        delta0 = 0, state = 'liquid', k = 3.5441, a = 0.0753, Cbar = 3.4659,
-        elements = {H = 0.061869, C = 0.696325, Cl = 0.241806}
-    },
+    Polychlorostyrene =
+        '0.5251321 8.17E-08 1300 liquid 0.1238 2.9241 0.0753 3.5441 3.4659 0 \z
+        H 0.061869 C 0.696325 Cl 0.241806',
 
     -- Polyethylene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyethylene.html
-    Polyethylene = {
-        ZoA = 0.570231, x0 = 0.1489, I = 5.74E-08, x1 = 2.5296, density = 890,
-        delta0 = 0, state = 'liquid', k = 3.4292, a = 0.1211, Cbar = 3.0563,
-        elements = {C = 0.856289, H = 0.143711}
-    },
+    Polyethylene =
+        '0.570231 5.74E-08 890 liquid 0.1489 2.5296 0.1211 3.4292 3.0563 0 C \z
+        0.856289 H 0.143711',
 
     -- Polyimide film
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyimide_film.html
-    PolyimideFilm = {
-        ZoA = 0.5126286, x0 = 0.1509, I = 7.96E-08, x1 = 2.5631, density = 1420,
-        delta0 = 0, state = 'liquid', k = 3.1921, a = 0.1597, Cbar = 3.3497,
-        elements = {O = 0.209235, H = 0.026362, C = 0.691133, N = 0.07327}
-    },
+    PolyimideFilm =
+        '0.5126286 7.96E-08 1420 liquid 0.1509 2.5631 0.1597 3.1921 3.3497 0 \z
+        O 0.209235 H 0.026362 C 0.691133 N 0.07327',
 
     -- Polyoxymethylene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyoxymethylene.html
-    Polyoxymethylene = {
-        ZoA = 0.5328203, x0 = 0.1584, I = 7.74E-08, x1 = 2.6838, density = 1425,
-        delta0 = 0, state = 'liquid', k = 3.4002, a = 0.1081, Cbar = 3.2514,
-        elements = {H = 0.067135, C = 0.400017, O = 0.532848}
-    },
+    Polyoxymethylene =
+        '0.5328203 7.74E-08 1425 liquid 0.1584 2.6838 0.1081 3.4002 3.2514 0 \z
+        H 0.067135 C 0.400017 O 0.532848',
 
     -- Polypropylene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polypropylene.html
-    Polypropylene = {
-        ZoA = 0.570231, x0 = 0.1452, I = 5.74E-08, x1 = 2.5259, density = 905,
-        delta0 = 0, state = 'liquid', k = 3.4292, a = 0.1211, Cbar = 3.0395,
-        elements = {C = 0.856289, H = 0.143711}
-    },
+    Polypropylene =
+        '0.570231 5.74E-08 905 liquid 0.1452 2.5259 0.1211 3.4292 3.0395 0 C \z
+        0.856289 H 0.143711',
 
     -- Polystyrene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polystyrene.html
-    Polystyrene = {
-        ZoA = 0.5376265, x0 = 0.1647, I = 6.87E-08, x1 = 2.5031, density = 1060,
-        delta0 = 0, state = 'liquid', k = 3.2224, a = 0.1645, Cbar = 3.2999,
-        elements = {C = 0.922582, H = 0.077418}
-    },
+    Polystyrene =
+        '0.5376265 6.87E-08 1060 liquid 0.1647 2.5031 0.1645 3.2224 3.2999 0 \z
+        C 0.922582 H 0.077418',
 
     -- Polytrifluorochloroethylene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polytrifluorochloroethylene.html
-    Polytrifluorochloroethylene = {
-        ZoA = 0.4808101, x0 = 0.1714, I = 1.207E-07, x1 = 3.0265,
-        density = 2100, delta0 = 0, state = 'liquid', k = 3.5085, a = 0.0773,
-        Cbar = 3.8551, elements = {F = 0.489354, C = 0.20625, Cl = 0.304395}
-    },
+    Polytrifluorochloroethylene =
+        '0.4808101 1.207E-07 2100 liquid 0.1714 3.0265 0.0773 3.5085 3.8551 0 \z
+        F 0.489354 C 0.20625 Cl 0.304395',
 
     -- Polyvinylacetate
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinylacetate.html
-    Polyvinylacetate = {
-        ZoA = 0.5342739, x0 = 0.1769, I = 7.37E-08, x1 = 2.6747, density = 1190,
-        delta0 = 0, state = 'liquid', k = 3.3762, a = 0.1144, Cbar = 3.3309,
-        elements = {H = 0.070245, C = 0.558066, O = 0.371689}
-    },
+    Polyvinylacetate =
+        '0.5342739 7.37E-08 1190 liquid 0.1769 2.6747 0.1144 3.3762 3.3309 0 \z
+        H 0.070245 C 0.558066 O 0.371689',
 
     -- Polyvinyl alcohol
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinyl_alcohol.html
-    PolyvinylAlcohol = {
-        ZoA = 0.544732, x0 = 0.1401, I = 6.97E-08, x1 = 2.6315, density = 1300,
-        delta0 = 0, state = 'liquid', k = 3.3893, a = 0.1118, Cbar = 3.1115,
-        elements = {H = 0.091517, C = 0.545298, O = 0.363185}
-    },
+    PolyvinylAlcohol =
+        '0.544732 6.97E-08 1300 liquid 0.1401 2.6315 0.1118 3.3893 3.1115 0 H \z
+        0.091517 C 0.545298 O 0.363185',
 
     -- Polyvinyl butyral
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinyl_butyral.html
-    PolyvinylButyral = {
-        ZoA = 0.5452996, x0 = 0.1555, I = 6.72E-08, x1 = 2.6186, density = 1120,
-        delta0 = 0, state = 'liquid', k = 3.3983, a = 0.1154, Cbar = 3.1865,
-        elements = {H = 0.092802, C = 0.680561, O = 0.226637}
-    },
+    PolyvinylButyral =
+        '0.5452996 6.72E-08 1120 liquid 0.1555 2.6186 0.1154 3.3983 3.1865 0 \z
+        H 0.092802 C 0.680561 O 0.226637',
 
     -- Polyvinylidene chloride Saran
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinylidene_chloride_Saran.html
-    PolyvinylideneChloride = {
-        ZoA = 0.4951152, x0 = 0.1314, I = 1.343E-07, x1 = 2.9009,
-        density = 1700, delta0 = 0, state = 'liquid', k = 3.102, a = 0.1547,
-        Cbar = 4.2506, elements = {H = 0.020793, C = 0.247793, Cl = 0.731413}
-    },
+    PolyvinylideneChloride =
+        '0.4951152 1.343E-07 1700 liquid 0.1314 2.9009 0.1547 3.102 4.2506 0 \z
+        H 0.020793 C 0.247793 Cl 0.731413',
 
     -- Polyvinylidene fluoride
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinylidene_fluoride.html
-    PolyvinylideneFluoride = {
-        ZoA = 0.4997083, x0 = 0.1717, I = 8.88E-08, x1 = 2.7375, density = 1760,
-        delta0 = 0, state = 'liquid', k = 3.42, a = 0.1032, Cbar = 3.3793,
-        elements = {H = 0.03148, C = 0.375141, F = 0.593379}
-    },
+    PolyvinylideneFluoride =
+        '0.4997083 8.88E-08 1760 liquid 0.1717 2.7375 0.1032 3.42 3.3793 0 H \z
+        0.03148 C 0.375141 F 0.593379',
 
     -- Polyvinyl pyrrolidone
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinyl_pyrrolidone.html
-    PolyvinylPyrrolidone = {
-        ZoA = 0.5397833, x0 = 0.1324, I = 6.77E-08, x1 = 2.5867, density = 1250,
-        delta0 = 0, state = 'liquid', k = 3.3326, a = 0.125, Cbar = 3.1017,
-        elements = {O = 0.143953, H = 0.081616, C = 0.648407, N = 0.126024}
-    },
+    PolyvinylPyrrolidone =
+        '0.5397833 6.77E-08 1250 liquid 0.1324 2.5867 0.125 3.3326 3.1017 0 O \z
+        0.143953 H 0.081616 C 0.648407 N 0.126024',
 
     -- Polyvinyltoluene
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinyltoluene.html
-    Polyvinyltoluene = {
-        ZoA = 0.5413555, x0 = 0.1464, I = 6.47E-08, x1 = 2.4855, density = 1032,
-        delta0 = 0, state = 'liquid', k = 3.2393, a = 0.161, Cbar = 3.1997,
-        elements = {C = 0.915, H = 0.085}
-    },
+    Polyvinyltoluene =
+        '0.5413555 6.47E-08 1032 liquid 0.1464 2.4855 0.161 3.2393 3.1997 0 C \z
+        0.915 H 0.085',
 
     -- Potassium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/potassium_K.html
-    Potassium = {
-        ZoA = 0.4859546, x0 = 0.3851, I = 1.9E-07, x1 = 3.1724, density = 862,
-        delta0 = 0.1, state = 'liquid', k = 2.9233, a = 0.1983, Cbar = 5.6423,
-        elements = {K = 1}
-    },
+    Potassium =
+        '0.4859546 1.9E-07 862 liquid 0.3851 3.1724 0.1983 2.9233 5.6423 0.1 \z
+        K 1',
 
     -- Potassium iodide KI
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/potassium_iodide_KI.html
-    PotassiumIodide = {
-        ZoA = 0.4337289, x0 = 0.1044, I = 4.319E-07, x1 = 3.3442,
-        density = 3130, delta0 = 0, state = 'liquid', k = 2.7558, a = 0.2205,
-        Cbar = 6.1088, elements = {K = 0.235528, I = 0.764472}
-    },
+    PotassiumIodide =
+        '0.4337289 4.319E-07 3130 liquid 0.1044 3.3442 0.2205 2.7558 6.1088 0 \z
+        K 0.235528 I 0.764472',
 
     -- Potassium oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/potassium_oxide.html
-    PotassiumOxide = {
-        ZoA = 0.488344, x0 = 0.048, I = 1.899E-07, x1 = 3.011, density = 2320,
-        delta0 = 0, state = 'liquid', k = 3.0121, a = 0.1679, Cbar = 4.6463,
-        elements = {K = 0.830148, O = 0.169852}
-    },
+    PotassiumOxide =
+        '0.488344 1.899E-07 2320 liquid 0.048 3.011 0.1679 3.0121 4.6463 0 K \z
+        0.830148 O 0.169852',
 
     -- Praseodymium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/praseodymium_Pr.html
-    Praseodymium = {
-        ZoA = 0.4187129, x0 = 0.2313, I = 5.35E-07, x1 = 3.2753, density = 6773,
-        delta0 = 0.14, state = 'liquid', k = 2.7331, a = 0.2326, Cbar = 5.8003,
-        elements = {Pr = 1}
-    },
+    Praseodymium =
+        '0.4187129 5.35E-07 6773 liquid 0.2313 3.2753 0.2326 2.7331 5.8003 \z
+        0.14 Pr 1',
 
     -- Promethium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/promethium_Pm.html
-    Promethium = {
-        ZoA = 0.4209422, x0 = 0.1614, I = 5.6E-07, x1 = 3.3186, density = 7264,
-        delta0 = 0.14, state = 'liquid', k = 2.6674, a = 0.2428, Cbar = 5.8163,
-        elements = {Pm = 1}
-    },
+    Promethium =
+        '0.4209422 5.6E-07 7264 liquid 0.1614 3.3186 0.2428 2.6674 5.8163 \z
+        0.14 Pm 1',
 
     -- Propane
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/propane.html
-    Propane = {
-        ZoA = 0.589483, x0 = 1.4339, I = 4.71E-08, x1 = 3.8011, density = 1.868,
-        delta0 = 0, state = 'gas', k = 3.592, a = 0.0992, Cbar = 8.7939,
-        elements = {C = 0.817145, H = 0.182855}
-    },
+    Propane =
+        '0.589483 4.71E-08 1.868 gas 1.4339 3.8011 0.0992 3.592 8.7939 0 C \z
+        0.817145 H 0.182855',
 
     -- Protactinium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/protactinium_Pa.html
-    Protactinium = {
-        ZoA = 0.393878, x0 = 0.3144, I = 8.78E-07, x1 = 3.5079, density = 15370,
-        delta0 = 0.14, state = 'liquid', k = 2.9845, a = 0.1477, Cbar = 6.0327,
-        elements = {Pa = 1}
-    },
+    Protactinium =
+        '0.393878 8.78E-07 15370 liquid 0.3144 3.5079 0.1477 2.9845 6.0327 \z
+        0.14 Pa 1',
 
     -- Polyvinylchloride PVC
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polyvinylchloride_PVC.html
-    PVC = {
-        ZoA = 0.5119741, x0 = 0.1559, I = 1.082E-07, x1 = 2.9415,
-        density = 1300, delta0 = 0, state = 'liquid', k = 3.2104, a = 0.1244,
-        Cbar = 4.0532, elements = {H = 0.04838, C = 0.38436, Cl = 0.56726}
-    },
+    PVC =
+        '0.5119741 1.082E-07 1300 liquid 0.1559 2.9415 0.1244 3.2104 4.0532 0 \z
+        H 0.04838 C 0.38436 Cl 0.56726',
 
     -- Pyridine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/pyridine.html
-    Pyridine = {
-        ZoA = 0.5309187, x0 = 0.167, I = 6.62E-08, x1 = 2.5245, density = 981.9,
-        delta0 = 0, state = 'liquid', k = 3.1977, a = 0.164, Cbar = 3.3148,
-        elements = {H = 0.06371, C = 0.759217, N = 0.177073}
-    },
+    Pyridine =
+        '0.5309187 6.62E-08 981.9 liquid 0.167 2.5245 0.164 3.1977 3.3148 0 H \z
+        0.06371 C 0.759217 N 0.177073',
 
     -- Radium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/radium_Ra.html
-    Radium = {
-        ZoA = 0.3893375, x0 = 0.5991, I = 8.26E-07, x1 = 3.9428, density = 5000,
-        delta0 = 0.14, state = 'liquid', k = 3.2454, a = 0.088, Cbar = 7.0452,
-        elements = {Ra = 1}
-    },
+    Radium =
+        '0.3893375 8.26E-07 5000 liquid 0.5991 3.9428 0.088 3.2454 7.0452 \z
+        0.14 Ra 1',
 
     -- Radon
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/radon_Rn.html
-    Radon = {
-        ZoA = 0.387356, x0 = 1.5368, I = 7.94E-07, x1 = 4.9889, density = 9.066,
-        delta0 = 0, state = 'gas', k = 2.7409, a = 0.208, Cbar = 13.2839,
-        elements = {Rn = 1}
-    },
+    Radon =
+        '0.387356 7.94E-07 9.066 gas 1.5368 4.9889 0.208 2.7409 13.2839 0 Rn \z
+        1',
 
     -- Rhenium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rhenium_Re.html
-    Rhenium = {
-        ZoA = 0.4027776, x0 = 0.0559, I = 7.36E-07, x1 = 3.4845,
-        density = 21020, delta0 = 0.08, state = 'liquid', k = 2.8627,
-        a = 0.1518, Cbar = 5.3445, elements = {Re = 1}
-    },
+    Rhenium =
+        '0.4027776 7.36E-07 21020 liquid 0.0559 3.4845 0.1518 2.8627 5.3445 \z
+        0.08 Re 1',
 
     -- Rhodium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rhodium_Rh.html
-    Rhodium = {
-        ZoA = 0.4372923, x0 = 0.0576, I = 4.49E-07, x1 = 3.1069,
-        density = 12410, delta0 = 0.14, state = 'liquid', k = 2.8633, a = 0.192,
-        Cbar = 4.8008, elements = {Rh = 1}
-    },
+    Rhodium =
+        '0.4372923 4.49E-07 12410 liquid 0.0576 3.1069 0.192 2.8633 4.8008 \z
+        0.14 Rh 1',
 
     -- Roentgenium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/roentgenium_Rg.html
-    Roentgenium = {
-        ZoA = 0.3933813, x0 = 0.6672, I = 1.143E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2816, Cbar = 6.6477,
-        elements = {Rg = 1}
-    },
+    Roentgenium =
+        '0.3933813 1.143E-06 14000 liquid 0.6672 3 0.2816 3 6.6477 0 Rg 1',
 
     -- Rubber butyl
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rubber_butyl.html
-    RubberButyl = {
-        ZoA = 0.570231, x0 = 0.1347, I = 5.65E-08, x1 = 2.5154, density = 920,
-        delta0 = 0, state = 'liquid', k = 3.4296, a = 0.1211, Cbar = 2.9915,
-        elements = {C = 0.856289, H = 0.143711}
-    },
+    RubberButyl =
+        '0.570231 5.65E-08 920 liquid 0.1347 2.5154 0.1211 3.4296 2.9915 0 C \z
+        0.856289 H 0.143711',
 
     -- Rubber natural
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rubber_natural.html
-    RubberNatural = {
-        ZoA = 0.5577682, x0 = 0.1512, I = 5.98E-08, x1 = 2.4815, density = 920,
-        delta0 = 0, state = 'liquid', k = 3.2879, a = 0.1506, Cbar = 3.1272,
-        elements = {C = 0.881629, H = 0.118371}
-    },
+    RubberNatural =
+        '0.5577682 5.98E-08 920 liquid 0.1512 2.4815 0.1506 3.2879 3.1272 0 C \z
+        0.881629 H 0.118371',
 
     -- Rubber neoprene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rubber_neoprene.html
-    RubberNeoprene = {
-        ZoA = 0.5195184, x0 = 0.1501, I = 9.3E-08, x1 = 2.9461, density = 1230,
-        delta0 = 0, state = 'liquid', k = 3.3632, a = 0.0976, Cbar = 3.7911,
-        elements = {H = 0.05692, C = 0.542646, Cl = 0.400434}
-    },
+    RubberNeoprene =
+        '0.5195184 9.3E-08 1230 liquid 0.1501 2.9461 0.0976 3.3632 3.7911 0 H \z
+        0.05692 C 0.542646 Cl 0.400434',
 
     -- Rubidium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rubidium_Rb.html
-    Rubidium = {
-        ZoA = 0.4329116, x0 = 0.5737, I = 3.63E-07, x1 = 3.7995, density = 1532,
-        delta0 = 0.14, state = 'liquid', k = 3.4177, a = 0.0726, Cbar = 6.4776,
-        elements = {Rb = 1}
-    },
+    Rubidium =
+        '0.4329116 3.63E-07 1532 liquid 0.5737 3.7995 0.0726 3.4177 6.4776 \z
+        0.14 Rb 1',
 
     -- Ruthenium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ruthenium_Ru.html
-    Ruthenium = {
-        ZoA = 0.4353332, x0 = 0.0599, I = 4.41E-07, x1 = 3.0834,
-        density = 12410, delta0 = 0.14, state = 'liquid', k = 2.8707,
-        a = 0.1934, Cbar = 4.7694, elements = {Ru = 1}
-    },
+    Ruthenium =
+        '0.4353332 4.41E-07 12410 liquid 0.0599 3.0834 0.1934 2.8707 4.7694 \z
+        0.14 Ru 1',
 
     -- Rutherfordium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/rutherfordium_Rf.html
-    Rutherfordium = {
-        ZoA = 0.3893352, x0 = 0.6157, I = 1.047E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2696, Cbar = 6.4898,
-        elements = {Rf = 1}
-    },
+    Rutherfordium =
+        '0.3893352 1.047E-06 14000 liquid 0.6157 3 0.2696 3 6.4898 0 Rf 1',
 
     -- Samarium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/samarium_Sm.html
-    Samarium = {
-        ZoA = 0.4123382, x0 = 0.1503, I = 5.74E-07, x1 = 3.3443, density = 7520,
-        delta0 = 0.14, state = 'liquid', k = 2.6403, a = 0.247, Cbar = 5.8517,
-        elements = {Sm = 1}
-    },
+    Samarium =
+        '0.4123382 5.74E-07 7520 liquid 0.1503 3.3443 0.247 2.6403 5.8517 \z
+        0.14 Sm 1',
 
     -- Scandium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/scandium_Sc.html
-    Scandium = {
-        ZoA = 0.4671244, x0 = 0.164, I = 2.16E-07, x1 = 3.0593, density = 2989,
-        delta0 = 0.1, state = 'liquid', k = 3.0517, a = 0.1575, Cbar = 4.6949,
-        elements = {Sc = 1}
-    },
+    Scandium =
+        '0.4671244 2.16E-07 2989 liquid 0.164 3.0593 0.1575 3.0517 4.6949 0.1 \z
+        Sc 1',
 
     -- Seaborgium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/seaborgium_Sg.html
-    Seaborgium = {
-        ZoA = 0.3938632, x0 = 0.6309, I = 1.074E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2731, Cbar = 6.5365,
-        elements = {Sg = 1}
-    },
+    Seaborgium =
+        '0.3938632 1.074E-06 14000 liquid 0.6309 3 0.2731 3 6.5365 0 Sg 1',
 
     -- Selenium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/selenium_Se.html
-    Selenium = {
-        ZoA = 0.4305334, x0 = 0.2258, I = 3.48E-07, x1 = 3.6264, density = 4500,
-        delta0 = 0.1, state = 'liquid', k = 3.4317, a = 0.0657, Cbar = 5.321,
-        elements = {Se = 1}
-    },
+    Selenium =
+        '0.4305334 3.48E-07 4500 liquid 0.2258 3.6264 0.0657 3.4317 5.321 0.1 \z
+        Se 1',
 
     -- Shielding concrete
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/shielding_concrete.html
-    ShieldingConcrete = {
-        ZoA = 0.5027312, x0 = 0.1301, I = 1.352E-07, x1 = 3.0466,
-        density = 2300, delta0 = 0, state = 'liquid', k = 3.5467, a = 0.0751,
-        Cbar = 3.9464, elements = {K = 0.013, O = 0.529107, Al = 0.033872,
-        Si = 0.337021, Fe = 0.014, Na = 0.016, Ca = 0.044, Mg = 0.002,
-        C = 0.001, H = 0.01}
-    },
+    ShieldingConcrete =
+        '0.5027312 1.352E-07 2300 liquid 0.1301 3.0466 0.0751 3.5467 3.9464 0 \z
+        K 0.013 O 0.529107 Al 0.033872 Si 0.337021 Fe 0.014 Na 0.016 Ca 0.044 \z
+        Mg 0.002 C 0.001 H 0.01',
 
     -- Silica aerogel
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silica_aerogel.html
-    SilicaAerogel = {
-        ZoA = 0.5009712, x0 = 0.6029, I = 1.392E-07, x1 = 3, density = 200,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2668, Cbar = 6.4507,
-        elements = {Si = 0.453451, O = 0.543192, H = 0.003357}
-    },
+    SilicaAerogel =
+        '0.5009712 1.392E-07 200 liquid 0.6029 3 0.2668 3 6.4507 0 Si \z
+        0.453451 O 0.543192 H 0.003357',
 
     -- Silicon
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silicon_Si.html
-    Silicon = {
-        ZoA = 0.4984779, x0 = 0.2015, I = 1.73E-07, x1 = 2.8716, density = 2329,
-        delta0 = 0.14, state = 'liquid', k = 3.2546, a = 0.1492, Cbar = 4.4355,
-        elements = {Si = 1}
-    },
+    Silicon =
+        '0.4984779 1.73E-07 2329 liquid 0.2015 2.8716 0.1492 3.2546 4.4355 \z
+        0.14 Si 1',
 
     -- Silicon dioxide fused quartz
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silicon_dioxide_fused_quartz.html
-    SiliconDioxide = {
-        ZoA = 0.4993001, x0 = 0.15, I = 1.392E-07, x1 = 3.014, density = 2200,
-        delta0 = 0, state = 'liquid', k = 3.5064, a = 0.0841, Cbar = 4.056,
-        elements = {Si = 0.467435, O = 0.532565}
-    },
+    SiliconDioxide =
+        '0.4993001 1.392E-07 2200 liquid 0.15 3.014 0.0841 3.5064 4.056 0 Si \z
+        0.467435 O 0.532565',
 
     -- Silver
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silver_Ag.html
-    Silver = {
-        ZoA = 0.4357177, x0 = 0.0657, I = 4.7E-07, x1 = 3.1074, density = 10500,
-        delta0 = 0.14, state = 'liquid', k = 2.6899, a = 0.2458, Cbar = 5.063,
-        elements = {Ag = 1}
-    },
+    Silver =
+        '0.4357177 4.7E-07 10500 liquid 0.0657 3.1074 0.2458 2.6899 5.063 \z
+        0.14 Ag 1',
 
     -- Silver bromide AgBr
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silver_bromide_AgBr.html
-    SilverBromide = {
-        ZoA = 0.4366996, x0 = 0.0352, I = 4.866E-07, x1 = 3.2109,
-        density = 6473, delta0 = 0, state = 'liquid', k = 2.682, a = 0.2458,
-        Cbar = 5.6139, elements = {Br = 0.425537, Ag = 0.574463}
-    },
+    SilverBromide =
+        '0.4366996 4.866E-07 6473 liquid 0.0352 3.2109 0.2458 2.682 5.6139 0 \z
+        Br 0.425537 Ag 0.574463',
 
     -- Silver chloride AgCl
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silver_chloride_AgCl.html
-    SilverChloride = {
-        ZoA = 0.4465494, x0 = 0.0139, I = 3.984E-07, x1 = 3.2022,
-        density = 5560, delta0 = 0, state = 'liquid', k = 2.7041, a = 0.2297,
-        Cbar = 5.3437, elements = {Ag = 0.752632, Cl = 0.247368}
-    },
+    SilverChloride =
+        '0.4465494 3.984E-07 5560 liquid 0.0139 3.2022 0.2297 2.7041 5.3437 0 \z
+        Ag 0.752632 Cl 0.247368',
 
     -- Silver iodide AgI
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/silver_iodide_AgI.html
-    SilverIodide = {
-        ZoA = 0.4259452, x0 = 0.0148, I = 5.435E-07, x1 = 3.2908,
-        density = 6010, delta0 = 0, state = 'liquid', k = 2.6572, a = 0.2506,
-        Cbar = 5.9342, elements = {I = 0.540542, Ag = 0.459458}
-    },
+    SilverIodide =
+        '0.4259452 5.435E-07 6010 liquid 0.0148 3.2908 0.2506 2.6572 5.9342 0 \z
+        I 0.540542 Ag 0.459458',
 
     -- Skeletal muscle ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/skeletal_muscle_ICRP.html
-    SkeletalMuscle = {
-        ZoA = 0.5493013, x0 = 0.2282, I = 7.53E-08, x1 = 2.7999, density = 1040,
-        delta0 = 0, state = 'liquid', k = 3.533, a = 0.0864, Cbar = 3.4809,
-        elements = {K = 0.00302, O = 0.754773, S = 0.00241, H = 0.100637,
-        P = 0.0018, Fe = 4E-05, Zn = 5E-05, Ca = 3E-05, Na = 0.00075,
-        Cl = 0.00079, Mg = 0.00019, C = 0.10783, N = 0.02768}
-    },
+    SkeletalMuscle =
+        '0.5493013 7.53E-08 1040 liquid 0.2282 2.7999 0.0864 3.533 3.4809 0 K \z
+        0.00302 O 0.754773 S 0.00241 H 0.100637 P 0.0018 Fe 4E-05 Zn 5E-05 Ca \z
+        3E-05 Na 0.00075 Cl 0.00079 Mg 0.00019 C 0.10783 N 0.02768',
 
     -- Skin ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/skin_ICRP.html
-    Skin = {
-        ZoA = 0.5492492, x0 = 0.2019, I = 7.27E-08, x1 = 2.7526, density = 1100,
-        delta0 = 0, state = 'liquid', k = 3.4643, a = 0.0946, Cbar = 3.3546,
-        elements = {K = 0.00085, O = 0.619002, S = 0.00159, H = 0.100588,
-        P = 0.00033, Fe = 1E-05, Zn = 1E-05, Ca = 0.00015, Na = 7E-05,
-        Cl = 0.00267, Mg = 6E-05, C = 0.22825, N = 0.04642}
-    },
+    Skin =
+        '0.5492492 7.27E-08 1100 liquid 0.2019 2.7526 0.0946 3.4643 3.3546 0 \z
+        K 0.00085 O 0.619002 S 0.00159 H 0.100588 P 0.00033 Fe 1E-05 Zn 1E-05 \z
+        Ca 0.00015 Na 7E-05 Cl 0.00267 Mg 6E-05 C 0.22825 N 0.04642',
 
     -- Sodium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_Na.html
-    Sodium = {
-        ZoA = 0.4784731, x0 = 0.288, I = 1.49E-07, x1 = 3.1962, density = 971,
-        delta0 = 0.08, state = 'liquid', k = 3.6452, a = 0.0777, Cbar = 5.0526,
-        elements = {Na = 1}
-    },
+    Sodium =
+        '0.4784731 1.49E-07 971 liquid 0.288 3.1962 0.0777 3.6452 5.0526 0.08 \z
+        Na 1',
 
     -- Sodium carbonate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_carbonate.html
-    SodiumCarbonate = {
-        ZoA = 0.4906197, x0 = 0.1287, I = 1.25E-07, x1 = 2.8591, density = 2532,
-        delta0 = 0, state = 'liquid', k = 3.5638, a = 0.0872, Cbar = 3.7178,
-        elements = {O = 0.452861, C = 0.113323, Na = 0.433815}
-    },
+    SodiumCarbonate =
+        '0.4906197 1.25E-07 2532 liquid 0.1287 2.8591 0.0872 3.5638 3.7178 0 \z
+        O 0.452861 C 0.113323 Na 0.433815',
 
     -- Sodium chloride NaCl
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_chloride_NaCl.html
-    SodiumChloride = {
-        ZoA = 0.4790998, x0 = 0.1995, I = 1.753E-07, x1 = 2.9995,
-        density = 2170, delta0 = 0, state = 'liquid', k = 3, a = 0.1596,
-        Cbar = 4.4227, elements = {Cl = 0.606626, Na = 0.393375}
-    },
+    SodiumChloride =
+        '0.4790998 1.753E-07 2170 liquid 0.1995 2.9995 0.1596 3 4.4227 0 Cl \z
+        0.606626 Na 0.393375',
 
     -- Sodium iodide NaI
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_iodide_NaI.html
-    SodiumIodide = {
-        ZoA = 0.4269689, x0 = 0.1203, I = 4.52E-07, x1 = 3.592, density = 3667,
-        delta0 = 0, state = 'liquid', k = 3.0398, a = 0.1252, Cbar = 6.0572,
-        elements = {I = 0.846627, Na = 0.153373}
-    },
+    SodiumIodide =
+        '0.4269689 4.52E-07 3667 liquid 0.1203 3.592 0.1252 3.0398 6.0572 0 I \z
+        0.846627 Na 0.153373',
 
     -- Sodium monoxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_monoxide.html
-    SodiumMonoxide = {
-        ZoA = 0.4840357, x0 = 0.1652, I = 1.488E-07, x1 = 2.9793,
-        density = 2270, delta0 = 0, state = 'liquid', k = 3.6943, a = 0.075,
-        Cbar = 4.1892, elements = {Na = 0.741857, O = 0.258143}
-    },
+    SodiumMonoxide =
+        '0.4840357 1.488E-07 2270 liquid 0.1652 2.9793 0.075 3.6943 4.1892 0 \z
+        Na 0.741857 O 0.258143',
 
     -- Sodium nitrate
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sodium_nitrate.html
-    SodiumNitrate = {
-        ZoA = 0.4941473, x0 = 0.1534, I = 1.146E-07, x1 = 2.8221,
-        density = 2261, delta0 = 0, state = 'liquid', k = 3.5097, a = 0.0939,
-        Cbar = 3.6502, elements = {O = 0.56472, Na = 0.270485, N = 0.164795}
-    },
+    SodiumNitrate =
+        '0.4941473 1.146E-07 2261 liquid 0.1534 2.8221 0.0939 3.5097 3.6502 0 \z
+        O 0.56472 Na 0.270485 N 0.164795',
 
     -- Soft tissue ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/soft_tissue_ICRP.html
-    SoftTissue = {
-        ZoA = 0.5511313, x0 = 0.2211, I = 7.23E-08, x1 = 2.7799, density = 1000,
-        delta0 = 0, state = 'liquid', k = 3.511, a = 0.0893, Cbar = 3.4354,
-        elements = {K = 0.00199, O = 0.630238, S = 0.00199, H = 0.104472,
-        P = 0.00133, Fe = 5E-05, Zn = 3E-05, Ca = 0.00023, Na = 0.00113,
-        Cl = 0.00134, Mg = 0.00013, C = 0.23219, N = 0.02488}
-    },
+    SoftTissue =
+        '0.5511313 7.23E-08 1000 liquid 0.2211 2.7799 0.0893 3.511 3.4354 0 K \z
+        0.00199 O 0.630238 S 0.00199 H 0.104472 P 0.00133 Fe 5E-05 Zn 3E-05 \z
+        Ca 0.00023 Na 0.00113 Cl 0.00134 Mg 0.00013 C 0.23219 N 0.02488',
 
     -- Soft tissue ICRU four-component
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/soft_tissue_ICRU_four-component.html
-    SoftTissueICRUFourComponent = {
-        ZoA = 0.5496735, x0 = 0.2377, I = 7.49E-08, x1 = 2.7908, density = 1000,
-        delta0 = 0, state = 'liquid', k = 3.4371, a = 0.0963, Cbar = 3.5087,
-        elements = {O = 0.761828, H = 0.101172, C = 0.111, N = 0.026}
-    },
+    SoftTissueICRUFourComponent =
+        '0.5496735 7.49E-08 1000 liquid 0.2377 2.7908 0.0963 3.4371 3.5087 0 \z
+        O 0.761828 H 0.101172 C 0.111 N 0.026',
 
     -- Standard rock
     -- Category: mixtures
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/standard_rock.html
-    StandardRock = {
-        ZoA = 0.5, x0 = 0.0492, I = 1.364E-07, x1 = 3.0549, density = 2650,
-        delta0 = 0, state = 'liquid', k = 3.412, a = 0.083, Cbar = 3.7738,
-        elements = {Rk = 1}
-    },
+    StandardRock =
+        '0.5 1.364E-07 2650 liquid 0.0492 3.0549 0.083 3.412 3.7738 0 Rk 1',
 
     -- Stilbene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/stilbene.html
-    Stilbene = {
-        ZoA = 0.5325523, x0 = 0.1734, I = 6.77E-08, x1 = 2.5142,
-        density = 970.7, delta0 = 0, state = 'liquid', k = 3.2168, a = 0.1666,
-        Cbar = 3.368, elements = {C = 0.932899, H = 0.067101}
-    },
+    Stilbene =
+        '0.5325523 6.77E-08 970.7 liquid 0.1734 2.5142 0.1666 3.2168 3.368 0 \z
+        C 0.932899 H 0.067101',
 
     -- Striated muscle ICRU
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/striated_muscle_ICRU.html
-    StriatedMuscle = {
-        ZoA = 0.5509452, x0 = 0.2249, I = 7.47E-08, x1 = 2.8032, density = 1040,
-        delta0 = 0, state = 'liquid', k = 3.5383, a = 0.0851, Cbar = 3.4636,
-        elements = {K = 0.005, O = 0.729003, S = 0.005, H = 0.101997, P = 0.002,
-        Na = 0.0008, Mg = 0.0002, C = 0.123, N = 0.035}
-    },
+    StriatedMuscle =
+        '0.5509452 7.47E-08 1040 liquid 0.2249 2.8032 0.0851 3.5383 3.4636 0 \z
+        K 0.005 O 0.729003 S 0.005 H 0.101997 P 0.002 Na 0.0008 Mg 0.0002 C \z
+        0.123 N 0.035',
 
     -- Strontium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/strontium_Sr.html
-    Strontium = {
-        ZoA = 0.433686, x0 = 0.4585, I = 3.66E-07, x1 = 3.6778, density = 2540,
-        delta0 = 0.14, state = 'liquid', k = 3.4435, a = 0.0716, Cbar = 5.9867,
-        elements = {Sr = 1}
-    },
+    Strontium =
+        '0.433686 3.66E-07 2540 liquid 0.4585 3.6778 0.0716 3.4435 5.9867 \z
+        0.14 Sr 1',
 
     -- Sucrose
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sucrose.html
-    Sucrose = {
-        ZoA = 0.5316527, x0 = 0.1341, I = 7.75E-08, x1 = 2.6558, density = 1581,
-        delta0 = 0, state = 'liquid', k = 3.363, a = 0.113, Cbar = 3.1526,
-        elements = {H = 0.064779, C = 0.42107, O = 0.514151}
-    },
+    Sucrose =
+        '0.5316527 7.75E-08 1581 liquid 0.1341 2.6558 0.113 3.363 3.1526 0 H \z
+        0.064779 C 0.42107 O 0.514151',
 
     -- Sulfur
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/sulfur_S.html
-    Sulfur = {
-        ZoA = 0.4989787, x0 = 0.158, I = 1.8E-07, x1 = 2.7159, density = 2000,
-        delta0 = 0.14, state = 'liquid', k = 2.6456, a = 0.3399, Cbar = 4.6659,
-        elements = {S = 1}
-    },
+    Sulfur =
+        '0.4989787 1.8E-07 2000 liquid 0.158 2.7159 0.3399 2.6456 4.6659 0.14 \z
+        S 1',
 
     -- Tantalum
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tantalum_Ta.html
-    Tantalum = {
-        ZoA = 0.4034308, x0 = 0.2117, I = 7.18E-07, x1 = 3.4805,
-        density = 16650, delta0 = 0.14, state = 'liquid', k = 2.7623, a = 0.178,
-        Cbar = 5.5262, elements = {Ta = 1}
-    },
+    Tantalum =
+        '0.4034308 7.18E-07 16650 liquid 0.2117 3.4805 0.178 2.7623 5.5262 \z
+        0.14 Ta 1',
 
     -- Technetium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/technetium_Tc.html
-    Technetium = {
-        ZoA = 0.4391914, x0 = 0.0949, I = 4.28E-07, x1 = 3.1253,
-        density = 11500, delta0 = 0.14, state = 'liquid', k = 2.9738,
-        a = 0.1657, Cbar = 4.7769, elements = {Tc = 1}
-    },
+    Technetium =
+        '0.4391914 4.28E-07 11500 liquid 0.0949 3.1253 0.1657 2.9738 4.7769 \z
+        0.14 Tc 1',
 
     -- Polytetrafluoroethylene Teflon
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/polytetrafluoroethylene_Teflon.html
-    Teflon = {
-        ZoA = 0.4799271, x0 = 0.1648, I = 9.91E-08, x1 = 2.7404, density = 2200,
-        delta0 = 0, state = 'liquid', k = 3.4046, a = 0.1061, Cbar = 3.4161,
-        elements = {C = 0.240183, F = 0.759817}
-    },
+    Teflon =
+        '0.4799271 9.91E-08 2200 liquid 0.1648 2.7404 0.1061 3.4046 3.4161 0 \z
+        C 0.240183 F 0.759817',
 
     -- Tellurium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tellurium_Te.html
-    Tellurium = {
-        ZoA = 0.4075139, x0 = 0.3296, I = 4.85E-07, x1 = 3.4418, density = 6240,
-        delta0 = 0.14, state = 'liquid', k = 3.0354, a = 0.1382, Cbar = 5.7131,
-        elements = {Te = 1}
-    },
+    Tellurium =
+        '0.4075139 4.85E-07 6240 liquid 0.3296 3.4418 0.1382 3.0354 5.7131 \z
+        0.14 Te 1',
 
     -- Tennessine
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tennessine_Ts.html
-    Tennessine = {
-        ZoA = 0.3976738, x0 = 0.712, I = 1.227E-06, x1 = 3, density = 14000,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2927, Cbar = 6.7851,
-        elements = {Ts = 1}
-    },
+    Tennessine =
+        '0.3976738 1.227E-06 14000 liquid 0.712 3 0.2927 3 6.7851 0 Ts 1',
 
     -- Terbium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/terbium_Tb.html
-    Terbium = {
-        ZoA = 0.408998, x0 = 0.0947, I = 6.14E-07, x1 = 3.4224, density = 8230,
-        delta0 = 0.14, state = 'liquid', k = 2.6056, a = 0.2445, Cbar = 5.9044,
-        elements = {Tb = 1}
-    },
+    Terbium =
+        '0.408998 6.14E-07 8230 liquid 0.0947 3.4224 0.2445 2.6056 5.9044 \z
+        0.14 Tb 1',
 
     -- Terphenyl
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/terphenyl.html
-    Terphenyl = {
-        ZoA = 0.5214577, x0 = 0.1322, I = 7.17E-08, x1 = 2.5429, density = 1234,
-        delta0 = 0, state = 'liquid', k = 3.2685, a = 0.1496, Cbar = 3.2639,
-        elements = {C = 0.955457, H = 0.044543}
-    },
+    Terphenyl =
+        '0.5214577 7.17E-08 1234 liquid 0.1322 2.5429 0.1496 3.2685 3.2639 0 \z
+        C 0.955457 H 0.044543',
 
     -- Testes ICRP
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/testes_ICRP.html
-    Testes = {
-        ZoA = 0.5510036, x0 = 0.2274, I = 7.5E-08, x1 = 2.7988, density = 1040,
-        delta0 = 0, state = 'liquid', k = 3.5428, a = 0.0853, Cbar = 3.4698,
-        elements = {K = 0.00208, O = 0.773884, S = 0.00146, H = 0.104166,
-        P = 0.00125, Fe = 2E-05, Zn = 2E-05, Ca = 0.0001, Na = 0.00226,
-        Cl = 0.00244, Mg = 0.00011, C = 0.09227, N = 0.01994}
-    },
+    Testes =
+        '0.5510036 7.5E-08 1040 liquid 0.2274 2.7988 0.0853 3.5428 3.4698 0 K \z
+        0.00208 O 0.773884 S 0.00146 H 0.104166 P 0.00125 Fe 2E-05 Zn 2E-05 \z
+        Ca 0.0001 Na 0.00226 Cl 0.00244 Mg 0.00011 C 0.09227 N 0.01994',
 
     -- Tetrachloroethylene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tetrachloroethylene.html
-    Tetrachloroethylene = {
-        ZoA = 0.482409, x0 = 0.1713, I = 1.592E-07, x1 = 2.9083, density = 1625,
-        delta0 = 0, state = 'liquid', k = 3.0156, a = 0.1859, Cbar = 4.6619,
-        elements = {C = 0.144856, Cl = 0.855144}
-    },
+    Tetrachloroethylene =
+        '0.482409 1.592E-07 1625 liquid 0.1713 2.9083 0.1859 3.0156 4.6619 0 \z
+        C 0.144856 Cl 0.855144',
 
     -- Thallium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thallium_Tl.html
-    Thallium = {
-        ZoA = 0.3963167, x0 = 0.3491, I = 8.1E-07, x1 = 3.8044, density = 11720,
-        delta0 = 0.14, state = 'liquid', k = 3.145, a = 0.0945, Cbar = 6.1365,
-        elements = {Tl = 1}
-    },
+    Thallium =
+        '0.3963167 8.1E-07 11720 liquid 0.3491 3.8044 0.0945 3.145 6.1365 \z
+        0.14 Tl 1',
 
     -- Thallium chloride TlCl
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thallium_chloride_TlCl.html
-    ThalliumChloride = {
-        ZoA = 0.4086174, x0 = 0.0705, I = 6.903E-07, x1 = 3.5716,
-        density = 7004, delta0 = 0, state = 'liquid', k = 2.769, a = 0.186,
-        Cbar = 6.3009, elements = {Tl = 0.852187, Cl = 0.147822}
-    },
+    ThalliumChloride =
+        '0.4086174 6.903E-07 7004 liquid 0.0705 3.5716 0.186 2.769 6.3009 0 \z
+        Tl 0.852187 Cl 0.147822',
 
     -- Thorium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thorium_Th.html
-    Thorium = {
-        ZoA = 0.3878675, x0 = 0.4202, I = 8.47E-07, x1 = 3.7681,
-        density = 11720, delta0 = 0.14, state = 'liquid', k = 3.261, a = 0.0865,
-        Cbar = 6.2473, elements = {Th = 1}
-    },
+    Thorium =
+        '0.3878675 8.47E-07 11720 liquid 0.4202 3.7681 0.0865 3.261 6.2473 \z
+        0.14 Th 1',
 
     -- Thulium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/thulium_Tm.html
-    Thulium = {
-        ZoA = 0.4084435, x0 = 0.0812, I = 6.74E-07, x1 = 3.5085, density = 9321,
-        delta0 = 0.14, state = 'liquid', k = 2.5469, a = 0.2489, Cbar = 5.9677,
-        elements = {Tm = 1}
-    },
+    Thulium =
+        '0.4084435 6.74E-07 9321 liquid 0.0812 3.5085 0.2489 2.5469 5.9677 \z
+        0.14 Tm 1',
 
     -- Tin
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tin_Sn.html
-    Tin = {
-        ZoA = 0.421191, x0 = 0.2879, I = 4.88E-07, x1 = 3.2959, density = 7310,
-        delta0 = 0.14, state = 'liquid', k = 2.8576, a = 0.1869, Cbar = 5.534,
-        elements = {Sn = 1}
-    },
+    Tin =
+        '0.421191 4.88E-07 7310 liquid 0.2879 3.2959 0.1869 2.8576 5.534 0.14 \z
+        Sn 1',
 
     -- Tissue-equivalent gas Methane based
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tissue-equivalent_gas_Methane_based.html
-    TissueEquivalentGasMethaneBased = {
-        ZoA = 0.5498506, x0 = 1.6442, I = 6.12E-08, x1 = 4.1399,
-        density = 1.064, delta0 = 0, state = 'gas', k = 3.4708, a = 0.0995,
-        Cbar = 9.95, elements = {O = 0.40678, H = 0.101869, C = 0.456179,
-        N = 0.035172}
-    },
+    TissueEquivalentGasMethaneBased =
+        '0.5498506 6.12E-08 1.064 gas 1.6442 4.1399 0.0995 3.4708 9.95 0 O \z
+        0.40678 H 0.101869 C 0.456179 N 0.035172',
 
     -- Tissue-equivalent gas Propane based
     -- Category: biologicals
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tissue-equivalent_gas_Propane_based.html
-    TissueEquivalentGasPropaneBased = {
-        ZoA = 0.5501921, x0 = 1.5139, I = 5.95E-08, x1 = 3.9916,
-        density = 1.826, delta0 = 0, state = 'gas', k = 3.5159, a = 0.098,
-        Cbar = 9.3529, elements = {O = 0.293366, H = 0.102672, C = 0.56894,
-        N = 0.035022}
-    },
+    TissueEquivalentGasPropaneBased =
+        '0.5501921 5.95E-08 1.826 gas 1.5139 3.9916 0.098 3.5159 9.3529 0 O \z
+        0.293366 H 0.102672 C 0.56894 N 0.035022',
 
     -- Titanium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/titanium_Ti.html
-    Titanium = {
-        ZoA = 0.4596059, x0 = 0.0957, I = 2.33E-07, x1 = 3.0386, density = 4540,
-        delta0 = 0.12, state = 'liquid', k = 3.0302, a = 0.1566, Cbar = 4.445,
-        elements = {Ti = 1}
-    },
+    Titanium =
+        '0.4596059 2.33E-07 4540 liquid 0.0957 3.0386 0.1566 3.0302 4.445 \z
+        0.12 Ti 1',
 
     -- Titanium dioxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/titanium_dioxide.html
-    TitaniumDioxide = {
-        ZoA = 0.4757962, x0 = 0.0119, I = 1.795E-07, x1 = 3.1647,
-        density = 4260, delta0 = 0, state = 'liquid', k = 3.3267, a = 0.0857,
-        Cbar = 3.9522, elements = {Ti = 0.599408, O = 0.400592}
-    },
+    TitaniumDioxide =
+        '0.4757962 1.795E-07 4260 liquid 0.0119 3.1647 0.0857 3.3267 3.9522 0 \z
+        Ti 0.599408 O 0.400592',
 
     -- Toluene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/toluene.html
-    Toluene = {
-        ZoA = 0.54259, x0 = 0.1722, I = 6.25E-08, x1 = 2.5728, density = 866.9,
-        delta0 = 0, state = 'liquid', k = 3.3558, a = 0.1328, Cbar = 3.3026,
-        elements = {C = 0.91249, H = 0.08751}
-    },
+    Toluene =
+        '0.54259 6.25E-08 866.9 liquid 0.1722 2.5728 0.1328 3.3558 3.3026 0 C \z
+        0.91249 H 0.08751',
 
     -- Trichloroethylene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/trichloroethylene.html
-    Trichloroethylene = {
-        ZoA = 0.4870968, x0 = 0.1803, I = 1.481E-07, x1 = 2.914, density = 1460,
-        delta0 = 0, state = 'liquid', k = 3.0137, a = 0.1827, Cbar = 4.6148,
-        elements = {H = 0.007671, C = 0.182831, Cl = 0.809498}
-    },
+    Trichloroethylene =
+        '0.4870968 1.481E-07 1460 liquid 0.1803 2.914 0.1827 3.0137 4.6148 0 \z
+        H 0.007671 C 0.182831 Cl 0.809498',
 
     -- Triethyl phosphate
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/triethyl_phosphate.html
-    TriethylPhosphate = {
-        ZoA = 0.53794, x0 = 0.2054, I = 8.12E-08, x1 = 2.9428, density = 1070,
-        delta0 = 0, state = 'liquid', k = 3.6302, a = 0.0692, Cbar = 3.6242,
-        elements = {O = 0.351334, H = 0.082998, C = 0.395628, P = 0.17004}
-    },
+    TriethylPhosphate =
+        '0.53794 8.12E-08 1070 liquid 0.2054 2.9428 0.0692 3.6302 3.6242 0 O \z
+        0.351334 H 0.082998 C 0.395628 P 0.17004',
 
     -- Tungsten
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tungsten_W.html
-    Tungsten = {
-        ZoA = 0.4025217, x0 = 0.2167, I = 7.27E-07, x1 = 3.496, density = 19300,
-        delta0 = 0.14, state = 'liquid', k = 2.8447, a = 0.1551, Cbar = 5.4059,
-        elements = {W = 1}
-    },
+    Tungsten =
+        '0.4025217 7.27E-07 19300 liquid 0.2167 3.496 0.1551 2.8447 5.4059 \z
+        0.14 W 1',
 
     -- Tungsten hexafluoride
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/tungsten_hexafluoride.html
-    TungstenHexafluoride = {
-        ZoA = 0.4297725, x0 = 0.302, I = 3.544E-07, x1 = 4.2602, density = 2400,
-        delta0 = 0, state = 'liquid', k = 3.5134, a = 0.0366, Cbar = 5.9881,
-        elements = {W = 0.617277, F = 0.382723}
-    },
+    TungstenHexafluoride =
+        '0.4297725 3.544E-07 2400 liquid 0.302 4.2602 0.0366 3.5134 5.9881 0 \z
+        W 0.617277 F 0.382723',
 
     -- Uranium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/uranium_U.html
-    Uranium = {
-        ZoA = 0.3865075, x0 = 0.226, I = 8.9E-07, x1 = 3.3721, density = 18950,
-        delta0 = 0.14, state = 'liquid', k = 2.8171, a = 0.1968, Cbar = 5.8694,
-        elements = {U = 1}
-    },
+    Uranium =
+        '0.3865075 8.9E-07 18950 liquid 0.226 3.3721 0.1968 2.8171 5.8694 \z
+        0.14 U 1',
 
     -- Uranium dicarbide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/uranium_dicarbide.html
-    UraniumDicarbide = {
-        ZoA = 0.3968701, x0 = 0.2191, I = 7.52E-07, x1 = 3.5208,
-        density = 11280, delta0 = 0, state = 'liquid', k = 2.6577, a = 0.2112,
-        Cbar = 6.0247, elements = {C = 0.091669, U = 0.908331}
-    },
+    UraniumDicarbide =
+        '0.3968701 7.52E-07 11280 liquid 0.2191 3.5208 0.2112 2.6577 6.0247 0 \z
+        C 0.091669 U 0.908331',
 
     -- Uranium monocarbide UC
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/uranium_monocarbide_UC.html
-    UraniumMonocarbide = {
-        ZoA = 0.3919377, x0 = 0.2524, I = 8.62E-07, x1 = 3.4941,
-        density = 13630, delta0 = 0, state = 'liquid', k = 2.6169, a = 0.2297,
-        Cbar = 6.121, elements = {C = 0.048036, U = 0.951964}
-    },
+    UraniumMonocarbide =
+        '0.3919377 8.62E-07 13630 liquid 0.2524 3.4941 0.2297 2.6169 6.121 0 \z
+        C 0.048036 U 0.951964',
 
     -- Uranium oxide
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/uranium_oxide.html
-    UraniumOxide = {
-        ZoA = 0.3999592, x0 = 0.1938, I = 7.206E-07, x1 = 3.5292,
-        density = 10960, delta0 = 0, state = 'liquid', k = 2.6711, a = 0.2046,
-        Cbar = 5.9605, elements = {U = 0.881498, O = 0.118502}
-    },
+    UraniumOxide =
+        '0.3999592 7.206E-07 10960 liquid 0.1938 3.5292 0.2046 2.6711 5.9605 \z
+        0 U 0.881498 O 0.118502',
 
     -- Urea
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/urea.html
-    Urea = {
-        ZoA = 0.5327825, x0 = 0.1603, I = 7.28E-08, x1 = 2.6525, density = 1323,
-        delta0 = 0, state = 'liquid', k = 3.3461, a = 0.1161, Cbar = 3.2032,
-        elements = {O = 0.266411, H = 0.067131, C = 0.199999, N = 0.466459}
-    },
+    Urea =
+        '0.5327825 7.28E-08 1323 liquid 0.1603 2.6525 0.1161 3.3461 3.2032 0 \z
+        O 0.266411 H 0.067131 C 0.199999 N 0.466459',
 
     -- Valine
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/valine.html
-    Valine = {
-        ZoA = 0.5462495, x0 = 0.1441, I = 6.77E-08, x1 = 2.6227, density = 1230,
-        delta0 = 0, state = 'liquid', k = 3.3774, a = 0.1139, Cbar = 3.1059,
-        elements = {O = 0.27315, H = 0.094641, C = 0.512645, N = 0.119565}
-    },
+    Valine =
+        '0.5462495 6.77E-08 1230 liquid 0.1441 2.6227 0.1139 3.3774 3.1059 0 \z
+        O 0.27315 H 0.094641 C 0.512645 N 0.119565',
 
     -- Vanadium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/vanadium_V.html
-    Vanadium = {
-        ZoA = 0.4514983, x0 = 0.0691, I = 2.45E-07, x1 = 3.0322, density = 6110,
-        delta0 = 0.14, state = 'liquid', k = 3.0163, a = 0.1544, Cbar = 4.2659,
-        elements = {V = 1}
-    },
+    Vanadium =
+        '0.4514983 2.45E-07 6110 liquid 0.0691 3.0322 0.1544 3.0163 4.2659 \z
+        0.14 V 1',
 
     -- Viton fluoroelastomer
     -- Category: polymers
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/viton_fluoroelastomer.html
-    VitonFluoroelastomer = {
-        ZoA = 0.4858445, x0 = 0.2106, I = 9.86E-08, x1 = 2.7874, density = 1800,
-        delta0 = 0, state = 'liquid', k = 3.4556, a = 0.0997, Cbar = 3.5943,
-        elements = {H = 0.009417, C = 0.280555, F = 0.710028}
-    },
+    VitonFluoroelastomer =
+        '0.4858445 9.86E-08 1800 liquid 0.2106 2.7874 0.0997 3.4556 3.5943 0 \z
+        H 0.009417 C 0.280555 F 0.710028',
 
     -- Water liquid
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/water_liquid.html
-    Water = {
-        ZoA = 0.5550013, x0 = 0.24, I = 7.97E-08, x1 = 2.8004, density = 1000,
-        delta0 = 0, state = 'liquid', k = 3.4773, a = 0.0912, Cbar = 3.5017,
-        elements = {O = 0.888106, H = 0.111894}
-    },
+    Water =
+        '0.5550013 7.97E-08 1000 liquid 0.24 2.8004 0.0912 3.4773 3.5017 0 O \z
+        0.888106 H 0.111894',
 
     -- Water ice
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/water_ice.html
-    WaterIce = {
-        ZoA = 0.5550013, x0 = 0.2586, I = 7.97E-08, x1 = 2.819, density = 918,
-        delta0 = 0, state = 'liquid', k = 3.4773, a = 0.0912, Cbar = 3.5873,
-        elements = {O = 0.888106, H = 0.111894}
-    },
+    WaterIce =
+        '0.5550013 7.97E-08 918 liquid 0.2586 2.819 0.0912 3.4773 3.5873 0 O \z
+        0.888106 H 0.111894',
 
     -- Water vapor
     -- Category: inorganics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/water_vapor.html
-    WaterVapor = {
-        ZoA = 0.5550013, x0 = 1.7952, I = 7.16E-08, x1 = 4.3437,
-        density = 0.7562, delta0 = 0, state = 'gas', k = 3.5901, a = 0.081,
-        Cbar = 10.5962, elements = {O = 0.888106, H = 0.111894}
-    },
+    WaterVapor =
+        '0.5550013 7.16E-08 0.7562 gas 1.7952 4.3437 0.081 3.5901 10.5962 0 O \z
+        0.888106 H 0.111894',
 
     -- Xenon gas
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/xenon_gas_Xe.html
-    XenonGas = {
-        ZoA = 0.4112907, x0 = 1.5631, I = 4.82E-07, x1 = 4.7372,
-        density = 5.483, delta0 = 0, state = 'gas', k = 2.7414, a = 0.2331,
-        Cbar = 12.7285, elements = {Xe = 1}
-    },
+    XenonGas =
+        '0.4112907 4.82E-07 5.483 gas 1.5631 4.7372 0.2331 2.7414 12.7285 0 \z
+        Xe 1',
 
     -- Xylene
     -- Category: organics
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/xylene.html
-    Xylene = {
-        ZoA = 0.5462418, x0 = 0.1695, I = 6.18E-08, x1 = 2.5675, density = 870,
-        delta0 = 0, state = 'liquid', k = 3.3564, a = 0.1322, Cbar = 3.2698,
-        elements = {C = 0.905065, H = 0.094935}
-    },
+    Xylene =
+        '0.5462418 6.18E-08 870 liquid 0.1695 2.5675 0.1322 3.3564 3.2698 0 C \z
+        0.905065 H 0.094935',
 
     -- Ytterbium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/ytterbium_Yb.html
-    Ytterbium = {
-        ZoA = 0.404498, x0 = 0.1144, I = 6.84E-07, x1 = 3.6191, density = 6903,
-        delta0 = 0.14, state = 'liquid', k = 2.5141, a = 0.253, Cbar = 6.3071,
-        elements = {Yb = 1}
-    },
+    Ytterbium =
+        '0.404498 6.84E-07 6903 liquid 0.1144 3.6191 0.253 2.5141 6.3071 0.14 \z
+        Yb 1',
 
     -- Yttrium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_Y.html
-    Yttrium = {
-        ZoA = 0.4386665, x0 = 0.3608, I = 3.79E-07, x1 = 3.5542, density = 4469,
-        delta0 = 0.14, state = 'liquid', k = 3.4585, a = 0.0714, Cbar = 5.4801,
-        elements = {Y = 1}
-    },
+    Yttrium =
+        '0.4386665 3.79E-07 4469 liquid 0.3608 3.5542 0.0714 3.4585 5.4801 \z
+        0.14 Y 1',
 
     -- Yttrium aluminum oxide 1
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_aluminum_oxide_1.html
-    YttriumAluminumOxide1 = {
-        ZoA = 0.4637388, x0 = 0.2, I = 2.393E-07, x1 = 3, density = 5500,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1538, Cbar = 4.2973,
-        elements = {Y = 0.542487, Al = 0.164636, O = 0.292876}
-    },
+    YttriumAluminumOxide1 =
+        '0.4637388 2.393E-07 5500 liquid 0.2 3 0.1538 3 4.2973 0 Y 0.542487 \z
+        Al 0.164636 O 0.292876',
 
     -- Yttrium aluminum oxide 2
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_aluminum_oxide_2.html
-    YttriumAluminumOxide2 = {
-        ZoA = 0.4683154, x0 = 0.2, I = 2.18E-07, x1 = 3, density = 4560,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1534, Cbar = 4.2884,
-        elements = {Y = 0.449308, Al = 0.227263, O = 0.323428}
-    },
+    YttriumAluminumOxide2 =
+        '0.4683154 2.18E-07 4560 liquid 0.2 3 0.1534 3 4.2884 0 Y 0.449308 Al \z
+        0.227263 O 0.323428',
 
     -- Yttrium bromide
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_bromide.html
-    YttriumBromide = {
-        ZoA = 0.4381986, x0 = 0.2831, I = 4.1E-07, x1 = 3, density = 5290,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.2077, Cbar = 5.4697,
-        elements = {Y = 0.270545, Br = 0.729455}
-    },
+    YttriumBromide =
+        '0.4381986 4.1E-07 5290 liquid 0.2831 3 0.2077 3 5.4697 0 Y 0.270545 \z
+        Br 0.729455',
 
     -- Yttrium silicon oxide
     -- Category: scintillators
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/yttrium_silicon_oxide.html
-    YttriumSiliconOxide = {
-        ZoA = 0.4617098, x0 = 0.2, I = 2.581E-07, x1 = 3, density = 4540,
-        delta0 = 0, state = 'liquid', k = 3, a = 0.1696, Cbar = 4.6447,
-        elements = {Y = 0.621949, O = 0.279813, Si = 0.098237}
-    },
+    YttriumSiliconOxide =
+        '0.4617098 2.581E-07 4540 liquid 0.2 3 0.1696 3 4.6447 0 Y 0.621949 O \z
+        0.279813 Si 0.098237',
 
     -- Zinc
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/zinc_Zn.html
-    Zinc = {
-        ZoA = 0.4588419, x0 = 0.0049, I = 3.3E-07, x1 = 3.3668, density = 7133,
-        delta0 = 0.08, state = 'liquid', k = 2.8652, a = 0.1471, Cbar = 4.6906,
-        elements = {Zn = 1}
-    },
+    Zinc =
+        '0.4588419 3.3E-07 7133 liquid 0.0049 3.3668 0.1471 2.8652 4.6906 \z
+        0.08 Zn 1',
 
     -- Zirconium
     -- Category: elements
     -- Ref: https://pdg.lbl.gov/2020/AtomicNuclearProperties/HTML/zirconium_Zr.html
-    Zirconium = {
-        ZoA = 0.4384801, x0 = 0.2957, I = 3.93E-07, x1 = 3.489, density = 6506,
-        delta0 = 0.14, state = 'liquid', k = 3.4533, a = 0.0718, Cbar = 5.1774,
-        elements = {Zr = 1}
-    },
+    Zirconium =
+        '0.4384801 3.93E-07 6506 liquid 0.2957 3.489 0.0718 3.4533 5.1774 \z
+        0.14 Zr 1',
 
 }
@@ -70,12 +70,33 @@ end
 
 
 -------------------------------------------------------------------------------
--- Build the Elements table
+-- Build the Elements table. Entries are decoded on first access
 -------------------------------------------------------------------------------
-element.elements = require('pumas.data.elements')
+do
+    local records = require('pumas.data.elements')
+
+    local function get (t, k)
+        local record = records[k]
+        if record == nil then return nil end
+
+        local Z, A, I = record:match('(%S+) (%S+) (%S+)')
+        local v = compat.table_new(0, 3)
+        v.Z = tonumber(Z)
+        v.A = tonumber(A)
+        v.I = tonumber(I)
+        v = setmetatable(v, Element)
+        rawset(t, k, v)
+        return v
+    end
 
-for k, v in pairs(element.elements) do
-    element.elements[k] = setmetatable(v, Element)
+    element.elements = setmetatable({}, {
+        __index = get,
+        __pairs = function (t)
+            for k, _ in pairs(records) do
+                if rawget(t, k) == nil then get(t, k) end
+            end
+            return next, t, nil
+        end})
 end
 
 
@@ -184,6 +184,7 @@ end
 -- Muon flux metatype
 -------------------------------------------------------------------------------
 local MuonFlux = {}
+local new_generator
 
 do
     local function sample (self, state)
@@ -236,9 +237,22 @@ do
         return self._spectrum(energy, cos_theta, charge, altitude)
     end
 
+    local function generator (self, args)
+        if metatype(self) ~= 'MuonFlux' then
+            error.raise{fname = 'generator', argnum = 1,
+                expected = 'a MuonFlux table', got = metatype.a(self)}
+        end
+
+        return new_generator(self, args)
+    end
+
+    error.register('MuonFlux.__index.generator', generator)
+
     function MuonFlux:__index (k)
         if k == '__metatype' then
             return 'MuonFlux'
+        elseif k == 'generator' then
+            return generator
         elseif k == 'sample' then
             return sample
         elseif k == 'spectrum' then
@@ -430,11 +444,480 @@ do
 end
 
 
+-------------------------------------------------------------------------------
+-- Flux generator metatype
+-------------------------------------------------------------------------------
+local FluxGenerator = {}
+
+do
+    local function generate (self, state)
+        if metatype(self) ~= 'FluxGenerator' then
+            error.raise{fname = 'generate', argnum = 1,
+                expected = 'a FluxGenerator table', got = metatype.a(self)}
+        elseif metatype(state) ~= 'State' then
+            error.raise{fname = 'generate', argnum = 2,
+                expected = 'a State table', got = metatype.a(state)}
+        end
+
+        -- Draw a cell of the alias table
+        local context = self._context
+        local n = self._size
+        local k = math.floor(context:random() * n)
+        if k >= n then k = n - 1 end
+        if context:random() >= self._probability[k] then
+            k = self._alias[k]
+        end
+
+        local n_k, n_c = self._n_k, self._n_c
+        local i = k % n_k
+        local j = math.floor(k / n_k) % n_c
+        local charge = self._charges[math.floor(k / (n_k * n_c)) + 1]
+
+        -- Draw the kinetic energy and the direction uniformly in the cell
+        local energy = math.exp(self._log_k0 +
+            (i + context:random()) * self._dlog_k)
+        local cos_theta = self._c0 + (j + context:random()) * self._dc
+        if cos_theta > 1 then cos_theta = 1 end
+        local sin_theta = math.sqrt(1 - cos_theta * cos_theta)
+        local phi = 2 * math.pi * context:random()
+        local su, sv = sin_theta * math.cos(phi), sin_theta * math.sin(phi)
+
+        local c = state._c
+        ffi.fill(c, self._state_size)
+        c.charge = charge
+        c.energy = energy
+        local u, v, w = self._basis[1], self._basis[2], self._basis[3]
+        for ii = 0, 2 do
+            c.position[ii] = self._position[ii]
+            c.direction[ii] = -(su * u[ii] + sv * v[ii] + cos_theta * w[ii])
+        end
+
+        -- Set the weight as the ratio of the flux to the sampling PDF
+        local f = self._flux._spectrum(energy, cos_theta, charge,
+            self._altitude)
+        c.weight = f * energy * self._cell_size / self._cells[k]
+
+        return state
+    end
+
+    error.register('FluxGenerator.__index.generate', generate)
+
+    function FluxGenerator:__index (k)
+        if k == '__metatype' then
+            return 'FluxGenerator'
+        elseif k == 'generate' then
+            return generate
+        elseif k == 'altitude' then
+            return rawget(self, '_altitude')
+        elseif k == 'context' then
+            return rawget(self, '_context')
+        elseif k == 'flux' then
+            return rawget(self, '_flux')
+        else
+            error.raise{['type'] = 'FluxGenerator', bad_member = k}
+        end
+    end
+end
+
+
+function FluxGenerator.__newindex (_, k)
+    if (k == 'altitude') or (k == 'context') or (k == 'flux') then
+        error.raise{['type'] = 'FluxGenerator', not_mutable = k}
+    else
+        error.raise{['type'] = 'FluxGenerator', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Flux generator constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'generator'}
+
+    -- Number of cells of the alias table, per energy decade and along
+    -- cos(theta)
+    local N_K_PER_DECADE = 20
+    local N_COS_THETA = 20
+
+    local function check_range (args, k, min, max)
+        local v = args[k]
+        if (type(v) ~= 'table') or (type(v[1]) ~= 'number') or
+           (type(v[2]) ~= 'number') then
+            raise_error{argname = k, expected = 'a {number, number} table',
+                got = metatype.a(v)}
+        elseif (v[1] >= v[2]) or (v[1] < min) or (v[2] > max) then
+            raise_error{argname = k, description = 'invalid range'}
+        end
+        return v[1], v[2]
+    end
+
+    -- Build the alias table using Vose's method
+    local function build_alias (cells, n)
+        local probability = ffi.new('double [?]', n)
+        local alias = ffi.new('int [?]', n)
+
+        local total = 0
+        for k = 0, n - 1 do total = total + cells[k] end
+        if total <= 0 then
+            raise_error{description = 'null flux over the generation range'}
+        end
+
+        local small, large = {}, {}
+        for k = 0, n - 1 do
+            probability[k] = cells[k] * n / total
+            alias[k] = k
+            if probability[k] < 1 then
+                table.insert(small, k)
+            else
+                table.insert(large, k)
+            end
+        end
+
+        while (#small > 0) and (#large > 0) do
+            local s, l = table.remove(small), large[#large]
+            alias[s] = l
+            probability[l] = probability[l] + probability[s] - 1
+            if probability[l] < 1 then
+                table.remove(large)
+                table.insert(small, l)
+            end
+        end
+        for _, k in ipairs(small) do probability[k] = 1 end
+        for _, k in ipairs(large) do probability[k] = 1 end
+
+        return probability, alias, total
+    end
+
+    function new_generator (flux_, args)
+        if type(args) ~= 'table' then
+            raise_error{argnum = 2, expected = 'a table',
+                got = metatype.a(args)}
+        end
+
+        for k, _ in pairs(args) do
+            if (k ~= 'altitude') and (k ~= 'charge') and (k ~= 'context') and
+               (k ~= 'cos_theta') and (k ~= 'energy') and
+               (k ~= 'position') then
+                raise_error{argnum = 2, description = "unknown option '"..k..
+                    "'"}
+            end
+        end
+
+        local context = args.context
+        if metatype(context) ~= 'Context' then
+            raise_error{argname = 'context', expected = 'a Context table',
+                got = metatype.a(context)}
+        end
+
+        local k0, k1 = check_range(args, 'energy', 0, math.huge)
+        if k0 <= 0 then
+            raise_error{argname = 'energy', description = 'invalid range'}
+        end
+
+        local c0, c1 = 0, 1
+        if args.cos_theta ~= nil then
+            c0, c1 = check_range(args, 'cos_theta', -1, 1)
+        end
+
+        local altitude = args.altitude or rawget(flux_, '_altitude') or 0
+        if type(altitude) ~= 'number' then
+            raise_error{argname = 'altitude', expected = 'a number',
+                got = metatype.a(altitude)}
+        end
+
+        local charges
+        if args.charge == nil then
+            charges = {-1, 1}
+        elseif (args.charge == -1) or (args.charge == 1) then
+            charges = {args.charge}
+        else
+            raise_error{argname = 'charge', expected = '-1 or 1',
+                got = metatype.a(args.charge)}
+        end
+
+        -- Set the generation point and the local basis, in the simulation
+        -- frame
+        local position, basis = ffi.new('double [3]'), {}
+        if flux_._axis == 'vertical' then
+            local origin = args.position or coordinates.GeodeticPoint(
+                0, 0, flux_._origin + altitude)
+            position = coordinates.CartesianPoint():set(origin):get()
+            local frame = coordinates.LocalFrame(position)
+            for i, e in ipairs{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}} do
+                basis[i] = coordinates.CartesianVector{e[1], e[2], e[3],
+                    frame}:get()
+            end
+        else
+            if args.position ~= nil then
+                position = coordinates.CartesianPoint():set(args.position)
+                    :get()
+            else
+                local o, a = flux_._origin, flux_._axis
+                position[0] = o.x + altitude * a.x
+                position[1] = o.y + altitude * a.y
+                position[2] = o.z + altitude * a.z
+            end
+
+            local w = flux_._axis:get()
+            local norm = math.sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2])
+            for i = 0, 2 do w[i] = w[i] / norm end
+            local e = (math.abs(w[0]) < 0.9) and {1, 0, 0} or {0, 1, 0}
+            local u = ffi.new('double [3]',
+                e[2] * w[2] - e[3] * w[1],
+                e[3] * w[0] - e[1] * w[2],
+                e[1] * w[1] - e[2] * w[0])
+            norm = math.sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2])
+            for i = 0, 2 do u[i] = u[i] / norm end
+            local v = ffi.new('double [3]',
+                w[1] * u[2] - w[2] * u[1],
+                w[2] * u[0] - w[0] * u[2],
+                w[0] * u[1] - w[1] * u[0])
+            basis = {u, v, w}
+        end
+
+        -- Tabulate the flux over the cells, using the maximum value over the
+        -- cell nodes in order to not miss any region of non null flux
+        local n_k = math.max(1, math.ceil(N_K_PER_DECADE *
+            math.log10(k1 / k0)))
+        local n_c = N_COS_THETA
+        local log_k0 = math.log(k0)
+        local dlog_k = (math.log(k1) - log_k0) / n_k
+        local dc = (c1 - c0) / n_c
+        local n = n_k * n_c * #charges
+
+        local cells = ffi.new('double [?]', n)
+        for q, charge in ipairs(charges) do
+            for j = 0, n_c - 1 do
+                for i = 0, n_k - 1 do
+                    local v = 0
+                    for _, node in ipairs{{0, 0}, {1, 0}, {0, 1}, {1, 1},
+                                          {0.5, 0.5}} do
+                        local k = math.exp(log_k0 + (i + node[1]) * dlog_k)
+                        local c = c0 + (j + node[2]) * dc
+                        local f = flux_._spectrum(k, c, charge, altitude) * k
+                        if f > v then v = f end
+                    end
+                    cells[((q - 1) * n_c + j) * n_k + i] = v
+                end
+            end
+        end
+
+        local probability, alias, total = build_alias(cells, n)
+
+        local self = {
+            _alias = alias,
+            _altitude = altitude,
+            _basis = basis,
+            _c0 = c0,
+            _cell_size = 2 * math.pi * dlog_k * dc * total,
+            _cells = cells,
+            _charges = charges,
+            _context = context,
+            _dc = dc,
+            _dlog_k = dlog_k,
+            _flux = flux_,
+            _log_k0 = log_k0,
+            _n_c = n_c,
+            _n_k = n_k,
+            _position = position,
+            _probability = probability,
+            _size = n,
+            _state_size = ffi.sizeof('struct pumas_state_extended')
+        }
+
+        return setmetatable(self, FluxGenerator)
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Transmitted flux metatype
+-------------------------------------------------------------------------------
+local TransmittedFlux = {}
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'TransmittedFlux' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a TransmittedFlux table', got = metatype.a(self)}
+        end
+    end
+
+    local function check_number (v, fname, argnum)
+        if type(v) ~= 'number' then
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a number', got = metatype.a(v)}
+        end
+    end
+
+    local function energy (self, grammage)
+        check_self(self, 'energy')
+        check_number(grammage, 'energy', 2)
+
+        return clib.pumas_flux_transmission_energy(self._c, grammage)
+    end
+
+    local function flux_ (self, grammage, cos_theta)
+        check_self(self, 'flux')
+        check_number(grammage, 'flux', 2)
+        check_number(cos_theta, 'flux', 3)
+
+        return clib.pumas_flux_transmission_get(self._c, grammage, cos_theta)
+    end
+
+    local function map (self, grammage, elevation)
+        check_self(self, 'map')
+        if type(elevation) == 'number' then
+            elevation = {elevation}
+        elseif (type(elevation) ~= 'table') or (#elevation == 0) then
+            error.raise{fname = 'map', argnum = 3,
+                expected = 'a number or a table', got = metatype.a(elevation)}
+        end
+
+        local n_rows = #elevation
+        local size = (type(grammage) == 'cdata') and
+            ffi.sizeof(grammage) / ffi.sizeof('double')
+        if (not size) or (size % n_rows ~= 0) then
+            error.raise{fname = 'map', argnum = 2,
+                expected = 'a double [?][?] cdata', got = metatype.a(grammage)}
+        end
+        local n_columns = size / n_rows
+
+        local cos_theta = ffi.new('double [?]', n_rows)
+        for i, v in ipairs(elevation) do
+            cos_theta[i - 1] = math.sin(v)
+        end
+
+        local flux_map = ffi.new('double [?]['..n_columns..']', n_rows)
+        clib.pumas_flux_transmission_map(self._c, n_rows, n_columns,
+            ffi.cast('double *', grammage), cos_theta,
+            ffi.cast('double *', flux_map))
+        return flux_map
+    end
+
+    error.register('TransmittedFlux.__index.energy', energy)
+    error.register('TransmittedFlux.__index.flux', flux_)
+    error.register('TransmittedFlux.__index.map', map)
+
+    function TransmittedFlux:__index (k)
+        if k == '__metatype' then
+            return 'TransmittedFlux'
+        elseif k == 'energy' then
+            return energy
+        elseif k == 'flux' then
+            return flux_
+        elseif k == 'map' then
+            return map
+        elseif k == 'material' then
+            return rawget(self, '_material')
+        elseif k == 'model' then
+            return rawget(self, '_flux')
+        else
+            error.raise{['type'] = 'TransmittedFlux', bad_member = k}
+        end
+    end
+end
+
+
+function TransmittedFlux.__newindex (_, k)
+    if (k == 'material') or (k == 'model') then
+        error.raise{['type'] = 'TransmittedFlux', not_mutable = k}
+    else
+        error.raise{['type'] = 'TransmittedFlux', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Transmitted flux constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'TransmittedFlux'}
+
+    -- Number of cos(theta) nodes for the tabulation of the integrated flux
+    local N_COS_THETA = 101
+
+    local ctype = ffi.typeof('struct pumas_flux_transmission')
+    local ctype_ptr = ffi.typeof('struct pumas_flux_transmission *')
+
+    local function new (cls, args)
+        if type(args) ~= 'table' then
+            raise_error{argnum = 1, expected = 'a table',
+                got = metatype.a(args)}
+        end
+
+        local model = args.model
+        if metatype(model) ~= 'MuonFlux' then
+            raise_error{argname = 'model', expected = 'a MuonFlux table',
+                got = metatype.a(model)}
+        end
+
+        local material = args.material
+        if metatype(material) ~= 'TabulatedMaterial' then
+            raise_error{argname = 'material',
+                expected = 'a TabulatedMaterial table',
+                got = metatype.a(material)}
+        end
+
+        local charge, altitude = args.charge, args.altitude
+        for k, v in pairs(args) do
+            if (k == 'charge') or (k == 'altitude') then
+                if type(v) ~= 'number' then
+                    raise_error{argname = k, expected = 'a number',
+                        got = metatype.a(v)}
+                end
+            elseif (k ~= 'model') and (k ~= 'material') then
+                raise_error{argnum = 1, description = "unknown option '"..k..
+                    "'"}
+            end
+        end
+
+        -- Copy the CSDA range table of the material
+        material:_update()
+        local kinetic = material.table.csda.kinetic_energy
+        local grammage = material.table.csda.grammage
+        local n_k, n_c = #kinetic, N_COS_THETA
+
+        local size = ffi.sizeof(ctype) +
+            (2 + n_c) * n_k * ffi.sizeof('double')
+        local c = ffi.cast(ctype_ptr, ffi.C.calloc(1, size))
+        if c == nil then
+            raise_error{description = 'could not allocate memory'}
+        end
+        ffi.gc(c, ffi.C.free)
+        c.n_k, c.n_c = n_k, n_c
+
+        for i = 1, n_k do
+            c.data[i - 1] = kinetic[i]
+            c.data[n_k + i - 1] = grammage[i]
+        end
+
+        -- Tabulate and integrate the spectrum
+        for j = 0, n_c - 1 do
+            local cos_theta = j / (n_c - 1)
+            local offset = (2 + j) * n_k
+            for i = 1, n_k do
+                c.data[offset + i - 1] = model:spectrum(
+                    kinetic[i], cos_theta, charge, altitude)
+            end
+        end
+        clib.pumas_flux_transmission_integrate(c)
+
+        return setmetatable({_c = c, _flux = model, _material = material},
+            cls)
+    end
+
+    flux.TransmittedFlux = setmetatable(TransmittedFlux, {__call = new})
+end
+
+
 -------------------------------------------------------------------------------
 -- Register the subpackage
 -------------------------------------------------------------------------------
 function flux.register_to (t)
     t.MuonFlux = flux.MuonFlux
+    t.TransmittedFlux = flux.TransmittedFlux
 end
 
 
@@ -0,0 +1,338 @@
+-------------------------------------------------------------------------------
+-- Monte Carlo generators for PUMAS
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local coordinates = require('pumas.coordinates')
+local error = require('pumas.error')
+local metatype = require('pumas.metatype')
+
+local generator = {}
+
+
+-------------------------------------------------------------------------------
+-- Backward generator metatype
+-------------------------------------------------------------------------------
+local BackwardGenerator = {}
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'BackwardGenerator' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a BackwardGenerator table',
+                got = metatype.a(self)}
+        end
+    end
+
+    local function check_state (state, fname)
+        if metatype(state) ~= 'State' then
+            error.raise{fname = fname, argnum = 2,
+                expected = 'a State table', got = metatype.a(state)}
+        end
+    end
+
+    local function clear (self)
+        check_self(self, 'clear')
+
+        ffi.fill(self._sum, 2 * self._bins * ffi.sizeof('double'))
+        rawset(self, '_events', 0)
+        rawset(self, '_bin', nil)
+        return self
+    end
+
+    local function generate (self, state)
+        check_self(self, 'generate')
+        check_state(state, 'generate')
+
+        local context = self._context
+        ffi.copy(state._c, self._state._c, self._state_size)
+
+        -- Draw the final kinetic energy from the biasing PDF
+        local e0, e1, b = self._energy[1], self._energy[2], self._b
+        local u = context:random()
+        local energy, weight
+        if b == 0 then
+            energy = e0 * math.exp(u * self._norm)
+            weight = energy * self._norm
+        else
+            energy = math.pow(self._pow0 + u * self._norm, 1 / b)
+            weight = self._norm / (b * math.pow(energy, b - 1))
+        end
+        if energy < e0 then
+            energy = e0
+        elseif energy > e1 then
+            energy = e1
+        end
+        state._c.energy = energy
+
+        -- Randomise the electric charge, if not fixed
+        local charge = rawget(self, '_charge')
+        if charge == nil then
+            state._c.charge = (context:random() < 0.5) and -1 or 1
+            weight = weight * 2
+        else
+            state._c.charge = charge
+        end
+
+        -- Draw the direction uniformly over the solid angle, if requested
+        local solid_angle = rawget(self, '_solid_angle')
+        if solid_angle ~= nil then
+            local h = self._horizontal
+            local s0, s1 = self._sin_elevation[1], self._sin_elevation[2]
+            local a0, a1 = self._azimuth[1], self._azimuth[2]
+            h.elevation = math.asin(s0 + context:random() * (s1 - s0))
+            h.azimuth = a0 + context:random() * (a1 - a0)
+            local c = self._cartesian:set(h):transform()
+            state._c.direction[0] = c.x
+            state._c.direction[1] = c.y
+            state._c.direction[2] = c.z
+            weight = weight * solid_angle
+        end
+
+        state._c.weight = state._c.weight * weight
+
+        -- Bookkeep the energy bin of the event
+        local bin = math.floor(math.log(energy / e0) / self._dlog)
+        if bin >= self._bins then bin = self._bins - 1 end
+        rawset(self, '_bin', bin)
+        rawset(self, '_events', self._events + 1)
+
+        return state
+    end
+
+    local function score (self, value)
+        check_self(self, 'score')
+        if metatype(value) == 'State' then
+            value = value._c.weight
+        elseif type(value) ~= 'number' then
+            error.raise{fname = 'score', argnum = 2,
+                expected = 'a number or a State table',
+                got = metatype.a(value)}
+        end
+
+        local bin = rawget(self, '_bin')
+        if bin == nil then
+            error.raise{fname = 'score',
+                description = 'no pending event'}
+        end
+        rawset(self, '_bin', nil)
+
+        local sum = self._sum
+        sum[bin] = sum[bin] + value
+        sum[self._bins + bin] = sum[self._bins + bin] + value * value
+        return self
+    end
+
+    local function spectrum (self)
+        check_self(self, 'spectrum')
+
+        local n, bins, sum = self._events, self._bins, self._sum
+        local e0, dlog = self._energy[1], self._dlog
+        local solid_angle = rawget(self, '_solid_angle') or 1
+        local energy, flux, sigma = {}, {}, {}
+        for i = 0, bins - 1 do
+            local ea = e0 * math.exp(i * dlog)
+            local eb = e0 * math.exp((i + 1) * dlog)
+            energy[i + 1] = math.sqrt(ea * eb)
+
+            if n > 0 then
+                local norm = 1 / ((eb - ea) * solid_angle)
+                local s, s2 = sum[i] / n, sum[bins + i] / n
+                local var = s2 - s * s
+                flux[i + 1] = s * norm
+                sigma[i + 1] = ((var > 0) and math.sqrt(var / n) or 0) * norm
+            else
+                flux[i + 1], sigma[i + 1] = 0, 0
+            end
+        end
+
+        return energy, flux, sigma
+    end
+
+    error.register('BackwardGenerator.__index.clear', clear)
+    error.register('BackwardGenerator.__index.generate', generate)
+    error.register('BackwardGenerator.__index.score', score)
+    error.register('BackwardGenerator.__index.spectrum', spectrum)
+
+    function BackwardGenerator:__index (k)
+        if k == '__metatype' then
+            return 'BackwardGenerator'
+        elseif k == 'clear' then
+            return clear
+        elseif k == 'generate' then
+            return generate
+        elseif k == 'score' then
+            return score
+        elseif k == 'spectrum' then
+            return spectrum
+        elseif k == 'bins' then
+            return rawget(self, '_bins')
+        elseif k == 'context' then
+            return rawget(self, '_context')
+        elseif k == 'events' then
+            return rawget(self, '_events')
+        elseif k == 'exponent' then
+            return rawget(self, '_b') - 1
+        else
+            error.raise{['type'] = 'BackwardGenerator', bad_member = k}
+        end
+    end
+end
+
+
+function BackwardGenerator.__newindex (_, k)
+    if (k == 'bins') or (k == 'context') or (k == 'events') or
+       (k == 'exponent') then
+        error.raise{['type'] = 'BackwardGenerator', not_mutable = k}
+    else
+        error.raise{['type'] = 'BackwardGenerator', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Backward generator constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'BackwardGenerator'}
+
+    local function check_range (args, k, min, max)
+        local v = args[k]
+        if (type(v) ~= 'table') or (type(v[1]) ~= 'number') or
+           (type(v[2]) ~= 'number') then
+            raise_error{argname = k, expected = 'a {number, number} table',
+                got = metatype.a(v)}
+        elseif (v[1] >= v[2]) or (min and (v[1] < min)) or
+               (max and (v[2] > max)) then
+            raise_error{argname = k, description = 'invalid range'}
+        end
+        return {v[1], v[2]}
+    end
+
+    local function new (cls, args)
+        if type(args) ~= 'table' then
+            raise_error{argnum = 1, expected = 'a table',
+                got = metatype.a(args)}
+        end
+
+        for k, _ in pairs(args) do
+            if (k ~= 'azimuth') and (k ~= 'bins') and (k ~= 'charge') and
+               (k ~= 'context') and (k ~= 'elevation') and
+               (k ~= 'energy') and (k ~= 'exponent') and (k ~= 'frame') and
+               (k ~= 'state') then
+                raise_error{argnum = 1, description = "unknown option '"..k..
+                    "'"}
+            end
+        end
+
+        local context = args.context
+        if metatype(context) ~= 'Context' then
+            raise_error{argname = 'context', expected = 'a Context table',
+                got = metatype.a(context)}
+        end
+
+        local state = args.state
+        if metatype(state) ~= 'State' then
+            raise_error{argname = 'state', expected = 'a State table',
+                got = metatype.a(state)}
+        end
+        state = state:clone()
+
+        local self = {_context = context, _state = state,
+            _state_size = ffi.sizeof('struct pumas_state_extended')}
+
+        -- Set the biasing PDF for the kinetic energy
+        local energy = check_range(args, 'energy')
+        if energy[1] <= 0 then
+            raise_error{argname = 'energy', description = 'invalid range'}
+        end
+        self._energy = energy
+
+        local exponent = args.exponent or -1
+        if type(exponent) ~= 'number' then
+            raise_error{argname = 'exponent', expected = 'a number',
+                got = metatype.a(exponent)}
+        end
+        local b = exponent + 1
+        if math.abs(b) < 1E-09 then
+            self._b = 0
+            self._norm = math.log(energy[2] / energy[1])
+        else
+            self._b = b
+            self._pow0 = math.pow(energy[1], b)
+            self._norm = math.pow(energy[2], b) - self._pow0
+        end
+
+        -- Set the binning of the estimators
+        local bins = args.bins or 50
+        if (type(bins) ~= 'number') or (bins < 1) or (bins % 1 ~= 0) then
+            raise_error{argname = 'bins',
+                description = 'must be a strictly positive integer'}
+        end
+        self._bins = bins
+        self._dlog = math.log(energy[2] / energy[1]) / bins
+        self._sum = ffi.new('double [?]', 2 * bins)
+        self._events = 0
+
+        -- Set the electric charge
+        local charge = args.charge
+        if (charge ~= nil) and (charge ~= -1) and (charge ~= 1) then
+            raise_error{argname = 'charge', expected = '-1 or 1',
+                got = metatype.a(charge)}
+        end
+        self._charge = charge
+
+        -- Set the sampling of the direction
+        if (args.elevation ~= nil) or (args.azimuth ~= nil) then
+            local deg = math.pi / 180
+            local elevation = (args.elevation ~= nil) and
+                check_range(args, 'elevation', -90 * deg, 90 * deg) or
+                {-90 * deg, 90 * deg}
+            local azimuth = (args.azimuth ~= nil) and
+                check_range(args, 'azimuth') or {0, 360 * deg}
+
+            local frame = args.frame
+            if frame == nil then
+                frame = coordinates.LocalFrame(
+                    coordinates.GeodeticPoint():set(state.position))
+            elseif metatype(frame) ~= 'UnitaryTransformation' then
+                raise_error{argname = 'frame',
+                    expected = 'a UnitaryTransformation cdata',
+                    got = metatype.a(frame)}
+            end
+
+            self._sin_elevation = {math.sin(elevation[1]),
+                math.sin(elevation[2])}
+            self._azimuth = azimuth
+            self._solid_angle = (azimuth[2] - azimuth[1]) *
+                (self._sin_elevation[2] - self._sin_elevation[1])
+            self._frame = frame
+            self._horizontal = coordinates.HorizontalVector{norm = 1,
+                frame = frame}
+            self._cartesian = coordinates.CartesianVector()
+        elseif args.frame ~= nil then
+            raise_error{argname = 'frame',
+                description = 'requires an elevation or azimuth range'}
+        end
+
+        return setmetatable(self, cls)
+    end
+
+    generator.BackwardGenerator = setmetatable(BackwardGenerator,
+        {__call = new})
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function generator.register_to (t)
+    t.BackwardGenerator = generator.BackwardGenerator
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return generator
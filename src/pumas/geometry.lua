@@ -6,6 +6,7 @@
 local earth = require('pumas.geometry.earth')
 local infinite = require('pumas.geometry.infinite')
 local layer = require('pumas.geometry.layer')
+local mesh = require('pumas.geometry.mesh')
 local polyhedron = require('pumas.geometry.polyhedron')
 local topography = require('pumas.geometry.topography')
 
@@ -13,6 +14,7 @@ local geometry = {}
 
 geometry.EarthGeometry = earth.EarthGeometry
 geometry.InfiniteGeometry = infinite.InfiniteGeometry
+geometry.MeshGeometry = mesh.MeshGeometry
 geometry.PolyhedronGeometry = polyhedron.PolyhedronGeometry
 geometry.TopographyData = topography.TopographyData
 geometry.TopographyDataset = topography.TopographyDataset
@@ -25,6 +27,7 @@ geometry.TopographyLayer = layer.TopographyLayer
 function geometry.register_to (t)
     t.EarthGeometry = geometry.EarthGeometry
     t.InfiniteGeometry = geometry.InfiniteGeometry
+    t.MeshGeometry = geometry.MeshGeometry
     t.PolyhedronGeometry = geometry.PolyhedronGeometry
     t.TopographyData = geometry.TopographyData
     t.TopographyDataset = geometry.TopographyDataset
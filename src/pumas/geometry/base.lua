@@ -3,6 +3,7 @@
 -- Author: Valentin Niess
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
+local ffi = require('ffi')
 local clib = require('pumas.clib')
 local error = require('pumas.error')
 local metatype = require('pumas.metatype')
@@ -20,11 +21,17 @@ base.BaseGeometry = {__index = {}}
 base.BaseGeometry.__index.__metatype = 'Geometry'
 
 
+-- Global stamp of geometry modifications. The C nodes are cached per
+-- simulation context, and only recreated if the corresponding geometry has
+-- been modified (see the _update method below)
+local stamp = 0
+
+
 function base.BaseGeometry:new ()
     local obj = {}
     obj._daughters = {}
     obj._mothers = {}
-    obj._valid = true
+    obj._version = 0
     return setmetatable(obj, self)
 end
 
@@ -49,8 +56,8 @@ end
 
 
 function base.BaseGeometry.__index:_invalidate ()
-    walk_up(self, function (g) g._valid = false end)
-    self._valid = false
+    self._version = self._version + 1
+    stamp = stamp + 1
 end
 
 
@@ -86,23 +93,20 @@ do
             }
         end
 
-        -- Invalidate the geometry and its parents
-        -- Also check for circular references
+        -- Check for circular references
         local circular = self == geometry
         if not circular then
             walk_up(self, function (g)
                 if g == geometry then
                     circular = true
                     return true
-                else
-                    g._valid = false
                 end
             end)
         end
         if circular then
             raise_error('circular reference')
         end
-        self._valid = false
+        stamp = stamp + 1
 
         -- Update references
         local count = geometry._mothers[self] or 0
@@ -125,19 +129,107 @@ function base.BaseGeometry.__index:remove (index)
         geometry._mothers[self] = count - 1
     end
 
-    -- Invalidate the geometry and its parents
-    walk_up(self, function (g) g._valid = false end)
-    self._valid = false
+    stamp = stamp + 1
 
     return geometry
 end
 
 
-local function set_daughters (mother, c_mother)
-    for _, daughter in ipairs(mother._daughters) do
-        local c_daughter = daughter:_new()
-        clib.pumas_geometry_push(c_mother, c_daughter)
-        set_daughters(daughter, c_daughter)
+do
+    local ctype = ffi.typeof('struct pumas_geometry_score')
+
+    function base.BaseGeometry.__index:scoring (enable)
+        if enable then
+            local score = rawget(self, '_score')
+            if score == nil then
+                rawset(self, '_score', ctype())
+                stamp = stamp + 1
+            else
+                ffi.fill(score, ffi.sizeof(ctype))
+            end
+        elseif rawget(self, '_score') ~= nil then
+            rawset(self, '_score', nil)
+            stamp = stamp + 1
+        end
+    end
+
+    function base.BaseGeometry.__index:score ()
+        local score = rawget(self, '_score')
+        if score == nil then return nil end
+        return {
+            crossings = score.crossings,
+            energy = score.energy,
+            grammage = score.grammage,
+            length = score.length
+        }
+    end
+end
+
+
+local function build (geometry, cache, used, c_mother)
+    -- Get the cached node, if any
+    local index = (used[geometry] or 0) + 1
+    used[geometry] = index
+    local entries = cache[geometry]
+    if entries == nil then
+        entries = {}
+        cache[geometry] = entries
+    end
+    local entry = entries[index]
+
+    local c
+    if (entry ~= nil) and (entry.version == geometry._version) then
+        -- Recycle the node, detaching it from the previous tree. Daughters
+        -- that are intrinsic to the node, e.g. for polyhedrons, are kept
+        c = entry.c
+        if entry.tail == nil then
+            c.daughters = nil
+        else
+            entry.tail.next = nil
+        end
+        c.mother = nil
+        c.next = nil
+    else
+        if (entry ~= nil) and (entry.c.destroy ~= nil) then
+            entry.c.destroy(entry.c)
+        end
+
+        c = geometry:_new()
+        local tail = c.daughters
+        if tail ~= nil then
+            while tail.next ~= nil do tail = tail.next end
+        end
+        entries[index] = {c = c, tail = tail, version = geometry._version}
+    end
+
+    c.score = rawget(geometry, '_score')
+    if c_mother ~= nil then
+        clib.pumas_geometry_push(c_mother, c)
+    end
+
+    for _, daughter in ipairs(geometry._daughters) do
+        build(daughter, cache, used, c)
+    end
+
+    return c
+end
+
+
+-- Release the C nodes cached by a simulation context. Only the cached nodes
+-- are destroyed, since other nodes of the C tree are owned by Lua objects,
+-- e.g. the faces of polyhedrons. Note that this is also called by the context
+-- finalizer, when the Lua objects might have already been collected
+function base.release (c, holder)
+    clib.pumas_geometry_clear(c)
+
+    local cache = holder.cache
+    if cache == nil then return end
+    holder.cache = nil
+
+    for _, entries in pairs(cache.nodes) do
+        for _, entry in ipairs(entries) do
+            if entry.c.destroy ~= nil then entry.c.destroy(entry.c) end
+        end
     end
 end
 
@@ -145,14 +237,38 @@ end
 function base.BaseGeometry.__index:_update (context)
     clib.pumas_geometry_reset(context._c)
 
-    if (clib.pumas_geometry_get(context._c) ~= nil) and self._valid then
+    local holder = context._nodes
+    local cache = holder.cache
+    if (cache ~= nil) and (cache.geometry == self) and
+       (cache.stamp == stamp) and
+       (clib.pumas_geometry_get(context._c) ~= nil) then
         return
     end
 
-    local c = self:_new()
-    set_daughters(self, c)
+    -- Rebuild the C tree, recycling unmodified nodes
+    if (cache == nil) or (cache.geometry ~= self) then
+        base.release(context._c, holder)
+        cache = {geometry = self, nodes = {}}
+        holder.cache = cache
+    end
+
+    local used = {}
+    local c = build(self, cache.nodes, used, nil)
+
+    -- Release the nodes of removed geometries
+    for geometry, entries in pairs(cache.nodes) do
+        local n = used[geometry] or 0
+        for i = #entries, n + 1, -1 do
+            local entry = entries[i]
+            if entry.c.destroy ~= nil then entry.c.destroy(entry.c) end
+            entries[i] = nil
+        end
+        if n == 0 then cache.nodes[geometry] = nil end
+    end
+
     clib.pumas_geometry_set(context._c, c)
-    self._valid = true
+    clib.pumas_geometry_reset(context._c)
+    cache.stamp = stamp
 end
 
 
@@ -31,35 +31,61 @@ local ctype_ptr = ffi.typeof('struct pumas_geometry_earth *')
 local pumas_geometry_ptr = ffi.typeof('struct pumas_geometry *')
 
 
+-- Check if all layers are flat, i.e. if the geometry is a set of concentric
+-- ellipsoidal shells
+local function is_flat (self, layers)
+    if self._geoid_undulations then return false end
+
+    for _, layer in ipairs(layers) do
+        if layer.data[1]._elevation then return false end
+    end
+
+    return true
+end
+
+
 local function new (self)
     local c = ffi.cast(ctype_ptr, ffi.C.calloc(1, ffi.sizeof(ctype)))
 
-    c.base.get = clib.pumas_geometry_earth_get
     c.base.reset = clib.pumas_geometry_earth_reset
     c.base.destroy = clib.pumas_geometry_earth_destroy
     c.media = self._media
     local layers = readonly.rawget(self.layers)
     c.n_layers = #layers
 
-    call(clib.turtle_stepper_create, c.stepper)
+    if is_flat(self, layers) then
+        -- Use closed form intersections with ellipsoidal shells instead of
+        -- the generic stepper
+        c.base.get = clib.pumas_geometry_earth_flat_get
+        c.base.exact = 1
+        c.flat = ffi.C.calloc(#layers, ffi.sizeof('double'))
+        for i, layer in ipairs(layers) do
+            c.flat[#layers - i] = layer.data[1].offset
+        end
+    else
+        c.base.get = clib.pumas_geometry_earth_get
+        call(clib.turtle_stepper_create, c.stepper)
 
-    if self._geoid_undulations then
-        clib.turtle_stepper_geoid_set(c.stepper[0], self._geoid_undulations._c)
-    end
+        if self._geoid_undulations then
+            clib.turtle_stepper_geoid_set(c.stepper[0],
+                self._geoid_undulations._c)
+        end
 
-    for i = #layers, 1, -1 do
-        local data = layers[i].data
+        for i = #layers, 1, -1 do
+            local data = layers[i].data
 
-        if i < #layers then
-            call(clib.turtle_stepper_add_layer, c.stepper[0])
-        end
+            if i < #layers then
+                call(clib.turtle_stepper_add_layer, c.stepper[0])
+            end
 
-        for j = #data, 1, -1 do
-            local datum = data[j]
-            if datum._elevation then
-                call(datum._stepper_add, c.stepper[0], datum._c, datum.offset)
-            else
-                call(datum._stepper_add, c.stepper[0], datum.offset)
+            for j = #data, 1, -1 do
+                local datum = data[j]
+                if datum._elevation then
+                    call(datum._stepper_add, c.stepper[0], datum._c,
+                        datum.offset)
+                else
+                    call(datum._stepper_add, c.stepper[0], datum.offset)
+                end
             end
         end
     end
@@ -72,20 +98,29 @@ local function new (self)
             table.insert(matches, tonumber(match))
         end
 
-        local magnet
-        if self._magnet == true then
-            magnet = os.tmpname()
-            local f = io.open(magnet, 'a+')
-            f:write(require('pumas.data.igrf13'))
-            f:close()
+        local errmsg
+        if (self._magnet == true) and (ffi.os == 'Linux') then
+            -- Parse the embedded IGRF data from memory
+            local igrf = require('pumas.data.igrf13')
+            errmsg = call.protected(
+                clib.pumas_geometry_earth_snapshot_create, c.magnet.snapshot,
+                igrf, #igrf, matches[1], matches[2], matches[3])
         else
-            magnet = self._magnet
-        end
+            local magnet
+            if self._magnet == true then
+                magnet = os.tmpname()
+                local f = io.open(magnet, 'a+')
+                f:write(require('pumas.data.igrf13'))
+                f:close()
+            else
+                magnet = self._magnet
+            end
 
-        local errmsg = call.protected(
-            ffi.C.gull_snapshot_create, c.magnet.snapshot, magnet,
-            matches[1], matches[2], matches[3])
-        if self._magnet == true then os.remove(magnet) end
+            errmsg = call.protected(
+                ffi.C.gull_snapshot_create, c.magnet.snapshot, magnet,
+                matches[1], matches[2], matches[3])
+            if self._magnet == true then os.remove(magnet) end
+        end
         if errmsg then
             error.raise{
                 fname = 'EarthGeometry.new',
@@ -151,7 +186,8 @@ function EarthGeometry:__newindex (k, v)
             if metatype(v) == 'TopographyData' then
                 undulations = v
             else
-                undulations = topography.TopographyData(v)
+                undulations = topography.TopographyData(v, nil,
+                    rawget(self, '_cache'))
             end
 
             if not ffi.istype('struct turtle_map *', undulations._c) then
@@ -189,18 +225,25 @@ do
         local self = base.BaseGeometry:new()
         local layers = compat.table_new(nargs, 0)
         local ilayer = 0
-        local magnet, date, geoid_undulations
+        local magnet, date, geoid_undulations, cache
 
-        local function add(args, index)
-            for i, arg in ipairs(args) do
+        -- Options are collected first, since the cache applies to all data
+        local function scan(args)
+            for _, arg in ipairs(args) do
                 if metatype(arg) == 'table' then
                     if arg.magnet then magnet = arg.magnet end
                     if arg.date then date = arg.date end
                     if arg.geoid_undulations then
                         geoid_undulations = arg.geoid_undulations
                     end
+                    if arg.cache then cache = arg.cache end
+                    if (not arg.medium) and (not arg.data) then scan(arg) end
                 end
+            end
+        end
 
+        local function add(args, index)
+            for i, arg in ipairs(args) do
                 local medium, data = arg.medium, arg.data
                 if (not medium) and (not data) and type(arg) == 'table' then
                     add(arg, index or i)
@@ -233,7 +276,8 @@ do
                         for j, datum in ipairs(data) do
                             local mt_ = metatype(datum)
                             if (mt_ == 'string') or (mt_ == 'number') then
-                                data[j] = topography.TopographyData(datum)
+                                data[j] = topography.TopographyData(datum,
+                                    nil, cache)
                             elseif mt_ ~= 'TopographyData' then
                                 raise_error{argnum = (index or i)..' (data)',
                                     expected = 'a TopographyData table, \z
@@ -254,6 +298,11 @@ do
             end
         end
 
+        scan{...}
+        if (cache ~= nil) and (type(cache) ~= 'string') then
+            raise_error{argname = 'cache', expected = 'a string',
+                got = metatype.a(cache)}
+        end
         add{...}
 
         -- XXX Provide elevation and frame methods?
@@ -270,6 +319,7 @@ do
         end
 
         self._media = media
+        self._cache = cache
         self.layers = readonly.Readonly(layers)
 
         self = setmetatable(self, cls)
@@ -53,7 +53,7 @@ function InfiniteGeometry:__newindex (k, v)
             }
         end
         rawset(self,'_medium', v)
-        self._invalidate()
+        self:_invalidate()
     else
         rawset(self, k, v)
     end
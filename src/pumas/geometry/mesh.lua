@@ -0,0 +1,267 @@
+-------------------------------------------------------------------------------
+-- Triangle mesh geometry for PUMAS
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local clib = require('pumas.clib')
+local coordinates = require('pumas.coordinates')
+local error = require('pumas.error')
+local base = require('pumas.geometry.base')
+local uniform = require('pumas.medium.uniform')
+local metatype = require('pumas.metatype')
+
+local mesh = {}
+
+
+-------------------------------------------------------------------------------
+-- The mesh geometry metatype
+-------------------------------------------------------------------------------
+local MeshGeometry = {}
+
+
+local function new (self)
+    local c = ffi.cast('struct pumas_geometry_mesh *',
+        ffi.C.calloc(1, ffi.sizeof('struct pumas_geometry_mesh')))
+    c.base.get = clib.pumas_geometry_mesh_get
+    c.base.destroy = ffi.C.free
+    if self._medium ~= nil then
+        c.medium = ffi.cast('struct pumas_medium *', self._medium._c)
+    end
+    c.mesh = self._mesh
+    return ffi.cast('struct pumas_geometry *', c)
+end
+
+
+function MeshGeometry:__index (k)
+    if k == 'medium' then
+        return self._medium
+    elseif k == 'triangles' then
+        return self._triangles
+    elseif k == '_new' then
+        return new
+    else
+        return base.BaseGeometry.__index[k]
+    end
+end
+
+
+function MeshGeometry:__newindex (k, v)
+    if k == 'medium' then
+        if v == self._medium then return end
+        if metatype(v) ~= 'Medium' then
+            error.raise{
+                fname = k,
+                expected = 'a Medium table',
+                got = metatype.a(v)
+            }
+        end
+        rawset(self,'_medium', v)
+        self:_invalidate()
+    elseif k == 'triangles' then
+        error.raise{
+            ['type'] = 'MeshGeometry',
+            not_mutable = k
+        }
+    else
+        rawset(self, k, v)
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Loaders for triangle soups
+-------------------------------------------------------------------------------
+local function read_file (path, fname)
+    local file = io.open(path, 'rb')
+    if file == nil then
+        error.raise{
+            fname = fname,
+            argnum = 2,
+            description = "could not open file '"..path.."'"
+        }
+    end
+    local data = file:read('*a')
+    file:close()
+    return data
+end
+
+
+local function load_stl (path, fname)
+    local data = read_file(path, fname)
+
+    -- Binary STL: 80 bytes header, uint32 count and 50 bytes per facet
+    if #data >= 84 then
+        local n = ffi.cast('const uint32_t *', ffi.cast('const char *',
+            data) + 80)[0]
+        if #data == 84 + 50 * n then
+            local vertices = ffi.new('double [?]', 9 * n)
+            local facet = ffi.new('float [12]')
+            local ptr = ffi.cast('const char *', data) + 84
+            for i = 0, n - 1 do
+                ffi.copy(facet, ptr + 50 * i, 48)
+                for j = 0, 8 do
+                    vertices[9 * i + j] = facet[j + 3]
+                end
+            end
+            return n, vertices
+        end
+    end
+
+    -- ASCII STL
+    local values = {}
+    for x, y, z in data:gmatch('vertex%s+(%S+)%s+(%S+)%s+(%S+)') do
+        table.insert(values, tonumber(x))
+        table.insert(values, tonumber(y))
+        table.insert(values, tonumber(z))
+    end
+    return values
+end
+
+
+local function load_obj (path, fname)
+    local data = read_file(path, fname)
+
+    local vertices, values = {}, {}
+    for line in data:gmatch('[^\r\n]+') do
+        local tag, tail = line:match('^%s*(%S+)%s+(.*)$')
+        if tag == 'v' then
+            local x, y, z = tail:match('^(%S+)%s+(%S+)%s+(%S+)')
+            table.insert(vertices, {tonumber(x), tonumber(y), tonumber(z)})
+        elseif tag == 'f' then
+            -- Polygonal faces are triangulated as fans
+            local face = {}
+            for index in tail:gmatch('(%-?%d+)[^%s]*') do
+                index = tonumber(index)
+                if index < 0 then index = #vertices + 1 + index end
+                local vertex = vertices[index]
+                if vertex == nil then
+                    error.raise{
+                        fname = fname,
+                        argnum = 2,
+                        description = 'bad vertex index in '..path
+                    }
+                end
+                table.insert(face, vertex)
+            end
+            for i = 2, #face - 1 do
+                for _, vertex in ipairs{face[1], face[i], face[i + 1]} do
+                    table.insert(values, vertex[1])
+                    table.insert(values, vertex[2])
+                    table.insert(values, vertex[3])
+                end
+            end
+        end
+    end
+    return values
+end
+
+
+-------------------------------------------------------------------------------
+-- The mesh geometry constructor
+-------------------------------------------------------------------------------
+do
+    local function new_ (cls, medium, data, frame)
+        local fname = 'MeshGeometry'
+
+        local mt = metatype(medium)
+        if mt == 'string' then
+            medium = uniform.UniformMedium(medium)
+        elseif (mt ~= 'nil') and (mt ~= 'Medium') then
+            error.raise{
+                fname = fname,
+                argnum = 1,
+                expected = 'a Medium table or a string',
+                got = metatype.a(medium)
+            }
+        end
+
+        local n, vertices
+        if type(data) == 'string' then
+            local format = data:match('^.+%.(.+)$')
+            format = format and format:lower()
+            if format == 'stl' then
+                n, vertices = load_stl(data, fname)
+            elseif format == 'obj' then
+                n, vertices = load_obj(data, fname)
+            else
+                error.raise{
+                    fname = fname,
+                    argnum = 2,
+                    description = 'unknown format '..tostring(format)
+                }
+            end
+        elseif type(data) == 'table' then
+            n = data
+        else
+            error.raise{
+                fname = fname,
+                argnum = 2,
+                expected = 'a string or a table',
+                got = metatype.a(data)
+            }
+        end
+
+        if type(n) == 'table' then
+            local values = n
+            n = math.floor(#values / 9)
+            if #values ~= 9 * n then
+                error.raise{
+                    fname = fname,
+                    argnum = 2,
+                    expected = 'n x 9 values',
+                    got = #values
+                }
+            end
+            vertices = ffi.new('double [?]', 9 * n)
+            for i = 1, 9 * n do
+                vertices[i - 1] = values[i]
+            end
+        end
+
+        if n == 0 then
+            error.raise{
+                fname = fname,
+                argnum = 2,
+                description = 'empty mesh'
+            }
+        end
+
+        if frame ~= nil then
+            local point = coordinates.CartesianPoint()
+            local vertex = ffi.new('double [3]')
+            for i = 0, 3 * n - 1 do
+                ffi.copy(vertex, vertices + 3 * i, ffi.sizeof(vertex))
+                point:set(vertex)
+                point.frame = frame
+                point:transform(nil)
+                vertices[3 * i] = point.x
+                vertices[3 * i + 1] = point.y
+                vertices[3 * i + 2] = point.z
+            end
+        end
+
+        local c = clib.pumas_mesh_create(n, vertices)
+        if c == nil then
+            error.raise{
+                fname = fname,
+                description = 'could not build the mesh'
+            }
+        end
+
+        local self = base.BaseGeometry:new()
+        self._medium = medium
+        self._mesh = ffi.gc(c, clib.pumas_mesh_destroy)
+        self._triangles = n
+
+        return setmetatable(self, cls)
+    end
+
+    mesh.MeshGeometry = setmetatable(MeshGeometry, {__call = new_})
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return mesh
@@ -29,178 +29,45 @@ local pumas_medium_ptr = ffi.typeof('struct pumas_medium *')
 
 
 local function new (self)
-    return ffi.cast(pumas_geometry_ptr, self._refs[1])
-end
-
-
-local function dot (a, b)
-    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
-end
-
-
-local function cross (a, b, c)
-    c[0] = a[1] * b[2] - a[2] * b[1]
-    c[1] = a[2] * b[0] - a[0] * b[2]
-    c[2] = a[0] * b[1] - a[1] * b[0]
-end
-
-
--- Intersection of 3 planes
--- Ref: https://mathworld.wolfram.com/Plane-PlaneIntersection.html
-local function intersect3 (x1, n1, x2, n2, x3, n3, x)
-    local det =   n1[0] * n2[1] * n3[2]
-                + n2[0] * n3[1] * n1[2]
-                + n3[0] * n1[1] * n2[2]
-                - n3[0] * n2[1] * n1[2]
-                - n1[0] * n3[1] * n2[2]
-                - n2[0] * n1[1] * n3[2]
-    if math.abs(det) < 1E-13 then return false end
-
-    local x1n1 = dot(x1, n1)
-    local x2n2 = dot(x2, n2)
-    local x3n3 = dot(x3, n3)
-    local n2n3 = ffi.new('double [3]')
-    local n3n1 = ffi.new('double [3]')
-    local n1n2 = ffi.new('double [3]')
-    cross(n2, n3, n2n3)
-    cross(n3, n1, n3n1)
-    cross(n1, n2, n1n2)
-
-    for k = 0, 2 do
-        x[k] = (x1n1 * n2n3[k] + x2n2 * n3n1[k] +
-                x3n3 * n1n2[k]) / det
+    -- Detach any daughter appended by a previous build
+    local c = ffi.cast(pumas_geometry_ptr, self._refs[1])
+    local tail = rawget(self, '_tail')
+    if tail == nil then
+        c.daughters = nil
+    else
+        tail.next = nil
     end
-
-    return true
+    return c
 end
 
 
-local function convert_polyhedron (poly, color, all_vertices, all_faces)
-    -- Find the vertices
-    local vertices = {}
-    do
-        local vertex = ffi.new('double [3]')
-        for i = 0, poly.n_faces - 1 do
-            for j = i + 1, poly.n_faces - 1 do
-                for k = j + 1, poly.n_faces - 1 do
-                    if intersect3(
-                        poly.faces[i].origin, poly.faces[i].normal,
-                        poly.faces[j].origin, poly.faces[j].normal,
-                        poly.faces[k].origin, poly.faces[k].normal,
-                        vertex)
-                    then
-                        local valid = true
-                        for l = 0, poly.n_faces - 1 do
-                            if (l ~= i) and (l ~= j) and (l ~= k) then
-                                local f = poly.faces[l]
-                                local d =
-                                    f.normal[0] * (vertex[0] - f.origin[0]) +
-                                    f.normal[1] * (vertex[1] - f.origin[1]) +
-                                    f.normal[2] * (vertex[2] - f.origin[2])
-                                if d > 0 then
-                                    valid = false
-                                    break
-                                end
-                            end
-                        end
-                        if valid then
-                            local v = ffi.new('double [3]', vertex)
-                            table.insert(vertices, {i, j, k, v})
-                        end
-                    end
-                end
-            end
-        end
-    end
-
-    -- Resolve the color
-    local wrapped_medium = medium.get(poly.medium)
-    local red, green, blue, alpha = color(wrapped_medium)
-
-    -- Map the faces
-    local index0 = #all_vertices
-    for i = 0, poly.n_faces - 1 do
-        local index, n_vertices = {}, 0
-        for _, vertex in ipairs(vertices) do
-            if (i == vertex[1]) or (i == vertex[2]) or (i == vertex[3]) then
-                table.insert(index, {0, vertex[4]})
-                n_vertices = n_vertices + 1
-            end
-        end
-
-        if n_vertices >= 3 then
-            local c = ffi.new('double [3]')
-            for _, vertex in ipairs(index) do
-                for k = 0, 2 do
-                    c[k] = c[k] + vertex[2][k]
-                end
-            end
-            for k = 0, 2 do
-                c[k] = c[k] / #index
-            end
-
-            local ux = ffi.new('double [3]')
-            local norm = 0
-            for k = 0, 2 do
-                ux[k] = index[1][2][k] - c[k]
-                norm = norm + ux[k]^2
-            end
-            norm = 1 / math.sqrt(norm)
-            for k = 0, 2 do
-                ux[k] = ux[k] * norm
-            end
-
-            local uy = ffi.new('double [3]')
-            cross(poly.faces[i].normal, ux, uy)
-
-            for _, vertex in ipairs(index) do
-                local r = ffi.new('double [3]')
-                for k = 0, 2 do
-                    r[k] = vertex[2][k] - c[k]
-                end
-                local x = dot(r, ux)
-                local y = dot(r, uy)
-
-                vertex[1] = math.atan2(y, x)
-            end
-
-            table.sort(index, function (a, b)
-                return a[1] < b[1]
-            end)
-
-            local nx = tonumber(poly.faces[i].normal[0])
-            local ny = tonumber(poly.faces[i].normal[1])
-            local nz = tonumber(poly.faces[i].normal[2])
-            for j, vertex in ipairs(index) do
-                local r = vertex[2]
-                table.insert(all_vertices, {tonumber(r[0]), tonumber(r[1]),
-                    tonumber(r[2]), nx, ny, nz, red, green, blue, alpha})
-                index[j] = index0 + j - 1
-            end
-            index0 = index0 + #index
-
-            for j = 1, #index - 2 do
-                table.insert(all_faces,
-                    {index[1], index[j + 1], index[j + 2]})
-            end
-        end
-    end
-
-    -- Convert daughter volumes
+-- Collect the polyhedrons of the hierarchy, depth first
+local function collect_polyhedrons (poly, polyhedrons)
+    table.insert(polyhedrons, poly)
     local daughter = poly.base.daughters
     while daughter ~= nil do
-        local p = ffi.cast('struct pumas_geometry_polyhedron *', daughter)
-        convert_polyhedron(p, color, all_vertices, all_faces)
+        collect_polyhedrons(ffi.cast(ctype_ptr, daughter), polyhedrons)
         daughter = daughter.next
     end
+    return polyhedrons
 end
 
 
 local ply_initialised = false
 
 local function export_ply (self, path, color)
-    local vertices, faces = {}, {}
-    convert_polyhedron(self._refs[1], color, vertices, faces)
+    -- Compute the polygons of all polyhedrons, in parallel
+    local polyhedrons = collect_polyhedrons(self._refs[1], {})
+    local n = #polyhedrons
+    local polygons = ffi.new('struct pumas_polyhedron_polygons [?]', n)
+    if clib.pumas_polyhedron_polygons(n,
+        ffi.new('struct pumas_geometry_polyhedron *[?]', n, polyhedrons),
+        polygons) ~= 0 then
+        error.raise{
+            fname = 'export',
+            description = 'could not compute the polyhedrons faces'
+        }
+    end
 
     if not ply_initialised then
         ffi.cdef([[
@@ -217,8 +84,53 @@ local function export_ply (self, path, color)
             unsigned char alpha;
         };
         ]])
+        ply_initialised = true
+    end
+
+    -- Count the vertices and the triangles
+    local n_vertices, n_triangles = 0, 0
+    for i = 0, n - 1 do
+        local p = polygons[i]
+        n_vertices = n_vertices + p.n_vertices
+        n_triangles = n_triangles + p.n_vertices - 2 * p.n_polygons
     end
 
+    -- Fill the vertices and triangles (binary) buffers
+    local vertices = ffi.new('struct ply_vertex [?]', n_vertices)
+    local triangle_size = 1 + 3 * ffi.sizeof('int')
+    local triangles = ffi.new('unsigned char [?]', n_triangles *
+        triangle_size)
+    local index = ffi.new('int [3]')
+    local iv, it = 0, 0
+    for i = 0, n - 1 do
+        local poly, p = polyhedrons[i + 1], polygons[i]
+        local wrapped_medium = medium.get(poly.medium)
+        local red, green, blue, alpha = color(wrapped_medium)
+
+        local r = p.vertices
+        for j = 0, p.n_polygons - 1 do
+            local normal = poly.faces[p.faces[j]].normal
+            local size = p.sizes[j]
+            for k = 0, size - 1 do
+                local v = vertices[iv + k]
+                v.x, v.y, v.z = r[0], r[1], r[2]
+                v.nx, v.ny, v.nz = normal[0], normal[1], normal[2]
+                v.red, v.green, v.blue, v.alpha = red, green, blue, alpha
+                r = r + 3
+            end
+
+            for k = 1, size - 2 do
+                local t = triangles + it * triangle_size
+                t[0] = 3
+                index[0], index[1], index[2] = iv, iv + k, iv + k + 1
+                ffi.copy(t + 1, index, ffi.sizeof(index))
+                it = it + 1
+            end
+            iv = iv + size
+        end
+    end
+    clib.pumas_polyhedron_polygons_clear(n, polygons)
+
     local header = string.format([[
 ply
 format binary_little_endian 1.0
@@ -237,22 +149,13 @@ property uchar alpha
 element face %d
 property list uchar int vertex_indices
 end_header
-]], #vertices, #faces)
+]], n_vertices, n_triangles)
 
-    local file = io.open(path, 'w')
+    local file = io.open(path, 'wb')
     file:write(header)
-    local v = ffi.new('struct ply_vertex[1]')
-    for _, vertex in ipairs(vertices) do
-        v[0] = vertex
-        ffi.C.fwrite(v, ffi.sizeof('struct ply_vertex'), 1, file)
-    end
-    local size = ffi.new('unsigned char [1]')
-    for _, face in ipairs(faces) do
-        size[0] = #face
-        ffi.C.fwrite(size, ffi.sizeof(size), 1, file)
-        local index = ffi.new('int [?]', #face, face)
-        ffi.C.fwrite(index, ffi.sizeof('int'), #face, file)
-    end
+    file:write(ffi.string(vertices, ffi.sizeof(vertices)))
+    file:write(ffi.string(triangles, ffi.sizeof(triangles)))
+    file:close()
 end
 
 
@@ -357,7 +260,7 @@ local function build_polyhedrons (args, frame, refs, depth, index)
     do
         local mt = metatype(medium_)
         if mt == 'string' then
-            medium_ = medium.UniformMedium(medium)
+            medium_ = medium.UniformMedium(medium_)
         elseif (mt ~= 'nil') and (mt ~= 'Medium') then
             error.raise{
                 fname = 'Polyhedron '..get_tag(depth, index),
@@ -479,7 +382,12 @@ do
             args = load_ply(args)
         end
 
-        build_polyhedrons(args, frame, self._refs, 1, 0)
+        local c = build_polyhedrons(args, frame, self._refs, 1, 0)
+        local tail = c.daughters
+        if tail ~= nil then
+            while tail.next ~= nil do tail = tail.next end
+            self._tail = tail
+        end
 
         if frame ~= nil then
             point = nil
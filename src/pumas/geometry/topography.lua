@@ -3,6 +3,7 @@
 -- Author: Valentin Niess
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
+local bit = require('bit')
 local ffi = require('ffi')
 local lfs = require('lfs')
 local call = require('pumas.call')
@@ -15,6 +16,128 @@ local type_ = require('pumas.coordinates.type')
 local topography = {}
 
 
+-------------------------------------------------------------------------------
+-- Batched queries over arrays of geodetic coordinates
+-------------------------------------------------------------------------------
+local batch = {}
+
+do
+    -- Length of a double array, or nil for other cdata, e.g. pointers
+    local function array_length (x)
+        if tostring(ffi.typeof(x)):match('^ctype<double %[[%d?]+%]>$') then
+            return ffi.sizeof(x) / ffi.sizeof('double')
+        end
+    end
+
+    local function get_input (fname, argnum, input)
+        local tp = type(input)
+        if tp == 'table' then
+            local n = #input
+            local c_input = ffi.new('double [?]', n)
+            for i = 1, n do c_input[i - 1] = input[i] end
+            return n, c_input
+        elseif (tp == 'cdata') and array_length(input) then
+            return array_length(input), ffi.cast('const double *', input)
+        else
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a number, a table or a double [?] cdata',
+                got = metatype.a(input)}
+        end
+    end
+
+    local function get_output (fname, argnum, output, n, tp)
+        if output == nil then
+            if tp == 'table' then
+                return compat.table_new(n, 0), ffi.new('double [?]', n)
+            else
+                output = ffi.new('double [?]', n)
+                return output, output
+            end
+        elseif type(output) == 'table' then
+            return output, ffi.new('double [?]', n)
+        elseif (type(output) == 'cdata') and
+            ((array_length(output) or -1) >= n) then
+            return output, ffi.cast('double *', output)
+        else
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a table or a double ['..n..'] cdata',
+                got = metatype.a(output)}
+        end
+    end
+
+    local function get_arguments (fname, latitude, longitude, threads)
+        local n, c_latitude = get_input(fname, 2, latitude)
+        local m, c_longitude = get_input(fname, 3, longitude)
+        if m ~= n then
+            error.raise{fname = fname, argnum = 3,
+                expected = n..' values', got = m}
+        end
+
+        -- Zero threads stands for one thread per CPU
+        if threads == nil then
+            threads = 1
+        elseif (type(threads) ~= 'number') or (threads < 0) or
+            (threads % 1 ~= 0) then
+            error.raise{fname = fname, argname = 'threads',
+                expected = 'a positive integer or zero',
+                got = (type(threads) == 'number') and threads or
+                    metatype.a(threads)}
+        end
+
+        return n, c_latitude, c_longitude, threads
+    end
+
+    local function copy (output, c_output, n)
+        if type(output) == 'table' then
+            for i = 1, n do output[i] = tonumber(c_output[i - 1]) end
+        end
+    end
+
+    -- Check if the arguments of a query are arrays
+    function batch.check (x, y)
+        return (type(x) == 'table') or ((type(x) == 'cdata') and
+            (y ~= nil) and (type(y) ~= 'number'))
+    end
+
+    -- Elevations from the first data covering each point, or NaN
+    function batch.elevation (fname, set, latitude, longitude, output,
+        threads)
+        local n, c_latitude, c_longitude
+        n, c_latitude, c_longitude, threads = get_arguments(fname, latitude,
+            longitude, threads)
+        local c_output
+        output, c_output = get_output(fname, 4, output, n, type(latitude))
+
+        local data = ffi.new('struct pumas_topography_data [?]', #set)
+        for i, t in ipairs(set) do t:_fill(data[i - 1]) end
+        call(clib.pumas_topography_elevation, #set, data, n, c_latitude,
+            c_longitude, c_output, threads)
+
+        copy(output, c_output, n)
+        return output
+    end
+
+    -- Map coordinates of geodetic points
+    function batch.project (fname, data, latitude, longitude, x, y, threads)
+        local n, c_latitude, c_longitude
+        n, c_latitude, c_longitude, threads = get_arguments(fname, latitude,
+            longitude, threads)
+        local c_x, c_y
+        x, c_x = get_output(fname, 4, x, n, type(latitude))
+        y, c_y = get_output(fname, 5, y, n, type(latitude))
+
+        local c_data = ffi.new('struct pumas_topography_data [1]')
+        data:_fill(c_data[0])
+        call(clib.pumas_topography_project, c_data, n, c_latitude,
+            c_longitude, c_x, c_y, threads)
+
+        copy(x, c_x, n)
+        copy(y, c_y, n)
+        return x, y
+    end
+end
+
+
 -------------------------------------------------------------------------------
 -- The topography data metatypes
 -------------------------------------------------------------------------------
@@ -22,8 +145,10 @@ local TopographyData = {}
 
 do
     local pumas_geodetic_point_t = ffi.typeof('struct pumas_geodetic_point')
+    local z = ffi.new('double [1]')
+    local inside = ffi.new('int [1]')
 
-    local function elevation (self, x, y)
+    local function elevation (self, x, y, output, threads)
         if (self == nil) or (x == nil) then
             local args = {self, x, y}
             error.raise{
@@ -31,7 +156,9 @@ do
                 got = #args}
         end
 
-        if y == nil then
+        if batch.check(x, y) then
+            return batch.elevation('elevation', {self}, x, y, output, threads)
+        elseif y == nil then
             local geodetic
             if ffi.istype(pumas_geodetic_point_t, x) then
                 geodetic = x
@@ -57,8 +184,6 @@ do
         end
 
         if self._elevation then
-            local z = ffi.new('double [1]')
-            local inside = ffi.new('int [1]')
             call(self._elevation, self._c, x, y, z, inside)
             if inside[0] == 1 then
                 return z[0] + self._offset
@@ -87,8 +212,56 @@ do
         return setmetatable(new, TopographyData)
     end
 
+    local xmap = ffi.new('double [1]')
+    local ymap = ffi.new('double [1]')
+
+    local function project (self, latitude, longitude, x, y, threads)
+        if (self == nil) or (latitude == nil) or (longitude == nil) then
+            local args = {self, latitude, longitude}
+            error.raise{
+                fname = 'project', argnum = 'bad', expected = 3,
+                got = #args}
+        end
+
+        if batch.check(latitude, longitude) then
+            return batch.project('project', self, latitude, longitude, x, y,
+                threads)
+        end
+
+        local argnum, argval
+        if type(latitude) ~= 'number' then argnum, argval = 2, latitude end
+        if type(longitude) ~= 'number' then argnum, argval = 3, longitude end
+        if argnum then
+            error.raise{
+                fname = 'project', argnum = argnum,
+                expected = 'a number', got = metatype.a(argval)}
+        end
+
+        local projection = (self._stepper_add == clib.turtle_stepper_add_map)
+            and clib.turtle_map_projection(self._c) or nil
+        if projection == nil then
+            return longitude, latitude
+        else
+            call(clib.turtle_projection_project, projection, latitude,
+                longitude, xmap, ymap)
+            return xmap[0], ymap[0]
+        end
+    end
+
+    -- Fill the C data for batched queries
+    local function fill (self, data)
+        data.map, data.stack = nil, nil
+        if self._stepper_add == clib.turtle_stepper_add_map then
+            data.map = self._c
+        elseif self._stepper_add == clib.turtle_stepper_add_stack then
+            data.stack = self._c
+        end
+        data.offset = self._offset
+    end
+
     error.register('TopographyData.__index.clone', clone)
     error.register('TopographyData.__index.elevation', elevation)
+    error.register('TopographyData.__index.project', project)
 
     function TopographyData:__index (k)
         if k == '__metatype' then
@@ -101,6 +274,10 @@ do
             return rawget(self, '_offset')
         elseif k == 'path' then
             return rawget(self, '_path')
+        elseif k == 'project' then
+            return project
+        elseif k == '_fill' then
+            return fill
         else
             error.raise{
                 ['type'] = 'TopographyData', bad_member = k}
@@ -122,7 +299,7 @@ do
                     geometry:_invalidate()
                 end
             end
-        elseif (k == 'path') or (k == 'elevation') then
+        elseif (k == 'path') or (k == 'elevation') or (k == 'project') then
             error.raise{
                 ['type'] = 'TopographyData', not_mutable = k}
         else
@@ -164,14 +341,15 @@ end
 -- The topography data constructor
 -------------------------------------------------------------------------------
 do
+    local xmap = ffi.new('double [1]')
+    local ymap = ffi.new('double [1]')
+
     local function map_elevation (self, x, y, z, inside)
         local projection = clib.turtle_map_projection(self)
 
         if projection == nil then
             x, y = y, x
         else
-            local xmap = ffi.new('double [1]')
-            local ymap = ffi.new('double [1]')
             clib.turtle_projection_project(projection, x, y, xmap, ymap)
             x, y = xmap[0], ymap[0]
         end
@@ -179,8 +357,55 @@ do
         return clib.turtle_map_elevation(self, x, y, z, inside)
     end
 
-    local function new (cls, data, offset)
+    -- Name of the cache file of a map. It is keyed on a FNV-1a hash of the
+    -- absolute path of the source data, prefixed by its base name
+    local function cache_name (path)
+        local absolute = path
+        if not (path:match('^[/\\]') or path:match('^%a:[/\\]')) then
+            absolute = lfs.currentdir()..'/'..path
+        end
+
+        local h = 14695981039346656037ULL
+        for i = 1, #absolute do
+            h = bit.bxor(h, absolute:byte(i)) * 1099511628211ULL
+        end
+
+        local basename = path:match('([^/\\]*)$')
+        return basename..'-'..bit.tohex(h)..'.map'
+    end
+
+    -- Load a map, from a cache directory if any. Stale or missing cache
+    -- files are (re)generated from the source data
+    local function load_map (ptr, path, cache)
+        if cache == nil then
+            call(clib.turtle_map_load, ptr, path)
+            return
+        end
+
+        local attributes, errmsg = lfs.attributes(path)
+        if attributes == nil then
+            error.raise{fname = 'TopographyData', description = errmsg}
+        end
+        local size, mtime = attributes.size, attributes.modification
+
+        if lfs.attributes(cache, 'mode') == nil then lfs.mkdir(cache) end
+        local cached = cache..'/'..cache_name(path)
+        if clib.pumas_topography_map_load(ptr, cached, size, mtime) ~= 0 then
+            call(clib.turtle_map_load, ptr, path)
+
+            -- Caching is optional, e.g. the directory might be read only
+            clib.pumas_topography_map_dump(ptr[0], cached, size, mtime)
+        end
+        clib.pumas_error_clear()
+    end
+
+    local function new (cls, data, offset, cache)
         if data == nil then data = 0 end
+        if (cache ~= nil) and (type(cache) ~= 'string') then
+            error.raise{
+                fname = 'TopographyData', argnum = 3,
+                expected = 'a string or nil', got = metatype.a(cache)}
+        end
 
         local self = {}
         local c, ptr
@@ -194,7 +419,8 @@ do
                 }
             elseif mode == 'directory' then
                 ptr = ffi.new('struct turtle_stack *[1]')
-                call(clib.turtle_stack_create, ptr, data, 0, nil, nil)
+                call(clib.turtle_stack_create, ptr, data, 0,
+                    clib.pumas_topography_lock, clib.pumas_topography_unlock)
                 c = ptr[0]
                 ffi.gc(c, function () clib.turtle_stack_destroy(ptr) end)
                 call(clib.turtle_stack_load, c)
@@ -202,7 +428,7 @@ do
                 self._elevation = clib.turtle_stack_elevation
             else
                 ptr = ffi.new('struct turtle_map *[1]')
-                call(clib.turtle_map_load, ptr, data)
+                load_map(ptr, data, cache)
                 c = ptr[0]
                 ffi.gc(c, function () clib.turtle_map_destroy(ptr) end)
                 self._stepper_add = clib.turtle_stepper_add_map
@@ -291,12 +517,17 @@ do
         end
     end
 
-    local function elevation (self, x, y)
+    local function elevation (self, x, y, output, threads)
         if not self then
             error.raise{fname = 'elevation', argnum = 1,
                 expected = 'a TopographyDataset', got = metatype.a(self)}
         end
 
+        if batch.check(x, y) then
+            return batch.elevation('elevation', self._set, x, y, output,
+                threads)
+        end
+
         for _, v in ipairs(self._set) do
             local z = v:elevation(x, y)
             if z then return z end
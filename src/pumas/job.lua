@@ -0,0 +1,342 @@
+-------------------------------------------------------------------------------
+-- Sharding of a job over forked worker processes
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local jit = require('jit')
+local metatype = require('pumas.metatype')
+
+local job = {}
+
+
+-------------------------------------------------------------------------------
+-- Shard of the current process, exported as pumas.job
+-------------------------------------------------------------------------------
+job.info = {index = 1, count = 1}
+
+-- Private state: pipes and PIDs of the workers, seeds counter
+local state = {contexts = 0, reduced = false}
+
+
+-------------------------------------------------------------------------------
+-- POSIX process API
+-------------------------------------------------------------------------------
+if jit.os ~= 'Windows' then
+    ffi.cdef [[
+    int fork(void);
+    int pipe(int [2]);
+    int close(int);
+    long read(int, void *, unsigned long);
+    long write(int, const void *, unsigned long);
+    int waitpid(int, int *, int);
+    void _exit(int);
+    ]]
+end
+
+
+-------------------------------------------------------------------------------
+-- Seed for the next simulation context of the current shard
+-------------------------------------------------------------------------------
+function job.next_seed ()
+    local info = job.info
+    if info.seed == nil then return end
+
+    -- Seeds are interleaved over shards, such that contexts get distinct
+    -- seeds. The resulting streams are not guaranteed to be disjoint
+    local seed = info.seed + state.contexts * info.count + info.index - 1
+    state.contexts = state.contexts + 1
+    return seed % 2^32
+end
+
+
+-------------------------------------------------------------------------------
+-- Serialisation of the values returned by a shard
+-------------------------------------------------------------------------------
+do
+    local function encode_value (value, buffer, seen)
+        local tp = metatype(value)
+        if tp == 'nil' or tp == 'boolean' then
+            table.insert(buffer, tostring(value))
+        elseif tp == 'number' then
+            if value ~= value then
+                table.insert(buffer, '0/0')
+            elseif value == math.huge then
+                table.insert(buffer, '1/0')
+            elseif value == -math.huge then
+                table.insert(buffer, '-1/0')
+            else
+                table.insert(buffer, string.format('%.17g', value))
+            end
+        elseif tp == 'string' then
+            table.insert(buffer, string.format('%q', value))
+        elseif tp == 'Tally' then
+            table.insert(buffer, string.format('Tally(%q)', value:dump()))
+        elseif tp == 'table' then
+            if seen[value] then
+                error('cannot transfer a recursive table', 0)
+            end
+            seen[value] = true
+            table.insert(buffer, '{')
+            for k, v in pairs(value) do
+                table.insert(buffer, '[')
+                encode_value(k, buffer, seen)
+                table.insert(buffer, ']=')
+                encode_value(v, buffer, seen)
+                table.insert(buffer, ',')
+            end
+            table.insert(buffer, '}')
+            seen[value] = nil
+        else
+            error('cannot transfer '..metatype.a(value), 0)
+        end
+    end
+
+    function job.encode (...)
+        local buffer = {'return '..select('#', ...)}
+        for i = 1, select('#', ...) do
+            table.insert(buffer, ',')
+            encode_value(select(i, ...), buffer, {})
+        end
+        return table.concat(buffer)
+    end
+
+    local env = {
+        Tally = function (dump)
+            return require('pumas.tally').Tally(dump)
+        end
+    }
+
+    function job.decode (data)
+        local f, err = loadstring(data, '=job')
+        if f == nil then error(err, 0) end
+        setfenv(f, env)
+
+        local function pack (n, ...)
+            return {n = n, ...}
+        end
+
+        return pack(f())
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Merge the values returned by two shards
+-------------------------------------------------------------------------------
+function job.merge (a, b)
+    if b == nil then return a end
+    if a == nil then return b end
+
+    local ta, tb = metatype(a), metatype(b)
+    if ta ~= tb then
+        error(string.format('cannot merge %s and %s', metatype.a(a),
+            metatype.a(b)), 0)
+    end
+
+    if ta == 'number' then
+        return a + b
+    elseif ta == 'Tally' then
+        return a:merge(b)
+    elseif ta == 'table' then
+        for k, v in pairs(b) do
+            a[k] = job.merge(a[k], v)
+        end
+        return a
+    else
+        -- Other values (strings, booleans) are taken from the first shard
+        return a
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Send the values of a worker shard to the master one, or gather them
+-------------------------------------------------------------------------------
+do
+    local function write_all (fd, data)
+        local n, offset = #data, 0
+        while offset < n do
+            local m = ffi.C.write(fd, ffi.cast('const char *', data) + offset,
+                n - offset)
+            if m <= 0 then return false end
+            offset = offset + m
+        end
+        return true
+    end
+
+    local function read_all (fd)
+        local size = 65536
+        local buffer, chunks = ffi.new('char [?]', size), {}
+        while true do
+            local m = ffi.C.read(fd, buffer, size)
+            if m <= 0 then break end
+            table.insert(chunks, ffi.string(buffer, m))
+        end
+        return table.concat(chunks)
+    end
+
+    function job.reduce (...)
+        if (state.fd == nil) and (state.workers == nil) then
+            if state.reduced then
+                error('values have already been reduced', 2)
+            end
+            return ...
+        end
+        state.reduced = true
+
+        if state.fd ~= nil then
+            -- Worker shard: send the values and exit
+            local data = job.encode(...)
+            local status = write_all(state.fd, data) and 0 or 1
+            ffi.C.close(state.fd)
+            io.stdout:flush()
+            io.stderr:flush()
+            ffi.C._exit(status)
+        end
+
+        -- Master shard: gather and merge the values of all workers
+        local n = select('#', ...)
+        local values = {n = n, ...}
+        local failed = {}
+        for i, worker in ipairs(state.workers) do
+            local data = read_all(worker.fd)
+            ffi.C.close(worker.fd)
+            local status = ffi.new('int [1]')
+            ffi.C.waitpid(worker.pid, status, 0)
+            if status[0] ~= 0 then
+                table.insert(failed, i + 1)
+            else
+                local shard = job.decode(data)
+                if shard.n > values.n then values.n = shard.n end
+                for j = 1, shard.n do
+                    values[j] = job.merge(values[j], shard[j])
+                end
+            end
+        end
+        state.workers = nil
+
+        if #failed > 0 then
+            error(string.format('shard(s) %s failed',
+                table.concat(failed, ', ')), 2)
+        end
+
+        return unpack(values, 1, values.n)
+    end
+
+    job.info.reduce = job.reduce
+end
+
+
+-------------------------------------------------------------------------------
+-- Run a script sharded over count processes
+-------------------------------------------------------------------------------
+do
+    local function draw_seed ()
+        local file = io.open('/dev/urandom', 'rb')
+        if file ~= nil then
+            local bytes = file:read(4)
+            file:close()
+            if bytes and #bytes == 4 then
+                local b1, b2, b3, b4 = bytes:byte(1, 4)
+                return ((b1 * 256 + b2) * 256 + b3) * 256 + b4
+            end
+        end
+        return (os.time() + math.floor(os.clock() * 1E+06)) % 2^32
+    end
+
+    -- Bind the current shard to a NUMA node, using contiguous blocks of shards
+    local function bind (nodes)
+        local info = job.info
+        local node = math.floor((info.index - 1) * nodes / info.count)
+        local clib = require('pumas.clib')
+        if clib.pumas_numa_bind(node) ~= 0 then
+            error(string.format('could not bind shard %d to NUMA node %d',
+                info.index, node), 0)
+        end
+        info.node = node
+    end
+
+    function job.run (count, script, numa)
+        if jit.os == 'Windows' then
+            error('job sharding is not supported on Windows', 2)
+        end
+
+        local nodes
+        if numa then
+            nodes = require('pumas.clib').pumas_numa_length()
+            if nodes <= 0 then
+                error('NUMA nodes are not available', 2)
+            end
+        end
+
+        local info = job.info
+        info.index, info.count, info.seed = 1, count, draw_seed()
+        info.node, info.results = nil, nil
+        state.contexts, state.reduced = 0, false
+
+        io.stdout:flush()
+        io.stderr:flush()
+
+        local workers = {}
+        for index = 2, count do
+            local fd = ffi.new('int [2]')
+            if ffi.C.pipe(fd) ~= 0 then
+                error('could not create pipe', 2)
+            end
+
+            local pid = ffi.C.fork()
+            if pid < 0 then
+                error('could not fork process', 2)
+            elseif pid == 0 then
+                -- Worker shard: run the script and send back its results
+                ffi.C.close(fd[0])
+                for _, worker in ipairs(workers) do
+                    ffi.C.close(worker.fd)
+                end
+                info.index = index
+                state.fd = fd[1]
+
+                local _, err = xpcall(function ()
+                    if nodes then bind(nodes) end
+                    job.reduce(dofile(script))
+                end, debug.traceback)
+
+                io.stderr:write(string.format('shard %d: %s\n', index,
+                    tostring(err)))
+                io.stdout:flush()
+                io.stderr:flush()
+                ffi.C._exit(1)
+            end
+
+            ffi.C.close(fd[1])
+            table.insert(workers, {pid = pid, fd = fd[0]})
+        end
+        state.workers = workers
+
+        -- Master shard: run the script and gather the results
+        local function pack (...)
+            return {n = select('#', ...), ...}
+        end
+
+        if nodes then bind(nodes) end
+        local results = pack(dofile(script))
+        if not state.reduced then
+            info.results = pack(job.reduce(unpack(results, 1, results.n)))
+        end
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function job.register_to (t)
+    t.job = job.info
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return job
@@ -3,6 +3,7 @@
 -- Author: Valentin Niess
 -- License: GNU LGPL-3.0
 -------------------------------------------------------------------------------
+local compat = require('pumas.compat')
 local element_ = require('pumas.element')
 local error = require('pumas.error')
 local metatype = require('pumas.metatype')
@@ -272,11 +273,47 @@ end
 
 
 -------------------------------------------------------------------------------
--- Build the Materials table
+-- Build the Materials table. Entries are decoded on first access
 -------------------------------------------------------------------------------
-material.materials = require('pumas.data.materials')
-for k, v in pairs(material.materials) do
-    material.materials[k] = setmetatable(v, material.Material)
+do
+    local records = require('pumas.data.materials')
+
+    local FIELDS = {'ZoA', 'I', 'density', 'state', 'x0', 'x1', 'a', 'k',
+        'Cbar', 'delta0'}
+    local n_fields = #FIELDS
+
+    local function get (t, k)
+        local record = records[k]
+        if record == nil then return nil end
+
+        local v = compat.table_new(0, n_fields + 1)
+        local elements, i, symbol = {}, 0
+        for token in record:gmatch('%S+') do
+            i = i + 1
+            if i <= n_fields then
+                local field = FIELDS[i]
+                v[field] = (field == 'state') and token or tonumber(token)
+            elseif symbol == nil then
+                symbol = token
+            else
+                elements[symbol] = tonumber(token)
+                symbol = nil
+            end
+        end
+        v.elements = elements
+        v = setmetatable(v, material.Material)
+        rawset(t, k, v)
+        return v
+    end
+
+    material.materials = setmetatable({}, {
+        __index = get,
+        __pairs = function (t)
+            for k, _ in pairs(records) do
+                if rawget(t, k) == nil then get(t, k) end
+            end
+            return next, t, nil
+        end})
 end
 
 
@@ -58,7 +58,12 @@ function CompositeMaterials:__newindex (k, v)
 
     rawset(self._fractions, k, v)
     rawset(self, '_needs_update', true)
-    rawset(self._physics, '_update_composites', true)
+
+    -- Only the modified composite is tagged for an update
+    local material = rawget(self, '_material')
+    if material then
+        self._physics._update_composites[material] = true
+    end
 end
 
 
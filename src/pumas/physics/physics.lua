@@ -143,11 +143,12 @@ end
 -- Inner routine for updating composite data if the composition has changed
 -------------------------------------------------------------------------------
 local function update_composites (self)
-    if self._update_composites then
-        for _, v in pairs(self._composites) do
-            v:_update()
+    local modified = self._update_composites
+    if next(modified) ~= nil then
+        rawset(self, '_update_composites', {})
+        for material, _ in pairs(modified) do
+            material:_update()
         end
-        self._update_composites = false
     end
 end
 
@@ -292,7 +293,7 @@ do
         end
 
         local self = setmetatable({_c = c, _version = physics_version,
-            _update_composites = false}, cls)
+            _update_composites = {}}, cls)
         physics_version = physics_version + 1
 
         return self
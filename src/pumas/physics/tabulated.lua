@@ -73,27 +73,56 @@ do
         end
     end
 
+    -- Native copies of the tables, filled in a single C call per table
+    local tabulated_properties = {cross_section = true, energy_loss = true,
+        grammage = true, kinetic_energy = true, proper_time = true}
+
+    local function fill_view (self, view)
+        local c_property = clib['PUMAS_PROPERTY_'..view.property:upper()]
+        call(clib.pumas_physics_table_array, self._physics._c[0], c_property,
+            toindex(view.mode), self._index, view.data)
+    end
+
+    local function get_view (self, property, mode, fname)
+        mode = mode or 'csda'
+        toindex(mode, fname)
+        if mode == 'detailed' then
+            mode = 'hybrid'
+        end
+        if property == 'kinetic_energy' then
+            mode = 'csda'
+        elseif (property == 'cross_section') and (mode == 'csda') then
+            error.raise{fname = fname, argnum = 3,
+                description = "no cross_section table for mode 'csda'"}
+        end
+
+        local key = property..'.'..mode
+        local view = self._views[key]
+        if view == nil then
+            local n = tonumber(
+                clib.pumas_physics_table_length(self._physics._c[0]))
+            view = {property = property, mode = mode, n = n,
+                data = ffi.new('double [?]', n)}
+            fill_view(self, view)
+            self._views[key] = view
+        end
+        return view
+    end
+
     local function get_or_update_table (self, property, mode, ref)
-        local n, is_update, t
+        local view = get_view(self, property, mode)
+        local n, t = view.n
         if ref then
-            is_update = true
             t = readonly.rawget(ref)
-            n = #t
         else
-            is_update = false
-            n = tonumber(clib.pumas_physics_table_length(self.physics._c[0]))
             t = compat.table_new(n, 0)
         end
 
-        local c_property = clib['PUMAS_PROPERTY_'..property:upper()]
-        mode = toindex(mode)
         for i = 0, n - 1 do
-            clib.pumas_physics_table_value(self.physics._c[0], c_property, mode,
-                self._index, i, value)
-            t[i + 1] = tonumber(value[0])
+            t[i + 1] = tonumber(view.data[i])
         end
 
-        if is_update then
+        if ref then
             return ref
         else
             return readonly.Readonly(t, property, 'PhysicsTable')
@@ -175,63 +204,161 @@ do
             self._properties.ZoA = ZoA
             self._properties.I = I
 
-            local tables = rawget(self, 'table')
-            if tables then
-                get_or_update_all_tables(self, tables)
+            -- Views are refreshed in place, thus pointers remain valid. Lua
+            -- tables are refreshed lazily, when next accessed
+            for _, view in pairs(self._views) do
+                fill_view(self, view)
             end
+            rawset(self, '_stale_tables', true)
 
             self._properties.materials._needs_update = false
         end
     end
 
+    -- Length of a double array, or nil for other cdata, e.g. pointers
+    local function array_length (x)
+        if tostring(ffi.typeof(x)):match('^ctype<double %[[%d?]+%]>$') then
+            return ffi.sizeof(x) / ffi.sizeof('double')
+        end
+    end
+
+    -- Vectorised evaluation of a material property, in a single C call
+    local function evaluate (self, fname, property, mode, input, output)
+        local n, c_input
+        local tp = type(input)
+        if tp == 'table' then
+            n = #input
+            c_input = ffi.new('double [?]', n)
+            for i = 1, n do c_input[i - 1] = input[i] end
+        elseif (tp == 'cdata') and array_length(input) then
+            n = array_length(input)
+            c_input = ffi.cast('const double *', input)
+        else
+            error.raise{fname = fname, argnum = 2,
+                expected = 'a number, a table or a double [?] cdata',
+                got = metatype.a(input)}
+        end
+
+        local argnum = (mode == false) and 3 or 4
+        local c_output
+        if output == nil then
+            if tp == 'table' then
+                output = compat.table_new(n, 0)
+                c_output = ffi.new('double [?]', n)
+            else
+                output = ffi.new('double [?]', n)
+                c_output = output
+            end
+        elseif type(output) == 'table' then
+            c_output = ffi.new('double [?]', n)
+        elseif (type(output) == 'cdata') and
+            ((array_length(output) or -1) >= n) then
+            c_output = ffi.cast('double *', output)
+        else
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a table or a double ['..n..'] cdata',
+                got = metatype.a(output)}
+        end
+
+        local c_mode = (mode == false) and clib.PUMAS_MODE_CSDA or
+            toindex(mode, fname)
+        call(clib.pumas_physics_property_array, self._physics._c[0],
+            clib['PUMAS_PROPERTY_'..property:upper()], c_mode, self._index,
+            n, c_input, c_output)
+
+        if type(output) == 'table' then
+            for i = 1, n do output[i] = tonumber(c_output[i - 1]) end
+        end
+        return output
+    end
+
     local index = {
-        cross_section = function (self, energy)
+        cross_section = function (self, energy, output)
             update(self, 'cross_section')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'cross_section', 'cross_section', false,
+                    energy, output)
+            end
             call(clib.pumas_physics_property_cross_section, self._physics._c[0],
                 self._index, energy, value)
             return tonumber(value[0])
         end,
 
-        energy_loss = function (self, energy, mode)
+        energy_loss = function (self, energy, mode, output)
             update(self, 'energy_loss')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'energy_loss', 'energy_loss', mode,
+                    energy, output)
+            end
             call(clib.pumas_physics_property_energy_loss, self.physics._c[0],
                 toindex(mode, 'energy_loss'), self._index, energy, value)
             return tonumber(value[0])
         end,
 
-        grammage = function (self, energy, mode)
+        grammage = function (self, energy, mode, output)
             update(self, 'grammage')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'grammage', 'grammage', mode, energy,
+                    output)
+            end
             call(clib.pumas_physics_property_grammage, self.physics._c[0],
                 toindex(mode, 'grammage'), self._index, energy, value)
             return tonumber(value[0])
         end,
 
-        kinetic_energy = function (self, grammage, mode)
+        kinetic_energy = function (self, grammage, mode, output)
             update(self, 'kinetic_energy')
+            if type(grammage) ~= 'number' then
+                return evaluate(self, 'kinetic_energy', 'kinetic_energy', mode,
+                    grammage, output)
+            end
             call(clib.pumas_physics_property_kinetic_energy, self.physics._c[0],
                 toindex(mode, 'kinetic_energy'), self._index, grammage, value)
             return tonumber(value[0])
         end,
 
-        magnetic_rotation = function (self, energy)
+        magnetic_rotation = function (self, energy, output)
             update(self, 'magnetic_rotation')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'magnetic_rotation', 'magnetic_rotation',
+                    false, energy, output)
+            end
             call(clib.pumas_physics_property_magnetic_rotation,
                 self.physics._c[0], self._index, energy, value)
             return tonumber(value[0])
         end,
 
-        proper_time = function (self, energy, mode)
+        proper_time = function (self, energy, mode, output)
             update(self, 'proper_time')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'proper_time', 'proper_time', mode,
+                    energy, output)
+            end
             call(clib.pumas_physics_property_proper_time, self.physics._c[0],
                 toindex(mode, 'proper_time'), self._index, energy, value)
             return tonumber(value[0])
         end,
 
-        scattering_length = function (self, energy)
+        scattering_length = function (self, energy, output)
             update(self, 'scattering_length')
+            if type(energy) ~= 'number' then
+                return evaluate(self, 'scattering_length', 'scattering_length',
+                    false, energy, output)
+            end
             call(clib.pumas_physics_property_scattering_length,
                 self.physics._c[0], self._index, energy, value)
             return tonumber(value[0])
+        end,
+
+        view = function (self, property, mode)
+            update(self, 'view')
+            if not tabulated_properties[property] then
+                error.raise{fname = 'view', argnum = 2,
+                    expected = 'a tabulated property name',
+                    got = metatype.a(property)}
+            end
+            local v = get_view(self, property, mode, 'view')
+            return ffi.cast('const double *', v.data), v.n
         end
     }
 
@@ -243,8 +370,15 @@ do
         elseif k == 'physics' then
             return self._physics
         elseif k == 'table' then
-            local t = get_or_update_all_tables(self)
-            rawset(self, 'table', t)
+            update(self)
+            local t = rawget(self, '_tables')
+            if t == nil then
+                t = get_or_update_all_tables(self)
+                rawset(self, '_tables', t)
+            elseif rawget(self, '_stale_tables') then
+                get_or_update_all_tables(self, t)
+            end
+            rawset(self, '_stale_tables', false)
             return t
         elseif k == '_update' then
             return update
@@ -271,8 +405,12 @@ do
 end
 
 
-function TabulatedMaterial.__newindex (_, k, _)
-    error.raise{['type'] = 'TabulatedMaterial', not_mutable = k}
+function TabulatedMaterial.__newindex (self, k, v)
+    if (k == 'table') and (v == nil) then
+        rawset(self, '_tables', nil) -- It is allowed to unload the tables
+    else
+        error.raise{['type'] = 'TabulatedMaterial', not_mutable = k}
+    end
 end
 
 
@@ -363,7 +501,10 @@ do
         end
 
         local self = {_physics = physics_, _index = index, _name = name,
-            _properties = properties}
+            _properties = properties, _views = {}}
+        if properties.composite then
+            rawset(properties.materials, '_material', self)
+        end
         return setmetatable(self, cls)
     end
 
@@ -0,0 +1,298 @@
+-------------------------------------------------------------------------------
+-- Native plugins for PUMAS, providing user defined geometries and media
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local error = require('pumas.error')
+local base = require('pumas.geometry.base')
+local medium_base = require('pumas.medium.base')
+local metatype = require('pumas.metatype')
+local uniform = require('pumas.medium.uniform')
+
+local plugin = {}
+
+
+-------------------------------------------------------------------------------
+-- The plugin geometry metatype
+-------------------------------------------------------------------------------
+local PluginGeometry = {}
+
+
+local function new_geometry (self)
+    local c = self._create(self._options, self._media_c, #self._media)
+    if c == nil then
+        error.raise{fname = 'PluginGeometry.new',
+            description = "could not create geometry '"..self._name.."'"}
+    end
+    return c
+end
+
+
+function PluginGeometry:__index (k)
+    if k == 'media' then
+        local media = {}
+        for i, m in ipairs(self._media) do media[i] = m end
+        return media
+    elseif k == 'name' then
+        return self._name
+    elseif k == 'plugin' then
+        return self._plugin
+    elseif k == '_new' then
+        return new_geometry
+    else
+        return base.BaseGeometry.__index[k]
+    end
+end
+
+
+function PluginGeometry.__newindex (_, k)
+    if (k == 'media') or (k == 'name') or (k == 'plugin') then
+        error.raise{['type'] = 'PluginGeometry', not_mutable = k}
+    else
+        error.raise{['type'] = 'PluginGeometry', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- The plugin medium metatype
+-------------------------------------------------------------------------------
+local PluginMedium = {}
+local strtype = 'PluginMedium'
+
+
+function PluginMedium:__index (k)
+    if k == 'name' then
+        return rawget(self, '_name')
+    elseif k == 'plugin' then
+        return rawget(self, '_plugin')
+    else
+        return medium_base.BaseMedium.__index(self, k, strtype)
+    end
+end
+
+
+function PluginMedium:__newindex (k, v)
+    if (k == 'name') or (k == 'plugin') then
+        error.raise{['type'] = strtype, not_mutable = k}
+    else
+        medium_base.BaseMedium.__newindex(self, k, v, strtype)
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- The plugin metatype
+-------------------------------------------------------------------------------
+local GeometryPlugin = {}
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'GeometryPlugin' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a GeometryPlugin table', got = metatype.a(self)}
+        end
+    end
+
+    local function check_options (options, fname, argnum)
+        if (options ~= nil) and (type(options) ~= 'string') then
+            error.raise{fname = fname, argnum = argnum,
+                expected = 'a string or nil', got = metatype.a(options)}
+        end
+    end
+
+    local function geometry (self, name, media, options)
+        check_self(self, 'geometry')
+
+        local entry = self._geometries[name]
+        if entry == nil then
+            error.raise{fname = 'geometry', argnum = 2,
+                description = "no such geometry '"..tostring(name).."'"}
+        end
+
+        if metatype(media) ~= 'table' then
+            media = {media}
+        end
+        local n = #media
+        local media_ = {}
+        local media_c = ffi.new('struct pumas_medium *[?]', math.max(n, 1))
+        for i = 1, n do
+            local m = media[i]
+            local mt = metatype(m)
+            if mt == 'string' then
+                m = uniform.UniformMedium(m)
+            elseif mt ~= 'Medium' then
+                error.raise{fname = 'geometry', argnum = 3,
+                    expected = 'a Medium table or a string for entry #'..i,
+                    got = metatype.a(m)}
+            end
+            media_[i] = m
+            media_c[i - 1] = ffi.cast('struct pumas_medium *', m._c)
+        end
+        check_options(options, 'geometry', 4)
+
+        local obj = base.BaseGeometry:new()
+        obj._create = entry.create
+        obj._media = media_
+        obj._media_c = media_c
+        obj._name = name
+        obj._options = options
+        obj._plugin = self
+        return setmetatable(obj, PluginGeometry)
+    end
+
+    local function medium_ (self, name, material, options)
+        check_self(self, 'medium')
+
+        local entry = self._media[name]
+        if entry == nil then
+            error.raise{fname = 'medium', argnum = 2,
+                description = "no such medium '"..tostring(name).."'"}
+        end
+        if type(material) ~= 'string' then
+            error.raise{fname = 'medium', argnum = 3, expected = 'a string',
+                got = metatype.a(material)}
+        end
+        check_options(options, 'medium', 4)
+
+        local size = tonumber(entry.size)
+        if size < ffi.sizeof('struct pumas_medium') then
+            error.raise{fname = 'medium',
+                description = "bad size for medium '"..name.."'"}
+        end
+        local c = ffi.cast('struct pumas_medium *', ffi.C.calloc(1, size))
+        if c == nil then
+            error.raise{fname = 'medium',
+                description = 'could not allocate memory'}
+        end
+        ffi.gc(c, ffi.C.free)
+        c.material = -1
+
+        if entry.initialise ~= nil then
+            if entry.initialise(c, options) ~= 0 then
+                error.raise{fname = 'medium',
+                    description = "could not initialise medium '"..name.."'"}
+            end
+        end
+
+        local obj = {_c = c, material = material, _name = name,
+            _plugin = self}
+        medium_base.add(obj)
+        return setmetatable(obj, PluginMedium)
+    end
+
+    error.register('GeometryPlugin.__index.geometry', geometry)
+    error.register('GeometryPlugin.__index.medium', medium_)
+
+    local function names (t)
+        local list = {}
+        for k, _ in pairs(t) do table.insert(list, k) end
+        table.sort(list)
+        return list
+    end
+
+    function GeometryPlugin:__index (k)
+        if k == '__metatype' then
+            return 'GeometryPlugin'
+        elseif k == 'geometry' then
+            return geometry
+        elseif k == 'medium' then
+            return medium_
+        elseif k == 'geometries' then
+            return names(self._geometries)
+        elseif k == 'media' then
+            return names(self._media)
+        elseif k == 'name' then
+            return self._name
+        elseif k == 'path' then
+            return self._path
+        else
+            error.raise{['type'] = 'GeometryPlugin', bad_member = k}
+        end
+    end
+end
+
+
+function GeometryPlugin.__newindex (_, k)
+    if (k == 'geometries') or (k == 'media') or (k == 'name') or
+       (k == 'path') then
+        error.raise{['type'] = 'GeometryPlugin', not_mutable = k}
+    else
+        error.raise{['type'] = 'GeometryPlugin', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Plugin loader
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'load_geometry_plugin'}
+
+    -- Loaded plugins are cached, since shared libraries are not unloaded
+    local loaded = {}
+
+    function plugin.load_geometry_plugin (path)
+        if type(path) ~= 'string' then
+            raise_error{argnum = 1, expected = 'a string',
+                got = metatype.a(path)}
+        end
+
+        local self = loaded[path]
+        if self ~= nil then return self end
+
+        local ok, lib = pcall(ffi.load, path)
+        if not ok then
+            raise_error{argnum = 1, description = lib}
+        end
+
+        local c
+        ok, c = pcall(function () return lib.pumas_plugin_initialise() end)
+        if not ok then
+            raise_error{argnum = 1, description = 'missing entry point'}
+        elseif c == nil then
+            raise_error{argnum = 1, description = 'initialisation failed'}
+        elseif c.version ~= ffi.C.PUMAS_PLUGIN_VERSION then
+            raise_error{argnum = 1, description = string.format(
+                'incompatible version (expected %d, got %d)',
+                tonumber(ffi.C.PUMAS_PLUGIN_VERSION), tonumber(c.version))}
+        end
+
+        local geometries, media = {}, {}
+        for i = 0, c.n_geometries - 1 do
+            local entry = c.geometries[i]
+            geometries[ffi.string(entry.name)] = entry
+        end
+        for i = 0, c.n_media - 1 do
+            local entry = c.media[i]
+            media[ffi.string(entry.name)] = entry
+        end
+
+        self = setmetatable({
+            _c = c,
+            _geometries = geometries,
+            _lib = lib,
+            _media = media,
+            _name = (c.name ~= nil) and ffi.string(c.name) or path,
+            _path = path
+        }, GeometryPlugin)
+        loaded[path] = self
+
+        return self
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function plugin.register_to (t)
+    t.load_geometry_plugin = plugin.load_geometry_plugin
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return plugin
@@ -0,0 +1,308 @@
+-------------------------------------------------------------------------------
+-- Sampling profiler combining Lua and native C stacks
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local jit = require('jit')
+local jit_util = require('jit.util')
+local clib = require('pumas.clib')
+local error = require('pumas.error')
+local metatype = require('pumas.metatype')
+
+local profile = {}
+
+
+-------------------------------------------------------------------------------
+-- Tags for the LuaJIT VM states, appended as leaf frames
+-------------------------------------------------------------------------------
+local VMSTATES = {C = '[C]', G = '[GC]', J = '[JIT]'}
+
+
+-------------------------------------------------------------------------------
+-- FFI callbacks to Lua, e.g. recorders or geometry callbacks
+--
+-- Note that the LuaJIT callback symbols are hidden, such that callbacks are
+-- not visible in native stacks. Instead, the Lua functions wrapped as FFI
+-- callbacks are registered, and searched for in sampled Lua stacks
+-------------------------------------------------------------------------------
+local callbacks = setmetatable({}, {__mode = 'k'})
+
+function profile.callback (func)
+    callbacks[func] = true
+    return func
+end
+
+
+-------------------------------------------------------------------------------
+-- Helpers for collecting samples
+-------------------------------------------------------------------------------
+local function count (t, k, n)
+    t[k] = (t[k] or 0) + (n or 1)
+end
+
+
+-- Check if a Lua stack is within an FFI callback
+local function in_callback (thread, depth)
+    for level = 0, depth - 1 do
+        local info = debug.getinfo(thread, level, 'f')
+        if info == nil then break end
+        if callbacks[info.func] then return true end
+    end
+    return false
+end
+
+
+-- Source prefix of PUMAS modules, used for attributing trace aborts
+local PUMAS_SOURCE = debug.getinfo(1, 'S').source:match('^(.-)profile%.lua$')
+
+
+-- Format a trace abort, as the jit.v module does
+local function trace_error (err, info)
+    if type(err) == 'number' then
+        local ok, vmdef = pcall(require, 'jit.vmdef')
+        if ok then
+            if type(info) == 'function' then
+                info = jit_util.funcinfo(info).loc or '?'
+            end
+            return string.format(vmdef.traceerr[err], info)
+        else
+            return 'trace error #'..err
+        end
+    end
+    return tostring(err)
+end
+
+
+-- Native stacks, from the root frame. The innermost exported function of
+-- PUMAS, TURTLE or GULL is taken as the C subsystem
+local function native_stacks (stacks, report, depth)
+    local n = clib.pumas_profile_stop()
+    local symbols = ffi.new('const char * [?]', depth)
+    for i = 0, n - 1 do
+        local m = clib.pumas_profile_stack(i, symbols, depth)
+        local frames, subsystem = {}, nil
+        for j = 0, m - 1 do
+            local symbol = (symbols[j] == nil) and '?' or
+                ffi.string(symbols[j])
+            if (subsystem == nil) and (symbol:match('^pumas_') or
+                symbol:match('^turtle_') or symbol:match('^gull_')) then
+                subsystem = symbol
+            end
+            frames[m - j] = symbol
+        end
+        if m > 0 then
+            count(stacks, 'native;'..table.concat(frames, ';'))
+            count(report.subsystems, subsystem or '?')
+        end
+    end
+    report.samples.native = n
+end
+
+
+-------------------------------------------------------------------------------
+-- Profile a function
+-------------------------------------------------------------------------------
+do
+    local function write_stacks (path, stacks)
+        local keys = {}
+        for k, _ in pairs(stacks) do table.insert(keys, k) end
+        table.sort(keys)
+
+        local file = io.open(path, 'w')
+        if file == nil then
+            error.raise{
+                fname = 'profile',
+                argnum = 2,
+                description = "could not open file '"..path.."'"
+            }
+        end
+        for _, k in ipairs(keys) do
+            file:write(k, ' ', stacks[k], '\n')
+        end
+        file:close()
+    end
+
+    local function profile_ (func, options)
+        if type(func) ~= 'function' then
+            error.raise{
+                fname = 'profile',
+                argnum = 1,
+                expected = 'a function',
+                got = metatype.a(func)
+            }
+        end
+
+        if options == nil then
+            options = {}
+        elseif type(options) ~= 'table' then
+            error.raise{
+                fname = 'profile',
+                argnum = 2,
+                expected = 'a table or nil',
+                got = metatype.a(options)
+            }
+        end
+
+        local ok, jit_profile = pcall(require, 'jit.profile')
+        if not ok then
+            error.raise{
+                fname = 'profile',
+                description = 'the LuaJIT profiler is not available'
+            }
+        end
+
+        local output = options.output or 'pumas.folded'
+        local interval = options.interval or 1
+        local depth = options.depth or 32
+        local native = options.native
+        if native == nil then native = (jit.os ~= 'Windows') end
+
+        local report = {
+            output = output,
+            samples = {lua = 0, native = 0},
+            vmstates = {},
+            subsystems = {},
+            callbacks = 0,
+            aborts = {}
+        }
+        local stacks = {}
+
+        -- Sample the Lua stacks
+        jit_profile.start('i'..interval, function (thread, samples, vmstate)
+            local stack = jit_profile.dumpstack(thread, 'FZ;', -depth)
+            stack = 'lua;'..stack:gsub(' ', '_')
+            local tag = VMSTATES[vmstate]
+            if tag then stack = stack..';'..tag end
+            count(stacks, stack, samples)
+            count(report.vmstates, vmstate, samples)
+            report.samples.lua = report.samples.lua + samples
+            if in_callback(thread, depth) then
+                report.callbacks = report.callbacks + samples
+            end
+        end)
+
+        -- Sample the C stacks
+        if native and
+            (clib.pumas_profile_start(options.samples or 100000,
+                                      1E-03 * interval) ~= 0) then
+            native = false
+        end
+
+        -- Record the trace aborts. Existing traces are flushed, such that
+        -- the profiled code is recorded again
+        local aborts = {}
+        local sources = {}
+        local function on_trace (what, _, func, pc, otr, oex)
+            if what == 'abort' then
+                local info = jit_util.funcinfo(func, pc)
+                local location = info.loc or '?'
+                count(aborts, location..': '..trace_error(otr, oex))
+                sources[location] = info.source
+            end
+        end
+        jit.flush()
+        jit.attach(on_trace, 'trace')
+
+        local function pack (...)
+            return {n = select('#', ...), ...}
+        end
+        local results = pack(pcall(func))
+
+        jit.attach(on_trace)
+        jit_profile.stop()
+        if native then
+            native_stacks(stacks, report, depth)
+        end
+
+        if not results[1] then _G.error(results[2], 0) end
+
+        -- Sort the trace aborts by decreasing count
+        for k, v in pairs(aborts) do
+            local location, reason = k:match('^(.-): (.*)$')
+            local source = sources[location]
+            local pumas = (PUMAS_SOURCE ~= nil) and (source ~= nil) and
+                (source:sub(1, #PUMAS_SOURCE) == PUMAS_SOURCE)
+            table.insert(report.aborts, {location = location, reason = reason,
+                count = v, pumas = pumas})
+        end
+        table.sort(report.aborts, function (a, b)
+            if a.count == b.count then return a.location < b.location end
+            return a.count > b.count
+        end)
+
+        write_stacks(output, stacks)
+
+        return report, unpack(results, 2, results.n)
+    end
+
+    profile.profile = profile_
+end
+
+
+-------------------------------------------------------------------------------
+-- Summary of a profiling report
+-------------------------------------------------------------------------------
+function profile.summary (report)
+    local lines = {}
+    local function add (...)
+        table.insert(lines, string.format(...))
+    end
+
+    add('profile: %d Lua samples, %d native samples, written to %s',
+        report.samples.lua, report.samples.native, report.output)
+
+    local total = report.samples.lua
+    if total > 0 then
+        local names = {N = 'compiled', I = 'interpreted', C = 'C code',
+            G = 'garbage collector', J = 'JIT compiler'}
+        for _, state in ipairs{'N', 'I', 'C', 'G', 'J'} do
+            local n = report.vmstates[state]
+            if n then
+                add('  %-20s %5.1f %%', names[state], 100 * n / total)
+            end
+        end
+        add('  %-20s %5.1f %%', 'FFI callbacks',
+            100 * report.callbacks / total)
+    end
+
+    total = report.samples.native
+    if total > 0 then
+        local subsystems = {}
+        for k, v in pairs(report.subsystems) do
+            table.insert(subsystems, {k, v})
+        end
+        table.sort(subsystems, function (a, b) return a[2] > b[2] end)
+        add('native subsystems:')
+        for i = 1, math.min(#subsystems, 10) do
+            local s = subsystems[i]
+            add('  %-40s %5.1f %%', s[1], 100 * s[2] / total)
+        end
+    end
+
+    if #report.aborts > 0 then
+        add('trace aborts:')
+        for i = 1, math.min(#report.aborts, 10) do
+            local a = report.aborts[i]
+            add('  %5d %s %s: %s', a.count, a.pumas and '*' or ' ',
+                a.location, a.reason)
+        end
+        add('  (* within PUMAS modules)')
+    end
+
+    return table.concat(lines, '\n')
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function profile.register_to (t)
+    t.profile = profile.profile
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return profile
@@ -10,6 +10,7 @@ local enum = require('pumas.enum')
 local error = require('pumas.error')
 local medium = require('pumas.medium')
 local metatype = require('pumas.metatype')
+local profile = require('pumas.profile')
 local state = require('pumas.state')
 
 local recorder = {}
@@ -55,12 +56,12 @@ do
                 local wrapped_state = state.State()
                 local wrapped_event = enum.Event()
                 self._c.record = ffi.cast('pumas_recorder_cb *',
-                    function (_, c_state, c_medium, c_event)
+                    profile.callback(function (_, c_state, c_medium, c_event)
                         local wrapped_medium = medium.get(c_medium)
                         ffi.copy(wrapped_state._c, c_state, state_size)
                         wrapped_event._value = c_event
                         v(wrapped_state, wrapped_medium, wrapped_event)
-                    end)
+                    end))
             else
                 self._c.record = nil
             end
@@ -0,0 +1,337 @@
+-------------------------------------------------------------------------------
+-- Native tallies for PUMAS
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local clib = require('pumas.clib')
+local error = require('pumas.error')
+local metatype = require('pumas.metatype')
+
+local tally = {}
+
+
+-------------------------------------------------------------------------------
+-- Tallied fields of Monte Carlo states
+-------------------------------------------------------------------------------
+local FIELDS = {}
+local FIELD_NAMES = {}
+for _, k in ipairs{'charge', 'energy', 'distance', 'grammage', 'time',
+    'weight', 'position_x', 'position_y', 'position_z', 'direction_x',
+    'direction_y', 'direction_z'} do
+    local v = tonumber(ffi.C['PUMAS_TALLY_'..k:upper()])
+    FIELDS[k] = v
+    FIELD_NAMES[v] = k
+end
+
+
+-------------------------------------------------------------------------------
+-- The tally metatype
+-------------------------------------------------------------------------------
+local Tally = {}
+
+local ctype = ffi.typeof('struct pumas_tally')
+local ctype_ptr = ffi.typeof('struct pumas_tally *')
+
+
+local function size_of (c)
+    local n = c.n[0] * ((c.field[1] >= 0) and c.n[1] or 1)
+    return ffi.sizeof(ctype) + 2 * n * ffi.sizeof('double')
+end
+
+
+local function allocate (size, fname)
+    local c = ffi.cast(ctype_ptr, ffi.C.calloc(1, size))
+    if c == nil then
+        error.raise{fname = fname, description = 'could not allocate memory'}
+    end
+    ffi.gc(c, ffi.C.free)
+    return c
+end
+
+
+local function axis_table (c, i)
+    if (i == 1) and (c.field[1] < 0) then return nil end
+
+    local axis = {field = FIELD_NAMES[c.field[i]]}
+    if c.n[i] > 0 then
+        axis.bins = c.n[i]
+        axis.range = {c.min[i], c.max[i]}
+        axis.log = (c.log[i] ~= 0)
+    end
+    return axis
+end
+
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'Tally' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'a Tally table', got = metatype.a(self)}
+        end
+    end
+
+    local function clear (self)
+        check_self(self, 'clear')
+
+        local c = self._c
+        local offset = ffi.offsetof(ctype, 'entries')
+        ffi.fill(ffi.cast('char *', c) + offset, size_of(c) - offset)
+        return self
+    end
+
+    local function clone (self)
+        check_self(self, 'clone')
+        return tally.Tally(self)
+    end
+
+    local function dump (self)
+        check_self(self, 'dump')
+        return ffi.string(self._c, size_of(self._c))
+    end
+
+    local function histogram (self)
+        check_self(self, 'histogram')
+
+        local c = self._c
+        if c.n[0] <= 0 then return nil end
+
+        local nx, ny = c.n[0], (c.field[1] >= 0) and c.n[1] or nil
+        local n = nx * (ny or 1)
+        local values, sigmas
+        if ny then
+            values = ffi.new('double [?]['..ny..']', nx)
+            sigmas = ffi.new('double [?]['..ny..']', nx)
+        else
+            values = ffi.new('double [?]', nx)
+            sigmas = ffi.new('double [?]', nx)
+        end
+        local v = ffi.cast('double *', values)
+        local s = ffi.cast('double *', sigmas)
+        for i = 0, n - 1 do
+            v[i] = c.data[2 * i]
+            s[i] = math.sqrt(c.data[2 * i + 1])
+        end
+
+        local function edges (axis)
+            local t = {}
+            for i = 0, c.n[axis] do
+                local x = c.offset[axis] + i / c.scale[axis]
+                t[i + 1] = (c.log[axis] ~= 0) and math.exp(x) or x
+            end
+            return t
+        end
+
+        return values, sigmas, edges(0), ny and edges(1) or nil
+    end
+
+    local function merge (self, other)
+        check_self(self, 'merge')
+        if metatype(other) ~= 'Tally' then
+            error.raise{fname = 'merge', argnum = 2,
+                expected = 'a Tally table', got = metatype.a(other)}
+        end
+
+        local a, b = self._c, other._c
+        for i = 0, 1 do
+            if (a.field[i] ~= b.field[i]) or (a.n[i] ~= b.n[i]) or
+               (a.log[i] ~= b.log[i]) or (a.min[i] ~= b.min[i]) or
+               (a.max[i] ~= b.max[i]) then
+                error.raise{fname = 'merge',
+                    description = 'inconsistent tallies'}
+            end
+        end
+        if a.weighted ~= b.weighted then
+            error.raise{fname = 'merge', description = 'inconsistent tallies'}
+        end
+
+        clib.pumas_tally_merge(a, b)
+        return self
+    end
+
+    local function update (self, state)
+        check_self(self, 'update')
+        if metatype(state) ~= 'State' then
+            error.raise{fname = 'update', argnum = 2,
+                expected = 'a State table', got = metatype.a(state)}
+        end
+
+        clib.pumas_tally_update(self._c, state._c)
+        return self
+    end
+
+    error.register('Tally.__index.clear', clear)
+    error.register('Tally.__index.clone', clone)
+    error.register('Tally.__index.dump', dump)
+    error.register('Tally.__index.histogram', histogram)
+    error.register('Tally.__index.merge', merge)
+    error.register('Tally.__index.update', update)
+
+    local methods = {
+        clear = clear,
+        clone = clone,
+        dump = dump,
+        histogram = histogram,
+        merge = merge,
+        update = update
+    }
+
+    function Tally:__index (k)
+        if k == '__metatype' then
+            return 'Tally'
+        end
+
+        local method = methods[k]
+        if method then return method end
+
+        local c = self._c
+        if k == 'entries' then
+            return tonumber(c.entries)
+        elseif k == 'mean' then
+            return (c.sum_w > 0) and c.mean or nil
+        elseif k == 'std' then
+            return (c.sum_w > 0) and math.sqrt(c.m2 / c.sum_w) or nil
+        elseif k == 'sum' then
+            return c.sum_w
+        elseif k == 'step' then
+            return c.step ~= 0
+        elseif k == 'weighted' then
+            return c.weighted ~= 0
+        elseif k == 'x' then
+            return axis_table(c, 0)
+        elseif k == 'y' then
+            return axis_table(c, 1)
+        else
+            error.raise{['type'] = 'Tally', bad_member = k}
+        end
+    end
+end
+
+
+function Tally.__newindex (_, k)
+    if (k == 'entries') or (k == 'mean') or (k == 'std') or (k == 'sum') or
+       (k == 'step') or (k == 'weighted') or (k == 'x') or (k == 'y') then
+        error.raise{['type'] = 'Tally', not_mutable = k}
+    else
+        error.raise{['type'] = 'Tally', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- The tally constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'Tally'}
+
+    local function parse_axis (axis, argname, histogram)
+        if type(axis) == 'string' then
+            axis = {field = axis}
+        elseif type(axis) ~= 'table' then
+            raise_error{argname = argname, expected = 'a string or a table',
+                got = metatype.a(axis)}
+        end
+
+        local field = FIELDS[axis.field]
+        if field == nil then
+            raise_error{argname = argname, description =
+                "unknown field '"..tostring(axis.field).."'"}
+        end
+
+        local bins, range, log = axis.bins, axis.range, axis.log and true
+        if (bins == nil) and (range == nil) and (not histogram) then
+            return field, 0
+        end
+
+        if (type(bins) ~= 'number') or (bins < 1) or (bins % 1 ~= 0) then
+            raise_error{argname = argname,
+                description = "'bins' must be a strictly positive integer"}
+        end
+        if (type(range) ~= 'table') or (type(range[1]) ~= 'number') or
+           (type(range[2]) ~= 'number') or (range[1] >= range[2]) or
+           (log and (range[1] <= 0)) then
+            raise_error{argname = argname, description = "invalid 'range'"}
+        end
+
+        return field, bins, range[1], range[2], log
+    end
+
+    local function new (cls, args)
+        local self
+        if type(args) == 'string' then
+            -- Restore a dumped tally
+            local size = #args
+            if size < ffi.sizeof(ctype) then
+                raise_error{argnum = 1, description = 'bad dump'}
+            end
+            local c = allocate(size, 'Tally')
+            ffi.copy(c, args, size)
+            if size_of(c) ~= size then
+                raise_error{argnum = 1, description = 'bad dump'}
+            end
+            self = setmetatable({_c = c}, cls)
+        elseif metatype(args) == 'Tally' then
+            local size = size_of(args._c)
+            local c = allocate(size, 'Tally')
+            ffi.copy(c, args._c, size)
+            self = setmetatable({_c = c}, cls)
+        elseif type(args) == 'table' then
+            for k, _ in pairs(args) do
+                if (k ~= 'x') and (k ~= 'y') and (k ~= 'step') and
+                   (k ~= 'weighted') then
+                    raise_error{argnum = 1, description =
+                        "unknown option '"..k.."'"}
+                end
+            end
+
+            local fx, nx, x0, x1, lx = parse_axis(args.x, 'x')
+            local fy, ny, y0, y1, ly = -1, 1
+            if args.y ~= nil then
+                if nx == 0 then
+                    raise_error{argname = 'y',
+                        description = "requires a binning of 'x'"}
+                end
+                fy, ny, y0, y1, ly = parse_axis(args.y, 'y', true)
+            end
+
+            local c = allocate(ffi.sizeof(ctype) +
+                2 * nx * ny * ffi.sizeof('double'), 'Tally')
+            c.step = args.step and 1 or 0
+            c.weighted = (args.weighted == false) and 0 or 1
+            c.field[0], c.field[1] = fx, fy
+            c.n[0], c.n[1] = nx, ny
+            for i, axis in ipairs{{x0, x1, lx}, {y0, y1, ly}} do
+                if axis[1] then
+                    c.min[i - 1], c.max[i - 1] = axis[1], axis[2]
+                    c.log[i - 1] = axis[3] and 1 or 0
+                    local a, b = axis[1], axis[2]
+                    if axis[3] then a, b = math.log(a), math.log(b) end
+                    c.offset[i - 1] = a
+                    c.scale[i - 1] = c.n[i - 1] / (b - a)
+                end
+            end
+            self = setmetatable({_c = c}, cls)
+        else
+            raise_error{argnum = 1, expected = 'a string or a table',
+                got = metatype.a(args)}
+        end
+
+        return self
+    end
+
+    tally.Tally = setmetatable(Tally, {__call = new})
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function tally.register_to (t)
+    t.Tally = tally.Tally
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return tally
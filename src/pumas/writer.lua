@@ -0,0 +1,467 @@
+-------------------------------------------------------------------------------
+-- Columnar binary output of Monte Carlo events
+-- Author: Valentin Niess
+-- License: GNU LGPL-3.0
+-------------------------------------------------------------------------------
+local ffi = require('ffi')
+local clib = require('pumas.clib')
+local error = require('pumas.error')
+local metatype = require('pumas.metatype')
+
+local writer = {}
+
+
+-------------------------------------------------------------------------------
+-- Written fields, i.e. tallied fields, the event flags and the media indices
+-------------------------------------------------------------------------------
+local FIELDS = {}
+local FIELD_NAMES = {}
+local DEFAULT_FIELDS = {}
+for _, k in ipairs{'charge', 'energy', 'distance', 'grammage', 'time',
+    'weight', 'position_x', 'position_y', 'position_z', 'direction_x',
+    'direction_y', 'direction_z', 'event', 'medium_start', 'medium_end'} do
+    local prefix = ((k == 'event') or (k:sub(1, 6) == 'medium')) and
+        'PUMAS_WRITER_' or 'PUMAS_TALLY_'
+    local v = tonumber(ffi.C[prefix..k:upper()])
+    FIELDS[k] = v
+    FIELD_NAMES[v] = k
+    table.insert(DEFAULT_FIELDS, k)
+end
+
+local MAGIC = 'PUMASEVT'
+local INDEX_MAGIC = 'PUMASIDX'
+
+
+-------------------------------------------------------------------------------
+-- The event writer metatype
+-------------------------------------------------------------------------------
+local EventWriter = {}
+
+
+local function copy (t)
+    local r = {}
+    for i, v in ipairs(t) do r[i] = v end
+    return r
+end
+
+
+local function close_c (c, media)
+    local n = #media
+    local names = ffi.new('const char *[?]', math.max(n, 1))
+    for i, name in ipairs(media) do names[i - 1] = name end
+    return clib.pumas_event_writer_close(c, n, names)
+end
+
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'EventWriter' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'an EventWriter table', got = metatype.a(self)}
+        elseif rawget(self, '_c') == nil then
+            error.raise{fname = fname, argnum = 1,
+                description = 'the writer is closed'}
+        end
+    end
+
+    -- Media are identified by their material name
+    local function medium_index (self, m)
+        if m == nil then return 0 end
+
+        local index = self._index[m]
+        if index == nil then
+            local name = m.material or 'Transparent'
+            index = self._names[name]
+            if index == nil then
+                table.insert(self._media, name)
+                index = #self._media
+                self._names[name] = index
+            end
+            self._index[m] = index
+        end
+        return index
+    end
+
+    local function close (self)
+        check_self(self, 'close')
+
+        local c = self._c
+        self._c = nil
+        ffi.gc(c, nil)
+        if close_c(c, self._media) ~= 0 then
+            error.raise{fname = 'close', description =
+                "could not write to '"..self._path.."'"}
+        end
+    end
+
+    local function flush (self)
+        check_self(self, 'flush')
+
+        if clib.pumas_event_writer_flush(self._c) ~= 0 then
+            error.raise{fname = 'flush', description =
+                "could not write to '"..self._path.."'"}
+        end
+        return self
+    end
+
+    local function write (self, state, event, media)
+        check_self(self, 'write')
+        if metatype(state) ~= 'State' then
+            error.raise{fname = 'write', argnum = 2,
+                expected = 'a State table', got = metatype.a(state)}
+        end
+
+        local flags = 0
+        if event ~= nil then
+            if metatype(event) ~= 'Event' then
+                error.raise{fname = 'write', argnum = 3,
+                    expected = 'an Event table', got = metatype.a(event)}
+            end
+            flags = event._value
+        end
+
+        local start, end_ = 0, 0
+        if media ~= nil then
+            if type(media) ~= 'table' then
+                error.raise{fname = 'write', argnum = 4,
+                    expected = 'a table', got = metatype.a(media)}
+            end
+            start = medium_index(self, media[1])
+            end_ = medium_index(self, media[2])
+        end
+
+        if clib.pumas_event_writer_push(self._c, state._c, flags, start,
+            end_) ~= 0 then
+            error.raise{fname = 'write', description =
+                "could not write to '"..self._path.."'"}
+        end
+        self._entries = self._entries + 1
+        return self
+    end
+
+    error.register('EventWriter.__index.close', close)
+    error.register('EventWriter.__index.flush', flush)
+    error.register('EventWriter.__index.write', write)
+
+    local methods = {
+        close = close,
+        flush = flush,
+        write = write
+    }
+
+    function EventWriter:__index (k)
+        if k == '__metatype' then
+            return 'EventWriter'
+        end
+
+        local method = methods[k]
+        if method then return method end
+
+        if k == 'chunk' then
+            return self._chunk
+        elseif k == 'closed' then
+            return rawget(self, '_c') == nil
+        elseif k == 'entries' then
+            return self._entries
+        elseif k == 'fields' then
+            return copy(self._fields)
+        elseif k == 'media' then
+            return copy(self._media)
+        elseif k == 'path' then
+            return self._path
+        else
+            error.raise{['type'] = 'EventWriter', bad_member = k}
+        end
+    end
+end
+
+
+function EventWriter.__newindex (_, k)
+    if (k == 'chunk') or (k == 'closed') or (k == 'entries') or
+       (k == 'fields') or (k == 'media') or (k == 'path') then
+        error.raise{['type'] = 'EventWriter', not_mutable = k}
+    else
+        error.raise{['type'] = 'EventWriter', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- The event writer constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'EventWriter'}
+
+    local function new (cls, args)
+        if type(args) ~= 'table' then
+            raise_error{argnum = 1, expected = 'a table',
+                got = metatype.a(args)}
+        end
+        for k, _ in pairs(args) do
+            if (k ~= 'path') and (k ~= 'fields') and (k ~= 'chunk') then
+                raise_error{argnum = 1, description =
+                    "unknown option '"..k.."'"}
+            end
+        end
+
+        local path = args.path
+        if type(path) ~= 'string' then
+            raise_error{argname = 'path', expected = 'a string',
+                got = metatype.a(path)}
+        end
+
+        local fields = args.fields or DEFAULT_FIELDS
+        if (type(fields) ~= 'table') or (#fields == 0) then
+            raise_error{argname = 'fields', expected = 'a non empty table',
+                got = metatype.a(fields)}
+        end
+        local n = #fields
+        local codes = ffi.new('int [?]', n)
+        for i, field in ipairs(fields) do
+            local code = FIELDS[field]
+            if code == nil then
+                raise_error{argname = 'fields', description =
+                    "unknown field '"..tostring(field).."'"}
+            end
+            codes[i - 1] = code
+        end
+
+        local chunk = args.chunk or 4096
+        if (type(chunk) ~= 'number') or (chunk < 1) or (chunk % 1 ~= 0) then
+            raise_error{argname = 'chunk',
+                description = 'must be a strictly positive integer'}
+        end
+
+        local c = clib.pumas_event_writer_create(path, n, codes, chunk)
+        if c == nil then
+            raise_error{argname = 'path', description =
+                "could not open '"..path.."'"}
+        end
+
+        local media = {}
+        ffi.gc(c, function (ptr) close_c(ptr, media) end)
+
+        return setmetatable({
+            _c = c,
+            _chunk = chunk,
+            _entries = 0,
+            _fields = copy(fields),
+            _index = setmetatable({}, {__mode = 'k'}),
+            _media = media,
+            _names = {},
+            _path = path
+        }, cls)
+    end
+
+    writer.EventWriter = setmetatable(EventWriter, {__call = new})
+end
+
+
+-------------------------------------------------------------------------------
+-- The event reader metatype
+-------------------------------------------------------------------------------
+local EventReader = {}
+
+
+local function read_array (file, ctype, n)
+    local array = ffi.new(ctype..' [?]', n)
+    if n == 0 then return array end
+
+    local size = n * ffi.sizeof(ctype)
+    local data = file:read(size)
+    if (data == nil) or (#data ~= size) then return nil end
+    ffi.copy(array, data, size)
+    return array
+end
+
+
+do
+    local function check_self (self, fname)
+        if metatype(self) ~= 'EventReader' then
+            error.raise{fname = fname, argnum = 1,
+                expected = 'an EventReader table', got = metatype.a(self)}
+        end
+    end
+
+    -- Read a chunk into the columns, starting at the given row
+    local function read_chunk (self, i, columns, row, fname)
+        local file = self._file
+        local n = tonumber(self._index[2 * i - 1])
+        file:seek('set', tonumber(self._index[2 * i - 2]) + 8)
+        local size = n * ffi.sizeof('double')
+        for _, field in ipairs(self._fields) do
+            local data = (size > 0) and file:read(size) or ''
+            if (data == nil) or (#data ~= size) then
+                error.raise{fname = fname, description =
+                    "could not read from '"..self._path.."'"}
+            end
+            ffi.copy(columns[field] + row, data, size)
+        end
+        return n
+    end
+
+    local function new_columns (self, n)
+        local columns = {}
+        for _, field in ipairs(self._fields) do
+            columns[field] = ffi.new('double [?]', n)
+        end
+        return columns
+    end
+
+    local function chunk (self, i)
+        check_self(self, 'chunk')
+        if (type(i) ~= 'number') or (i < 1) or (i > self._chunks) or
+           (i % 1 ~= 0) then
+            error.raise{fname = 'chunk', argnum = 2, description =
+                'invalid chunk index'}
+        end
+
+        local n = tonumber(self._index[2 * i - 1])
+        local columns = new_columns(self, n)
+        read_chunk(self, i, columns, 0, 'chunk')
+        return columns, n
+    end
+
+    local function read (self)
+        check_self(self, 'read')
+
+        local columns = new_columns(self, self._entries)
+        local row = 0
+        for i = 1, self._chunks do
+            row = row + read_chunk(self, i, columns, row, 'read')
+        end
+        return columns, row
+    end
+
+    error.register('EventReader.__index.chunk', chunk)
+    error.register('EventReader.__index.read', read)
+
+    local methods = {
+        chunk = chunk,
+        read = read
+    }
+
+    function EventReader:__index (k)
+        if k == '__metatype' then
+            return 'EventReader'
+        end
+
+        local method = methods[k]
+        if method then return method end
+
+        if k == 'chunks' then
+            return self._chunks
+        elseif k == 'entries' then
+            return self._entries
+        elseif k == 'fields' then
+            return copy(self._fields)
+        elseif k == 'media' then
+            return copy(self._media)
+        elseif k == 'path' then
+            return self._path
+        else
+            error.raise{['type'] = 'EventReader', bad_member = k}
+        end
+    end
+end
+
+
+function EventReader.__newindex (_, k)
+    if (k == 'chunks') or (k == 'entries') or (k == 'fields') or
+       (k == 'media') or (k == 'path') then
+        error.raise{['type'] = 'EventReader', not_mutable = k}
+    else
+        error.raise{['type'] = 'EventReader', bad_member = k}
+    end
+end
+
+
+-------------------------------------------------------------------------------
+-- The event reader constructor
+-------------------------------------------------------------------------------
+do
+    local raise_error = error.ErrorFunction{fname = 'EventReader'}
+
+    local function new (cls, path)
+        if type(path) ~= 'string' then
+            raise_error{argnum = 1, expected = 'a string',
+                got = metatype.a(path)}
+        end
+
+        local file = io.open(path, 'rb')
+        if file == nil then
+            raise_error{argnum = 1, description =
+                "could not open '"..path.."'"}
+        end
+
+        local function bad_format (description)
+            file:close()
+            raise_error{argnum = 1, description = description or
+                "bad format for '"..path.."'"}
+        end
+
+        -- Parse the header
+        if file:read(8) ~= MAGIC then bad_format() end
+        local header = read_array(file, 'int32_t', 3)
+        if (header == nil) or (header[0] ~= 1) then bad_format() end
+        local codes = read_array(file, 'int32_t', header[1])
+        if codes == nil then bad_format() end
+        local fields = {}
+        for i = 0, header[1] - 1 do
+            local field = FIELD_NAMES[codes[i]]
+            if field == nil then bad_format() end
+            fields[i + 1] = field
+        end
+
+        -- Parse the trailer and the index
+        file:seek('end', -24)
+        local trailer = read_array(file, 'int64_t', 2)
+        if (trailer == nil) or (file:read(8) ~= INDEX_MAGIC) then
+            bad_format("missing index for '"..path.."' (unclosed writer?)")
+        end
+        local chunks = tonumber(trailer[1])
+        file:seek('set', tonumber(trailer[0]))
+        local index = read_array(file, 'int64_t', 2 * chunks)
+        local n_media = read_array(file, 'int32_t', 1)
+        if (index == nil) or (n_media == nil) then bad_format() end
+
+        local media = {}
+        for i = 1, n_media[0] do
+            local length = read_array(file, 'int32_t', 1)
+            if length == nil then bad_format() end
+            media[i] = (length[0] > 0) and file:read(length[0]) or ''
+        end
+
+        local entries = 0
+        for i = 1, chunks do
+            entries = entries + tonumber(index[2 * i - 1])
+        end
+
+        return setmetatable({
+            _chunks = chunks,
+            _entries = entries,
+            _fields = fields,
+            _file = file,
+            _index = index,
+            _media = media,
+            _path = path
+        }, cls)
+    end
+
+    writer.EventReader = setmetatable(EventReader, {__call = new})
+end
+
+
+-------------------------------------------------------------------------------
+-- Register the subpackage
+-------------------------------------------------------------------------------
+function writer.register_to (t)
+    t.EventReader = writer.EventReader
+    t.EventWriter = writer.EventWriter
+end
+
+
+-------------------------------------------------------------------------------
+-- Return the package
+-------------------------------------------------------------------------------
+return writer
@@ -1,18 +1,55 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
 
 #include "pumas_extensions.h"
 
 
-/* Forward error messages to a buffer */
+/* Forward error messages to a buffer
+ *
+ * Worker threads redirect their errors to a private buffer, since the shared
+ * one would be written concurrently. Their errors are forwarded after the
+ * threads have been joined (see topography_run).
+ */
 #define ERROR_SIZE 2048
 static char last_error[ERROR_SIZE] = {0x0};
+static __thread char * thread_error = NULL;
+static __thread size_t thread_error_size = 0;
 
 static void forward_error(int rc, void (*caller)(void), const char * message)
 {
-        strncpy(last_error, message, ERROR_SIZE);
+        if (thread_error != NULL) {
+                strncpy(thread_error, message, thread_error_size - 1);
+                thread_error[thread_error_size - 1] = 0x0;
+        } else {
+                strncpy(last_error, message, ERROR_SIZE);
+        }
 }
 #undef ERROR_SIZE
 
@@ -61,6 +98,7 @@ void pumas_state_extended_reset(struct pumas_state_extended * state,
         state->context = context;
         state->geodetic.computed = 0;
         state->vertical.distance = -1;
+        state->score.geometry = NULL;
 }
 
 
@@ -72,21 +110,155 @@ struct pumas_geometry * pumas_geometry_get(struct pumas_context * context)
 }
 
 
-void pumas_geometry_set(
-    struct pumas_context * context, struct pumas_geometry * geometry)
+/* Flattened geometry tree, for navigation
+ *
+ * The nodes are stored contiguously in breadth first order, such that the
+ * daughters of a node have consecutive indices. Built-in geometries are
+ * dispatched with a switch, allowing direct calls.
+ */
+enum geometry_kind {
+        GEOMETRY_KIND_OTHER = 0,
+        GEOMETRY_KIND_INFINITE,
+        GEOMETRY_KIND_EARTH,
+        GEOMETRY_KIND_EARTH_FLAT,
+        GEOMETRY_KIND_POLYHEDRON,
+        GEOMETRY_KIND_MESH
+};
+
+struct geometry_node {
+        struct pumas_geometry * geometry;
+        int kind;
+        int exact;
+        int mother; /* Index of the mother node, or -1 */
+        int daughters; /* Index of the first daughter */
+        int n_daughters;
+};
+
+struct pumas_geometry_flat {
+        int size;
+        struct geometry_node nodes[];
+};
+
+
+static int geometry_count(struct pumas_geometry * geometry)
 {
-        struct pumas_user_data * user_data = context->user_data;
-        user_data->top = geometry;
+        int n = 1;
+        struct pumas_geometry * g;
+        for (g = geometry->daughters; g != NULL; g = g->next)
+                n += geometry_count(g);
+        return n;
 }
 
 
-static void geometry_reset(struct pumas_geometry * geometry)
+static int geometry_kind(struct pumas_geometry * geometry)
 {
-        if (geometry->reset != NULL) geometry->reset(geometry);
+        if (geometry->get == &pumas_geometry_infinite_get)
+                return GEOMETRY_KIND_INFINITE;
+        else if (geometry->get == &pumas_geometry_earth_get)
+                return GEOMETRY_KIND_EARTH;
+        else if (geometry->get == &pumas_geometry_earth_flat_get)
+                return GEOMETRY_KIND_EARTH_FLAT;
+        else if (geometry->get == &pumas_geometry_polyhedron_get)
+                return GEOMETRY_KIND_POLYHEDRON;
+        else if (geometry->get == &pumas_geometry_mesh_get)
+                return GEOMETRY_KIND_MESH;
+        else
+                return GEOMETRY_KIND_OTHER;
+}
+
+
+static struct pumas_geometry_flat * geometry_flatten(
+    struct pumas_geometry * geometry)
+{
+        const int n = geometry_count(geometry);
+        struct pumas_geometry_flat * flat = malloc(
+            sizeof(*flat) + n * sizeof(*flat->nodes));
+        if (flat == NULL) return NULL;
+        flat->size = n;
+
+        /* Breadth first traversal, using the nodes array as queue */
+        struct geometry_node * node = flat->nodes;
+        node->geometry = geometry;
+        node->mother = -1;
+        int i, size = 1;
+        for (i = 0; i < size; i++) {
+                node = flat->nodes + i;
+                struct pumas_geometry * g = node->geometry;
+                node->kind = geometry_kind(g);
+                node->exact = g->exact;
+                node->daughters = size;
+                node->n_daughters = 0;
+
+                struct pumas_geometry * d;
+                for (d = g->daughters; d != NULL; d = d->next) {
+                        struct geometry_node * daughter = flat->nodes + size;
+                        daughter->geometry = d;
+                        daughter->mother = i;
+                        node->n_daughters++;
+                        size++;
+                }
+        }
+
+        return flat;
+}
+
+
+static void geometry_node_get(const struct geometry_node * node,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+        struct pumas_geometry * g = node->geometry;
+        switch (node->kind) {
+        case GEOMETRY_KIND_INFINITE:
+                pumas_geometry_infinite_get(g, state, medium_p, step_p);
+                break;
+        case GEOMETRY_KIND_EARTH:
+                pumas_geometry_earth_get(g, state, medium_p, step_p);
+                break;
+        case GEOMETRY_KIND_EARTH_FLAT:
+                pumas_geometry_earth_flat_get(g, state, medium_p, step_p);
+                break;
+        case GEOMETRY_KIND_POLYHEDRON:
+                pumas_geometry_polyhedron_get(g, state, medium_p, step_p);
+                break;
+        case GEOMETRY_KIND_MESH:
+                pumas_geometry_mesh_get(g, state, medium_p, step_p);
+                break;
+        default:
+                g->get(g, state, medium_p, step_p);
+        }
+}
 
+
+/* Chain the nodes having a per event state, i.e. a reset method */
+static struct pumas_geometry * geometry_chain_resets(
+    struct pumas_geometry * geometry, struct pumas_geometry * chain)
+{
         struct pumas_geometry * g;
         for (g = geometry->daughters; g != NULL; g = g->next)
-                geometry_reset(g);
+                chain = geometry_chain_resets(g, chain);
+
+        if (geometry->reset != NULL) {
+                geometry->next_reset = chain;
+                chain = geometry;
+        }
+        return chain;
+}
+
+
+void pumas_geometry_set(
+    struct pumas_context * context, struct pumas_geometry * geometry)
+{
+        struct pumas_user_data * user_data = context->user_data;
+        user_data->top = geometry;
+        user_data->resets = (geometry != NULL) ?
+            geometry_chain_resets(geometry, NULL) : NULL;
+
+        /* If the flattening fails, the recursive navigation is used */
+        free(user_data->flat);
+        user_data->flat = (geometry != NULL) ?
+            geometry_flatten(geometry) : NULL;
+        user_data->current_index = 0;
 }
 
 
@@ -94,16 +266,22 @@ void pumas_geometry_reset(struct pumas_context * context)
 {
         struct pumas_user_data * user_data = context->user_data;
         user_data->current = user_data->top;
-        if (user_data->top != NULL)
-                geometry_reset(user_data->top);
+        user_data->current_index = 0;
+
+        struct pumas_geometry * g;
+        for (g = user_data->resets; g != NULL; g = g->next_reset)
+                g->reset(g);
 }
 
 
 static void geometry_destroy(struct pumas_geometry * geometry)
 {
-        struct pumas_geometry * g;
-        for (g = geometry->daughters; g != NULL; g = g->next)
+        /* The next daughter is read before its elder is destroyed */
+        struct pumas_geometry * g, * next;
+        for (g = geometry->daughters; g != NULL; g = next) {
+                next = g->next;
                 geometry_destroy(g);
+        }
         if (geometry->destroy != NULL) geometry->destroy(geometry);
 }
 
@@ -111,11 +289,20 @@ static void geometry_destroy(struct pumas_geometry * geometry)
 void pumas_geometry_destroy(struct pumas_context * context)
 {
         struct pumas_user_data * user_data = context->user_data;
-        if (user_data->top != NULL) {
-                geometry_destroy(user_data->top);
-                user_data->top = NULL;
-        }
+        if (user_data->top != NULL) geometry_destroy(user_data->top);
+        pumas_geometry_clear(context);
+}
+
+
+void pumas_geometry_clear(struct pumas_context * context)
+{
+        struct pumas_user_data * user_data = context->user_data;
+        user_data->top = NULL;
         user_data->current = NULL;
+        user_data->resets = NULL;
+        free(user_data->flat);
+        user_data->flat = NULL;
+        user_data->current_index = 0;
 }
 
 
@@ -143,12 +330,13 @@ struct pumas_medium * PUMAS_MEDIUM_TRANSPARENT = &transparent_medium;
 static void geometry_navigate(struct pumas_geometry * geometry,
     struct pumas_state * state, struct pumas_medium ** medium_p,
     double * step_p, struct pumas_geometry * exclude,
-    struct pumas_geometry ** current_p)
+    struct pumas_geometry ** current_p, int * exact_p)
 {
         if (geometry == NULL) return;
 
         geometry->get(geometry, state, medium_p, step_p);
         *current_p = geometry;
+        if (!geometry->exact) *exact_p = 0;
 
         struct pumas_state_extended * extended = (void *)state;
         struct pumas_user_data * user_data =
@@ -170,7 +358,7 @@ static void geometry_navigate(struct pumas_geometry * geometry,
                         if (daughter == exclude) continue;
 
                         geometry_navigate(daughter, state, medium_p, step_p,
-                                          geometry, current_p);
+                                          geometry, current_p, exact_p);
                         if (*medium_p != NULL) break;
                         else if (step_p != NULL) {
                                 if ((*step_p > 0) && (*step_p < step))
@@ -189,8 +377,110 @@ static void geometry_navigate(struct pumas_geometry * geometry,
         if ((*medium_p == NULL) && (geometry->mother != NULL) &&
             (geometry->mother != exclude)) {
                         geometry_navigate(geometry->mother, state, medium_p,
-                                          step_p, geometry, current_p);
+                                          step_p, geometry, current_p,
+                                          exact_p);
+        }
+}
+
+
+/* Navigation of a flattened geometry tree, without debug callback
+ *
+ * The node and its daughters are searched for, but not its mother. The index
+ * of the current node is returned.
+ */
+static int geometry_navigate_flat_down(const struct pumas_geometry_flat * flat,
+    int index, int exclude, struct pumas_state * state,
+    struct pumas_medium ** medium_p, double * step_p, int * exact_p)
+{
+        const struct geometry_node * node = flat->nodes + index;
+        geometry_node_get(node, state, medium_p, step_p);
+        if (!node->exact) *exact_p = 0;
+
+        int current = index;
+        if ((*medium_p != NULL) && (node->n_daughters > 0)) {
+                double step;
+                struct pumas_medium * medium = *medium_p;
+                if (step_p != NULL) step = *step_p;
+
+                *medium_p = NULL;
+                const int end = node->daughters + node->n_daughters;
+                int i;
+                for (i = node->daughters; i < end; i++) {
+                        if (i == exclude) continue;
+
+                        current = geometry_navigate_flat_down(flat, i, -1,
+                            state, medium_p, step_p, exact_p);
+                        if (*medium_p != NULL) break;
+                        else if (step_p != NULL) {
+                                if ((*step_p > 0) && (*step_p < step))
+                                        step = *step_p;
+                        }
+                }
+                if (*medium_p == NULL) {
+                        current = index;
+                        *medium_p = medium;
+                        if (step_p != NULL) *step_p = step;
+                }
+        }
+
+        if (*medium_p == PUMAS_MEDIUM_TRANSPARENT) *medium_p = NULL;
+        return current;
+}
+
+
+static int geometry_navigate_flat(const struct pumas_geometry_flat * flat,
+    int index, struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p, int * exact_p)
+{
+        int current = geometry_navigate_flat_down(
+            flat, index, -1, state, medium_p, step_p, exact_p);
+
+        /* Climb up the tree, excluding the already searched daughter */
+        int mother;
+        while ((*medium_p == NULL) &&
+               ((mother = flat->nodes[index].mother) >= 0)) {
+                current = geometry_navigate_flat_down(
+                    flat, mother, index, state, medium_p, step_p, exact_p);
+                index = mother;
+        }
+
+        return current;
+}
+
+
+/* Score the step since the last navigation, and the volume crossings
+ *
+ * Note that this must only be called for committed steps, i.e. when PUMAS
+ * requests a step length. Otherwise, the medium callback might be locating a
+ * boundary after an approximate step, which would be counted as a crossing.
+ */
+static void geometry_score(struct pumas_context * context,
+    struct pumas_state_extended * extended, struct pumas_geometry * current)
+{
+        const struct pumas_state * state = &extended->base;
+        struct pumas_geometry * previous = extended->score.geometry;
+        if (previous != NULL) {
+                struct pumas_geometry_score * score = previous->score;
+                if (score != NULL) {
+                        const double sgn = (context->mode.direction ==
+                            PUMAS_MODE_FORWARD) ? 1 : -1;
+                        const double w = state->weight;
+                        score->length += w *
+                            (state->distance - extended->score.distance);
+                        score->grammage += w *
+                            (state->grammage - extended->score.grammage);
+                        score->energy += w * sgn *
+                            (extended->score.energy - state->energy);
+                }
+                if ((current != previous) && (current != NULL) &&
+                    (current->score != NULL))
+                        current->score->crossings += state->weight;
         }
+
+        extended->score.geometry = current;
+        extended->score.distance = state->distance;
+        extended->score.grammage = state->grammage;
+        extended->score.energy = state->energy;
 }
 
 
@@ -207,340 +497,2640 @@ enum pumas_step pumas_geometry_medium(struct pumas_context * context,
         extended->geodetic.computed = 0;
 
         struct pumas_medium * tmp;
-        geometry_navigate(geometry, state, &tmp, step_p, NULL,
-                          &user_data->current);
+        int exact = 1;
+        const struct pumas_geometry_flat * flat = user_data->flat;
+        if ((flat != NULL) && (user_data->callback == NULL)) {
+                int index = user_data->current_index;
+                if ((index < 0) || (index >= flat->size)) index = 0;
+                index = geometry_navigate_flat(
+                    flat, index, state, &tmp, step_p, &exact);
+                user_data->current_index = index;
+                user_data->current = flat->nodes[index].geometry;
+        } else {
+                geometry_navigate(geometry, state, &tmp, step_p, NULL,
+                                  &user_data->current, &exact);
+                user_data->current_index = -1;
+        }
         if (medium_p != NULL) *medium_p = tmp;
+        if (user_data->scoring && (step_p != NULL))
+                geometry_score(context, extended, user_data->current);
 
-        return PUMAS_STEP_APPROXIMATE; /* XXX Exact steps for polyhedrons? */
+        /* XXX Exact steps for polyhedrons? */
+        return exact ? PUMAS_STEP_EXACT : PUMAS_STEP_APPROXIMATE;
 }
 
 
-static double add_global_magnet(struct pumas_state * state,
-    struct pumas_locals * locals)
+/* Transport with a weight window applied at geometry boundaries and at
+ * kinetic energy thresholds
+ */
+static int weight_window_roulette(struct pumas_context * context,
+    struct pumas_state * state, const struct pumas_weight_window * window)
 {
-        struct pumas_state_extended * extended = (void *)state;
-        struct pumas_context * context = extended->context;
-        struct pumas_user_data * user_data = context->user_data;
-        struct pumas_geometry * geometry = user_data->current;
-        if (geometry->magnet == NULL)
+        /* The expected weight is conserved, i.e. estimators remain unbiased */
+        if (state->weight >= window->lower) return 1;
+        if (context->random(context) * window->survival < state->weight) {
+                state->weight = window->survival;
+                return 1;
+        } else {
+                state->weight = 0;
                 return 0;
+        }
+}
 
-        double magnet[3];
-        const double s = geometry->magnet(geometry, state, magnet);
 
+static double weight_window_threshold(struct pumas_context * context,
+    const struct pumas_state * state, const struct pumas_weight_window * window)
+{
+        /* Next energy threshold along the transport direction, or 0 */
         int i;
-        for (i = 0; i < 3; i++)
-                locals->magnet[i] += magnet[i];
-
-        return s;
+        if (context->mode.direction == PUMAS_MODE_FORWARD) {
+                for (i = window->n_energies - 1; i >= 0; i--) {
+                        if (window->energies[i] < state->energy)
+                                return window->energies[i];
+                }
+        } else {
+                for (i = 0; i < window->n_energies; i++) {
+                        if (window->energies[i] > state->energy)
+                                return window->energies[i];
+                }
+        }
+        return 0;
 }
 
 
-/* Uniform medium */
-static double uniform_locals(struct pumas_medium * medium,
-    struct pumas_state * state, struct pumas_locals * locals)
+static enum pumas_return weight_window_transport(
+    struct pumas_context * context, struct pumas_state * state,
+    enum pumas_event * event, struct pumas_medium * media[2])
 {
-        struct pumas_medium_uniform * uniform =
-            (struct pumas_medium_uniform *)medium;
-        memcpy(locals, &uniform->locals, sizeof *locals);
+        struct pumas_user_data * user_data = context->user_data;
+        const struct pumas_weight_window * window = &user_data->window;
+        if (!window->enabled)
+                return pumas_context_transport(context, state, event, media);
+
+        /* Stop the transport at geometry boundaries and at energy thresholds.
+         * The control is returned to the caller only for the events that it
+         * requested
+         */
+        const enum pumas_event user_event = context->event;
+        const double user_limit = context->limit.energy;
+        const int forward = (context->mode.direction == PUMAS_MODE_FORWARD);
+
+        enum pumas_return rc;
+        struct pumas_medium * start = NULL;
+        int first = 1;
+        for (;;) {
+                /* Set the next energy threshold, if closer than the user
+                 * limit
+                 */
+                context->event = user_event | PUMAS_EVENT_MEDIUM;
+                context->limit.energy = user_limit;
+                int threshold = 0;
+                const double energy = weight_window_threshold(
+                    context, state, window);
+                if ((energy > 0) && (!(user_event & PUMAS_EVENT_LIMIT_ENERGY) ||
+                    (forward ? (energy > user_limit) :
+                               (energy < user_limit)))) {
+                        context->event |= PUMAS_EVENT_LIMIT_ENERGY;
+                        context->limit.energy = energy;
+                        threshold = 1;
+                }
 
-        /* Look for a global magnetic field */
-        return add_global_magnet(state, locals);
+                /* The start state of restarts has already been recorded,
+                 * as the end state of the previous transport
+                 */
+                user_data->restart = !first;
+                rc = pumas_context_transport(context, state, event, media);
+                if (first) {
+                        start = media[0];
+                        first = 0;
+                }
+                if (rc != PUMAS_RETURN_SUCCESS) break;
+
+                /* Play the roulette at boundaries and at thresholds */
+                int user = 0;
+                if (*event == PUMAS_EVENT_MEDIUM) {
+                        if (media[1] == NULL) break;
+                        user = user_event & PUMAS_EVENT_MEDIUM;
+                } else if (!threshold ||
+                    (*event != PUMAS_EVENT_LIMIT_ENERGY)) {
+                        break;
+                }
+
+                if (!weight_window_roulette(context, state, window)) {
+                        *event = PUMAS_EVENT_WEIGHT;
+                        break;
+                }
+                if (user) {
+                        /* The media of the last step are returned */
+                        start = media[0];
+                        break;
+                }
+        }
+
+        media[0] = start;
+        context->event = user_event;
+        context->limit.energy = user_limit;
+        user_data->restart = 0;
+        return rc;
 }
 
 
-void pumas_medium_uniform_initialise(struct pumas_medium_uniform * uniform,
-    int material, double density, const double * magnet)
+/* Mersenne Twister PRNG, following Matsumoto and Nishimura (1998)
+ *
+ * The PRNG is managed by the extensions, instead of PUMAS, in order to expose
+ * its full state, e.g. for checkpoints.
+ */
+#define MT_N 624
+#define MT_M 397
+
+static void random_initialise(
+    struct pumas_random_state * random, unsigned long seed)
 {
-        uniform->medium.material = material;
-        uniform->medium.locals = &uniform_locals;
-        uniform->locals.density = density;
-        if (magnet != NULL) {
-                memcpy(uniform->locals.magnet, magnet,
-                    sizeof uniform->locals.magnet);
-        } else {
-                memset(uniform->locals.magnet, 0x0,
-                    sizeof uniform->locals.magnet);
+        /* Only 32 bits are used, thus the seed is reduced accordingly */
+        seed &= 0xffffffffUL;
+        random->seed = seed;
+        random->data[0] = seed;
+        int j;
+        for (j = 1; j < MT_N; j++) {
+                const uint32_t previous = random->data[j - 1];
+                random->data[j] =
+                    1812433253UL * (previous ^ (previous >> 30)) + j;
         }
+        random->index = MT_N;
 }
 
 
-/* Medium with a density gradient */
-double pumas_medium_gradient_density(
-    struct pumas_medium_gradient * medium, struct pumas_state_extended * state)
+double pumas_random_uniform01(struct pumas_context * context)
 {
-        /* Project onto the gradient axis */
-        const double * const u = medium->gradient.axis;
-        double z;
-        if (medium->gradient.project != NULL) {
-                z = medium->gradient.project(medium, state);
-        } else {
-                const double * const r = state->base.position;
-                z = r[0] * u[0] + r[1] * u[1] + r[2] * u[2];
+        struct pumas_user_data * user_data = context->user_data;
+        struct pumas_random_state * random = &user_data->random;
+
+        if (random->index >= MT_N) {
+                /* Generate N words at once */
+                uint32_t * data = random->data;
+                int k;
+                for (k = 0; k < MT_N; k++) {
+                        const uint32_t y = (data[k] & 0x80000000UL) |
+                            (data[(k + 1) % MT_N] & 0x7fffffffUL);
+                        data[k] = data[(k + MT_M) % MT_N] ^ (y >> 1) ^
+                            ((y & 0x1UL) ? 0x9908b0dfUL : 0x0UL);
+                }
+                random->index = 0;
         }
 
-        /* Compute the density */
-        if (medium->gradient.type == PUMAS_MEDIUM_GRADIENT_LINEAR) {
-                return (1. + (z - medium->gradient.z0) /
-                    medium->gradient.lambda) * medium->gradient.rho0;
-        } else {
-                return medium->gradient.rho0 *
-                    exp((z - medium->gradient.z0) / medium->gradient.lambda);
-        }
+        /* Tempering */
+        uint32_t y = random->data[random->index++];
+        y ^= (y >> 11);
+        y ^= (y << 7) & 0x9d2c5680UL;
+        y ^= (y << 15) & 0xefc60000UL;
+        y ^= (y >> 18);
+
+        /* Convert to a floating point in ]0, 1[ */
+        return (0.5 + y) / 4294967296.;
 }
 
+#undef MT_N
+#undef MT_M
 
-static double gradient_locals(struct pumas_medium * medium_,
-    struct pumas_state * state, struct pumas_locals * locals)
-{
-#define GRADIENT_MIN_PROJECTION 5E-02
-#define GRADIENT_RESOLUTION 1E-02
 
-        /* Set the magnetic field */
-        struct pumas_medium_gradient * medium = (void *)medium_;
-        memcpy(locals->magnet, medium->magnet, sizeof locals->magnet);
-        double step = add_global_magnet(state, locals);
+void pumas_random_seed_set(
+    struct pumas_context * context, const unsigned long * seed)
+{
+        unsigned long value;
+        if (seed == NULL) {
+                /* Seed from the OS entropy, if available */
+                FILE * stream = fopen("/dev/urandom", "rb");
+                if ((stream == NULL) ||
+                    (fread(&value, sizeof(value), 1, stream) != 1)) {
+                        value = (unsigned long)time(NULL) ^
+                            (unsigned long)clock();
+                }
+                if (stream != NULL) fclose(stream);
+        } else {
+                value = *seed;
+        }
 
-        /* Compute the density and the gradient length */
-        locals->density = pumas_medium_gradient_density(medium, (void *)state);
+        struct pumas_user_data * user_data = context->user_data;
+        random_initialise(&user_data->random, value);
+}
 
-        /* Compute the gradient length */
-        const double * const u = medium->gradient.axis;
-        const double * const v = state->direction;
-        double d = fabs(u[0] * v[0] + u[1] * v[1] + u[2] * v[2]);
-        if (d < GRADIENT_MIN_PROJECTION)
-                d = GRADIENT_MIN_PROJECTION;
 
-        const double step2 =
-            fabs(medium->gradient.lambda / d) * GRADIENT_RESOLUTION;
-        if (step <= 0) return step2;
-        else return (step < step2) ? step: step2;
+unsigned long pumas_random_seed_get(struct pumas_context * context)
+{
+        struct pumas_user_data * user_data = context->user_data;
+        return user_data->random.seed;
 }
 
 
-void pumas_medium_gradient_initialise(
-    struct pumas_medium_gradient * medium, int material,
-    enum pumas_medium_gradient_type type, double lambda, double z0,
-    double rho0, const double * magnet)
+/* Native tallies */
+static double tally_field(const struct pumas_state * state, int field)
 {
-        medium->medium.material = material;
-        medium->medium.locals = &gradient_locals;
+        switch (field) {
+                case PUMAS_TALLY_CHARGE:
+                        return state->charge;
+                case PUMAS_TALLY_ENERGY:
+                        return state->energy;
+                case PUMAS_TALLY_DISTANCE:
+                        return state->distance;
+                case PUMAS_TALLY_GRAMMAGE:
+                        return state->grammage;
+                case PUMAS_TALLY_TIME:
+                        return state->time;
+                case PUMAS_TALLY_WEIGHT:
+                        return state->weight;
+                case PUMAS_TALLY_POSITION_X:
+                case PUMAS_TALLY_POSITION_Y:
+                case PUMAS_TALLY_POSITION_Z:
+                        return state->position[field - PUMAS_TALLY_POSITION_X];
+                case PUMAS_TALLY_DIRECTION_X:
+                case PUMAS_TALLY_DIRECTION_Y:
+                case PUMAS_TALLY_DIRECTION_Z:
+                        return state->direction[
+                            field - PUMAS_TALLY_DIRECTION_X];
+                default:
+                        return 0;
+        }
+}
 
-        medium->gradient.type = type;
-        medium->gradient.lambda = lambda;
-        medium->gradient.z0 = z0;
-        medium->gradient.rho0 = rho0;
 
-        medium->gradient.project = NULL;
-        memset(medium->gradient.axis, 0x0,
-            sizeof medium->gradient.axis);
+static int tally_bin(const struct pumas_tally * tally, int axis, double x)
+{
+        if (tally->log[axis]) {
+                if (x <= 0) return -1;
+                x = log(x);
+        }
+        const double r = (x - tally->offset[axis]) * tally->scale[axis];
+        if ((r < 0) || (r >= tally->n[axis])) return -1;
+        return (int)r;
+}
 
-        if (magnet != NULL)
-                memcpy(medium->magnet, magnet, sizeof medium->magnet);
-        else
-                memset(medium->magnet, 0x0, sizeof medium->magnet);
 
-#undef GRADIENT_MIN_PROJECTION
-#undef GRADIENT_RESOLUTION
+void pumas_tally_update(
+    struct pumas_tally * tally, const struct pumas_state * state)
+{
+        const double w = tally->weighted ? state->weight : 1;
+        if (w == 0) return;
+        const double x = tally_field(state, tally->field[0]);
+
+        /* Update the statistics, following West (1979) */
+        tally->entries++;
+        tally->sum_w += w;
+        tally->sum_w2 += w * w;
+        const double delta = x - tally->mean;
+        tally->mean += delta * w / tally->sum_w;
+        tally->m2 += w * delta * (x - tally->mean);
+
+        /* Update the histogram */
+        if (tally->n[0] <= 0) return;
+        int index = tally_bin(tally, 0, x);
+        if (index < 0) return;
+        if (tally->field[1] >= 0) {
+                const double y = tally_field(state, tally->field[1]);
+                const int j = tally_bin(tally, 1, y);
+                if (j < 0) return;
+                index = index * tally->n[1] + j;
+        }
+        tally->data[2 * index] += w;
+        tally->data[2 * index + 1] += w * w;
 }
 
 
-double pumas_medium_gradient_project_altitude(
-    struct pumas_medium_gradient * medium,
-    struct pumas_state_extended * state)
+void pumas_tally_merge(
+    struct pumas_tally * tally, const struct pumas_tally * other)
 {
-#define VERTICAL_UPDATE_DISTANCE 1E+03
+        if (other->sum_w == 0) return;
+
+        /* Merge the statistics, following Chan et al. (1979) */
+        const double sum_w = tally->sum_w + other->sum_w;
+        const double delta = other->mean - tally->mean;
+        tally->mean += delta * other->sum_w / sum_w;
+        tally->m2 += other->m2 +
+            delta * delta * tally->sum_w * other->sum_w / sum_w;
+        tally->entries += other->entries;
+        tally->sum_w = sum_w;
+        tally->sum_w2 += other->sum_w2;
+
+        /* Merge the histograms */
+        const int n = 2 * tally->n[0] * ((tally->field[1] >= 0) ?
+            tally->n[1] : 1);
+        int i;
+        for (i = 0; i < n; i++)
+                tally->data[i] += other->data[i];
+}
 
-        if (!state->geodetic.computed) {
-                turtle_ecef_to_geodetic(state->base.position,
-                                        &state->geodetic.latitude,
-                                        &state->geodetic.longitude,
-                                        &state->geodetic.altitude);
-                state->geodetic.computed = 1;
-        }
 
-        if (state->base.distance >= state->vertical.distance) {
-                turtle_ecef_from_horizontal(state->geodetic.latitude,
-                                            state->geodetic.longitude, 0, 90,
-                                            state->vertical.last);
-                state->vertical.distance = state->base.distance +
-                    VERTICAL_UPDATE_DISTANCE;
+static void tally_update_all(
+    struct pumas_context * context, struct pumas_state * state, int step)
+{
+        struct pumas_user_data * user_data = context->user_data;
+        int i;
+        for (i = 0; i < user_data->n_tallies; i++) {
+                struct pumas_tally * tally = user_data->tallies[i];
+                if (tally->step == step)
+                        pumas_tally_update(tally, state);
         }
-        memcpy(medium->gradient.axis, state->vertical.last,
-               sizeof medium->gradient.axis);
+}
 
-        return state->geodetic.altitude;
 
-#undef VERTICAL_UPDATE_DISTANCE
+void pumas_tally_record(struct pumas_context * context,
+    struct pumas_state * state, struct pumas_medium * medium,
+    enum pumas_event event)
+{
+        /* Skip duplicate states when the transport is restarted */
+        struct pumas_user_data * user_data = context->user_data;
+        if ((event == PUMAS_EVENT_START) && user_data->restart) return;
+
+        tally_update_all(context, state, 1);
 }
 
 
-void pumas_geometry_infinite_get(struct pumas_geometry * base_geometry,
-    struct pumas_state * state, struct pumas_medium ** medium_p,
-    double * step_p)
+/* Transport with a weight window and with native tallies */
+enum pumas_return pumas_extended_transport(
+    struct pumas_context * context, struct pumas_state * state,
+    enum pumas_event * event, struct pumas_medium * media[2])
 {
-        if (medium_p != NULL) {
+        struct pumas_user_data * user_data = context->user_data;
+        user_data->scoring = 1;
+        const enum pumas_return rc = weight_window_transport(
+            context, state, event, media);
+        user_data->scoring = 0;
+
+        if (rc == PUMAS_RETURN_SUCCESS) {
+                /* Score the last step, up to the final state */
+                geometry_score(context, (void *)state, NULL);
+                tally_update_all(context, state, 0);
+                user_data->events++;
+        }
+        return rc;
+}
+
+
+/* Checkpoints of Monte Carlo runs
+ *
+ * The PRNG state, the events counter and the content of attached tallies are
+ * dumped to a binary file. The file is first written to a temporary path and
+ * then renamed, such that a pre-empted checkpoint does not corrupt the
+ * previous one.
+ */
+#define CHECKPOINT_MAGIC "PUMASCKP"
+#define CHECKPOINT_VERSION 1
+
+static int64_t tally_size(const struct pumas_tally * tally)
+{
+        const int64_t n = tally->n[0] * ((tally->field[1] >= 0) ?
+            tally->n[1] : 1);
+        return sizeof(*tally) + 2 * n * sizeof(*tally->data);
+}
+
+
+enum pumas_return pumas_context_checkpoint(
+    struct pumas_context * context, const char * path)
+{
+        const size_t n = strlen(path);
+        char * tmp = malloc(n + 5);
+        if (tmp == NULL) return PUMAS_RETURN_MEMORY_ERROR;
+        memcpy(tmp, path, n);
+        memcpy(tmp + n, ".tmp", 5);
+
+        FILE * stream = fopen(tmp, "wb");
+        if (stream == NULL) {
+                free(tmp);
+                return PUMAS_RETURN_PATH_ERROR;
+        }
+
+        struct pumas_user_data * user_data = context->user_data;
+        const int32_t header[2] = {CHECKPOINT_VERSION, user_data->n_tallies};
+        if (fwrite(CHECKPOINT_MAGIC, 1, 8, stream) != 8) goto error;
+        if (fwrite(header, sizeof(*header), 2, stream) != 2) goto error;
+        if (fwrite(&user_data->random, sizeof(user_data->random), 1,
+            stream) != 1) goto error;
+        if (fwrite(&user_data->events, sizeof(user_data->events), 1,
+            stream) != 1) goto error;
+
+        int i;
+        for (i = 0; i < user_data->n_tallies; i++) {
+                const struct pumas_tally * tally = user_data->tallies[i];
+                const int64_t size = tally_size(tally);
+                if (fwrite(&size, sizeof(size), 1, stream) != 1) goto error;
+                if (fwrite(tally, size, 1, stream) != 1) goto error;
+        }
+
+        const int rc = fclose(stream);
+        stream = NULL;
+        if (rc != 0) goto error;
+#ifdef _WIN32
+        remove(path);
+#endif
+        if (rename(tmp, path) != 0) goto error;
+
+        free(tmp);
+        return PUMAS_RETURN_SUCCESS;
+error:
+        if (stream != NULL) fclose(stream);
+        remove(tmp);
+        free(tmp);
+        return PUMAS_RETURN_IO_ERROR;
+}
+
+
+enum pumas_return pumas_context_restore(
+    struct pumas_context * context, const char * path)
+{
+        FILE * stream = fopen(path, "rb");
+        if (stream == NULL) return PUMAS_RETURN_PATH_ERROR;
+
+        /* The checkpoint is loaded to a buffer before being restored, such
+         * that the context is left unchanged in case of error
+         */
+        struct pumas_user_data * user_data = context->user_data;
+        enum pumas_return rc = PUMAS_RETURN_FORMAT_ERROR;
+        char magic[8];
+        int32_t header[2];
+        struct pumas_random_state random;
+        double events;
+        char * buffer = NULL;
+
+        if ((fread(magic, 1, 8, stream) != 8) ||
+            (memcmp(magic, CHECKPOINT_MAGIC, 8) != 0)) goto exit;
+        if ((fread(header, sizeof(*header), 2, stream) != 2) ||
+            (header[0] != CHECKPOINT_VERSION)) goto exit;
+        if (fread(&random, sizeof(random), 1, stream) != 1) goto exit;
+        if (fread(&events, sizeof(events), 1, stream) != 1) goto exit;
+
+        if (header[1] != user_data->n_tallies) {
+                rc = PUMAS_RETURN_VALUE_ERROR;
+                goto exit;
+        }
+
+        int64_t total = 0;
+        int i;
+        for (i = 0; i < user_data->n_tallies; i++)
+                total += tally_size(user_data->tallies[i]);
+        buffer = malloc(total + 1);
+        if (buffer == NULL) {
+                rc = PUMAS_RETURN_MEMORY_ERROR;
+                goto exit;
+        }
+
+        /* Check that tallies have the same configuration */
+        const size_t head = offsetof(struct pumas_tally, entries);
+        char * p = buffer;
+        for (i = 0; i < user_data->n_tallies; i++) {
+                const struct pumas_tally * tally = user_data->tallies[i];
+                const int64_t expected = tally_size(tally);
+                int64_t size;
+                if (fread(&size, sizeof(size), 1, stream) != 1) goto exit;
+                if ((size != expected) ||
+                    (fread(p, size, 1, stream) != 1)) goto exit;
+                if (memcmp(p, tally, head) != 0) {
+                        rc = PUMAS_RETURN_VALUE_ERROR;
+                        goto exit;
+                }
+                p += size;
+        }
+
+        /* Restore the context */
+        user_data->random = random;
+        user_data->events = events;
+        for (p = buffer, i = 0; i < user_data->n_tallies; i++) {
+                struct pumas_tally * tally = user_data->tallies[i];
+                const int64_t size = tally_size(tally);
+                memcpy(tally, p, size);
+                p += size;
+        }
+        rc = PUMAS_RETURN_SUCCESS;
+exit:
+        fclose(stream);
+        free(buffer);
+        return rc;
+}
+
+#undef CHECKPOINT_MAGIC
+#undef CHECKPOINT_VERSION
+
+
+/* Columnar writer of Monte Carlo events
+ *
+ * Events are buffered in column oriented chunks. Full chunks are written by a
+ * background thread while the next chunk is being filled (double buffering).
+ * An index of chunks and a table of media names are appended when closing the
+ * writer, allowing for random access to chunks.
+ */
+#define WRITER_MAGIC "PUMASEVT"
+#define WRITER_INDEX_MAGIC "PUMASIDX"
+#define WRITER_VERSION 1
+
+struct pumas_event_writer {
+        FILE * stream;
+        int n_fields;
+        int chunk; /* Capacity of a chunk, in events */
+        int size; /* Number of events in the filled buffer */
+        int filled; /* Index of the filled buffer */
+        double * buffer[2];
+        int status; /* I/O status, non zero on error */
+
+        /* Index of written chunks, as (offset, size) pairs */
+        int64_t * index;
+        int n_chunks;
+        int capacity;
+        int64_t offset;
+
+#ifndef _WIN32
+        pthread_t thread;
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+        int pending; /* Number of events waiting to be written */
+        int stop;
+#endif
+        int fields[];
+};
+
+
+/* Write a chunk. The I/O status is left to the caller, which updates it
+ * under the writer mutex
+ */
+static int writer_dump(
+    struct pumas_event_writer * writer, const double * buffer, int size)
+{
+        if (writer->n_chunks >= writer->capacity) {
+                const int capacity = 2 * writer->capacity + 16;
+                int64_t * index = realloc(writer->index,
+                    2 * capacity * sizeof(*index));
+                if (index == NULL) goto error;
+                writer->index = index;
+                writer->capacity = capacity;
+        }
+
+        /* Write the chunk size followed by the columns */
+        FILE * stream = writer->stream;
+        const int64_t n = size;
+        if (fwrite(&n, sizeof(n), 1, stream) != 1) goto error;
+        int i;
+        for (i = 0; i < writer->n_fields; i++) {
+                if (fwrite(buffer + i * writer->chunk, sizeof(*buffer), size,
+                    stream) != size) goto error;
+        }
+
+        writer->index[2 * writer->n_chunks] = writer->offset;
+        writer->index[2 * writer->n_chunks + 1] = n;
+        writer->n_chunks++;
+        writer->offset += sizeof(n) + writer->n_fields * n * sizeof(*buffer);
+        return 0;
+error:
+        return -1;
+}
+
+
+#ifndef _WIN32
+static void * writer_run(void * arg)
+{
+        struct pumas_event_writer * writer = arg;
+
+        pthread_mutex_lock(&writer->mutex);
+        for (;;) {
+                while ((writer->pending == 0) && !writer->stop)
+                        pthread_cond_wait(&writer->cond, &writer->mutex);
+                if (writer->pending == 0) break;
+
+                /* Write the pending buffer, while the other one is filled */
+                const double * buffer = writer->buffer[1 - writer->filled];
+                const int size = writer->pending;
+                int rc = writer->status;
+                pthread_mutex_unlock(&writer->mutex);
+                if (rc == 0) rc = writer_dump(writer, buffer, size);
+                pthread_mutex_lock(&writer->mutex);
+
+                writer->status = rc;
+                writer->pending = 0;
+                pthread_cond_broadcast(&writer->cond);
+        }
+        pthread_mutex_unlock(&writer->mutex);
+
+        return NULL;
+}
+#endif
+
+
+/* Hand over the filled buffer to the I/O thread */
+static int writer_submit(struct pumas_event_writer * writer)
+{
+#ifdef _WIN32
+        if ((writer->status == 0) && (writer->size > 0)) {
+                writer->status = writer_dump(
+                    writer, writer->buffer[0], writer->size);
+        }
+        writer->size = 0;
+        return writer->status;
+#else
+        pthread_mutex_lock(&writer->mutex);
+        while (writer->pending > 0)
+                pthread_cond_wait(&writer->cond, &writer->mutex);
+        if (writer->size > 0) {
+                writer->pending = writer->size;
+                writer->filled = 1 - writer->filled;
+                writer->size = 0;
+                pthread_cond_broadcast(&writer->cond);
+        }
+        const int rc = writer->status;
+        pthread_mutex_unlock(&writer->mutex);
+        return rc;
+#endif
+}
+
+
+/* Wait for the I/O thread to complete any pending write */
+static int writer_wait(struct pumas_event_writer * writer)
+{
+#ifdef _WIN32
+        return writer->status;
+#else
+        pthread_mutex_lock(&writer->mutex);
+        while (writer->pending > 0)
+                pthread_cond_wait(&writer->cond, &writer->mutex);
+        const int rc = writer->status;
+        pthread_mutex_unlock(&writer->mutex);
+        return rc;
+#endif
+}
+
+
+struct pumas_event_writer * pumas_event_writer_create(const char * path,
+    int n_fields, const int * fields, int chunk)
+{
+        if ((n_fields <= 0) || (chunk <= 0)) return NULL;
+
+        struct pumas_event_writer * writer = calloc(
+            1, sizeof(*writer) + n_fields * sizeof(*fields));
+        if (writer == NULL) return NULL;
+        writer->n_fields = n_fields;
+        writer->chunk = chunk;
+        memcpy(writer->fields, fields, n_fields * sizeof(*fields));
+
+        int i;
+        for (i = 0; i < 2; i++) {
+                writer->buffer[i] = malloc(
+                    (size_t)n_fields * chunk * sizeof(**writer->buffer));
+                if (writer->buffer[i] == NULL) goto error;
+        }
+
+        /* Write the header */
+        writer->stream = fopen(path, "wb");
+        if (writer->stream == NULL) goto error;
+
+        const int32_t header[3] = {WRITER_VERSION, n_fields, chunk};
+        if (fwrite(WRITER_MAGIC, 1, 8, writer->stream) != 8) goto error;
+        if (fwrite(header, sizeof(*header), 3, writer->stream) != 3)
+                goto error;
+        for (i = 0; i < n_fields; i++) {
+                const int32_t field = fields[i];
+                if (fwrite(&field, sizeof(field), 1, writer->stream) != 1)
+                        goto error;
+        }
+        writer->offset = 8 + (3 + n_fields) * sizeof(int32_t);
+
+#ifndef _WIN32
+        /* Start the I/O thread */
+        pthread_mutex_init(&writer->mutex, NULL);
+        pthread_cond_init(&writer->cond, NULL);
+        if (pthread_create(&writer->thread, NULL, writer_run, writer) != 0) {
+                pthread_cond_destroy(&writer->cond);
+                pthread_mutex_destroy(&writer->mutex);
+                goto error;
+        }
+#endif
+        return writer;
+error:
+        if (writer->stream != NULL) fclose(writer->stream);
+        free(writer->buffer[0]);
+        free(writer->buffer[1]);
+        free(writer);
+        return NULL;
+}
+
+
+int pumas_event_writer_push(struct pumas_event_writer * writer,
+    const struct pumas_state * state, int event, int medium_start,
+    int medium_end)
+{
+        double * column = writer->buffer[writer->filled] + writer->size;
+        int i;
+        for (i = 0; i < writer->n_fields; i++, column += writer->chunk) {
+                const int field = writer->fields[i];
+                switch (field) {
+                        case PUMAS_WRITER_EVENT:
+                                *column = event;
+                                break;
+                        case PUMAS_WRITER_MEDIUM_START:
+                                *column = medium_start;
+                                break;
+                        case PUMAS_WRITER_MEDIUM_END:
+                                *column = medium_end;
+                                break;
+                        default:
+                                *column = tally_field(state, field);
+                }
+        }
+
+        if (++writer->size < writer->chunk) return 0;
+        return writer_submit(writer);
+}
+
+
+int pumas_event_writer_flush(struct pumas_event_writer * writer)
+{
+        writer_submit(writer);
+        if (writer_wait(writer) != 0) return -1;
+        return (fflush(writer->stream) == 0) ? 0 : -1;
+}
+
+
+/* Append the index of chunks and the media names */
+static int writer_index(
+    struct pumas_event_writer * writer, int n_media, const char ** media)
+{
+        FILE * stream = writer->stream;
+        const int n = 2 * writer->n_chunks;
+        if (fwrite(writer->index, sizeof(*writer->index), n, stream) != n)
+                goto error;
+
+        const int32_t n_media_ = n_media;
+        if (fwrite(&n_media_, sizeof(n_media_), 1, stream) != 1) goto error;
+        int i;
+        for (i = 0; i < n_media; i++) {
+                const int32_t length = strlen(media[i]);
+                if (fwrite(&length, sizeof(length), 1, stream) != 1)
+                        goto error;
+                if (fwrite(media[i], 1, length, stream) != length) goto error;
+        }
+
+        const int64_t trailer[2] = {writer->offset, writer->n_chunks};
+        if (fwrite(trailer, sizeof(*trailer), 2, stream) != 2) goto error;
+        if (fwrite(WRITER_INDEX_MAGIC, 1, 8, stream) != 8) goto error;
+        return 0;
+error:
+        writer->status = -1;
+        return -1;
+}
+
+
+int pumas_event_writer_close(struct pumas_event_writer * writer,
+    int n_media, const char ** media)
+{
+        if (writer == NULL) return 0;
+
+        writer_submit(writer);
+#ifndef _WIN32
+        /* Stop the I/O thread, once pending data have been written */
+        pthread_mutex_lock(&writer->mutex);
+        writer->stop = 1;
+        pthread_cond_broadcast(&writer->cond);
+        pthread_mutex_unlock(&writer->mutex);
+        pthread_join(writer->thread, NULL);
+        pthread_cond_destroy(&writer->cond);
+        pthread_mutex_destroy(&writer->mutex);
+#endif
+        if (writer->status == 0) writer_index(writer, n_media, media);
+        if (fclose(writer->stream) != 0) writer->status = -1;
+
+        const int rc = writer->status;
+        free(writer->index);
+        free(writer->buffer[0]);
+        free(writer->buffer[1]);
+        free(writer);
+        return rc;
+}
+
+#undef WRITER_MAGIC
+#undef WRITER_INDEX_MAGIC
+#undef WRITER_VERSION
+
+
+/* NUMA placement of worker processes
+ *
+ * The process is pinned to the CPUs of the given node, and memory allocation
+ * is preferred on this node. Thus, data loaded afterwards (e.g. physics tables,
+ * flux tabulations or topography tiles) are placed locally. Only Linux is
+ * supported, using sysfs and raw system calls.
+ */
+#define NUMA_SYSFS "/sys/devices/system/node"
+#define NUMA_MPOL_PREFERRED 1
+
+int pumas_numa_length(void)
+{
+#ifdef __linux__
+        int n = 0;
+        for (;;) {
+                char path[64];
+                sprintf(path, NUMA_SYSFS "/node%d", n);
+                if (access(path, F_OK) != 0) break;
+                n++;
+        }
+        return n;
+#else
+        return 0;
+#endif
+}
+
+
+int pumas_numa_bind(int node)
+{
+#ifdef __linux__
+        if (node < 0) return -1;
+        char path[64];
+        sprintf(path, NUMA_SYSFS "/node%d/cpulist", node);
+        FILE * stream = fopen(path, "r");
+        if (stream == NULL) return -1;
+
+        /* Parse the CPU list, e.g. "0-63,128-191" */
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        int n_cpus = 0, first;
+        while (fscanf(stream, "%d", &first) == 1) {
+                int last = first;
+                int c = fgetc(stream);
+                if (c == '-') {
+                        if (fscanf(stream, "%d", &last) != 1) break;
+                        c = fgetc(stream);
+                }
+                for (; (first <= last) && (first < CPU_SETSIZE); first++) {
+                        CPU_SET(first, &set);
+                        n_cpus++;
+                }
+                if (c != ',') break;
+        }
+        fclose(stream);
+        if (n_cpus == 0) return -1;
+
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) return -1;
+
+#ifdef SYS_set_mempolicy
+        /* Prefer allocations on the local node. Failures are not critical
+         * since the default policy allocates on the node of the running CPU
+         */
+        unsigned long mask[16] = {0};
+        const int bits = 8 * sizeof(*mask);
+        if (node < 16 * bits) {
+                mask[node / bits] = 1UL << (node % bits);
+                syscall(SYS_set_mempolicy, NUMA_MPOL_PREFERRED, mask,
+                    16 * bits);
+        }
+#endif
+        return 0;
+#else
+        return -1;
+#endif
+}
+
+#undef NUMA_SYSFS
+#undef NUMA_MPOL_PREFERRED
+
+
+/* Native sampling profiler
+ *
+ * The C call stacks are sampled on the user CPU time, using the virtual
+ * interval timer. Note that the profiling timer is left to the LuaJIT
+ * profiler, such that both can run simultaneously. The raw return addresses
+ * are recorded by the signal handler and resolved afterwards, using the
+ * dynamic symbols. Only POSIX systems are supported.
+ */
+#define PROFILE_DEPTH 32
+#define PROFILE_SKIP 2 /* The signal handler and the signal trampoline */
+
+#ifndef _WIN32
+static struct {
+        void ** frames;
+        int * depths;
+        int size;
+        volatile int count;
+        struct sigaction action;
+} profile = {NULL, NULL, 0, 0};
+
+static void profile_handler(int signum)
+{
+        const int index = __sync_fetch_and_add(&profile.count, 1);
+        if (index >= profile.size) {
+                profile.count = profile.size;
+                return;
+        }
+        profile.depths[index] = backtrace(
+            profile.frames + index * PROFILE_DEPTH, PROFILE_DEPTH);
+}
+#endif
+
+
+int pumas_profile_start(int size, double interval)
+{
+#ifndef _WIN32
+        if ((size <= 0) || (interval <= 0)) return -1;
+        pumas_profile_stop();
+
+        free(profile.frames);
+        free(profile.depths);
+        profile.frames = malloc(size * PROFILE_DEPTH * sizeof(*profile.frames));
+        profile.depths = malloc(size * sizeof(*profile.depths));
+        if ((profile.frames == NULL) || (profile.depths == NULL)) {
+                free(profile.frames);
+                free(profile.depths);
+                profile.frames = NULL;
+                profile.depths = NULL;
+                return -1;
+        }
+        profile.size = size;
+        profile.count = 0;
+
+        /* The first call to backtrace might allocate memory, which is not
+         * safe from a signal handler
+         */
+        void * dummy[1];
+        backtrace(dummy, 1);
+
+        struct sigaction action;
+        memset(&action, 0x0, sizeof(action));
+        action.sa_handler = profile_handler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGVTALRM, &action, &profile.action) != 0) return -1;
+
+        struct itimerval timer;
+        timer.it_interval.tv_sec = (time_t)interval;
+        timer.it_interval.tv_usec =
+            (suseconds_t)((interval - timer.it_interval.tv_sec) * 1E+06);
+        if ((timer.it_interval.tv_sec == 0) &&
+            (timer.it_interval.tv_usec == 0))
+                timer.it_interval.tv_usec = 1;
+        timer.it_value = timer.it_interval;
+        if (setitimer(ITIMER_VIRTUAL, &timer, NULL) != 0) {
+                sigaction(SIGVTALRM, &profile.action, NULL);
+                return -1;
+        }
+        return 0;
+#else
+        return -1;
+#endif
+}
+
+
+int pumas_profile_stop(void)
+{
+#ifndef _WIN32
+        if (profile.frames == NULL) return 0;
+
+        struct itimerval timer;
+        memset(&timer, 0x0, sizeof(timer));
+        if (setitimer(ITIMER_VIRTUAL, &timer, NULL) == 0)
+                sigaction(SIGVTALRM, &profile.action, NULL);
+        return (profile.count < profile.size) ? profile.count : profile.size;
+#else
+        return 0;
+#endif
+}
+
+
+int pumas_profile_stack(int index, const char ** symbols, int depth)
+{
+#ifndef _WIN32
+        if ((index < 0) || (index >= profile.count) ||
+            (index >= profile.size)) return 0;
+
+        void ** frames = profile.frames + index * PROFILE_DEPTH;
+        const int n = profile.depths[index] - PROFILE_SKIP;
+        int i;
+        for (i = 0; (i < n) && (i < depth); i++) {
+                /* Unresolved symbols, e.g. static functions or JIT traces,
+                 * are given by the name of their module, if any
+                 */
+                Dl_info info;
+                if (dladdr(frames[i + PROFILE_SKIP], &info) == 0) {
+                        symbols[i] = NULL;
+                } else if (info.dli_sname != NULL) {
+                        symbols[i] = info.dli_sname;
+                } else if (info.dli_fname != NULL) {
+                        const char * name = strrchr(info.dli_fname, '/');
+                        symbols[i] = (name != NULL) ? name + 1 :
+                            info.dli_fname;
+                } else {
+                        symbols[i] = NULL;
+                }
+        }
+        return i;
+#else
+        return 0;
+#endif
+}
+
+#undef PROFILE_DEPTH
+#undef PROFILE_SKIP
+
+
+static double add_global_magnet(struct pumas_state * state,
+    struct pumas_locals * locals)
+{
+        struct pumas_state_extended * extended = (void *)state;
+        struct pumas_context * context = extended->context;
+        struct pumas_user_data * user_data = context->user_data;
+        struct pumas_geometry * geometry = user_data->current;
+        if (geometry->magnet == NULL)
+                return 0;
+
+        double magnet[3];
+        const double s = geometry->magnet(geometry, state, magnet);
+
+        int i;
+        for (i = 0; i < 3; i++)
+                locals->magnet[i] += magnet[i];
+
+        return s;
+}
+
+
+/* Uniform medium */
+static double uniform_locals(struct pumas_medium * medium,
+    struct pumas_state * state, struct pumas_locals * locals)
+{
+        struct pumas_medium_uniform * uniform =
+            (struct pumas_medium_uniform *)medium;
+        memcpy(locals, &uniform->locals, sizeof *locals);
+
+        /* Look for a global magnetic field */
+        return add_global_magnet(state, locals);
+}
+
+
+void pumas_medium_uniform_initialise(struct pumas_medium_uniform * uniform,
+    int material, double density, const double * magnet)
+{
+        uniform->medium.material = material;
+        uniform->medium.locals = &uniform_locals;
+        uniform->locals.density = density;
+        if (magnet != NULL) {
+                memcpy(uniform->locals.magnet, magnet,
+                    sizeof uniform->locals.magnet);
+        } else {
+                memset(uniform->locals.magnet, 0x0,
+                    sizeof uniform->locals.magnet);
+        }
+}
+
+
+/* Medium with a density gradient */
+double pumas_medium_gradient_density(
+    struct pumas_medium_gradient * medium, struct pumas_state_extended * state)
+{
+        /* Project onto the gradient axis */
+        const double * const u = medium->gradient.axis;
+        double z;
+        if (medium->gradient.project != NULL) {
+                z = medium->gradient.project(medium, state);
+        } else {
+                const double * const r = state->base.position;
+                z = r[0] * u[0] + r[1] * u[1] + r[2] * u[2];
+        }
+
+        /* Compute the density */
+        if (medium->gradient.type == PUMAS_MEDIUM_GRADIENT_LINEAR) {
+                return (1. + (z - medium->gradient.z0) /
+                    medium->gradient.lambda) * medium->gradient.rho0;
+        } else {
+                return medium->gradient.rho0 *
+                    exp((z - medium->gradient.z0) / medium->gradient.lambda);
+        }
+}
+
+
+static double gradient_locals(struct pumas_medium * medium_,
+    struct pumas_state * state, struct pumas_locals * locals)
+{
+#define GRADIENT_MIN_PROJECTION 5E-02
+#define GRADIENT_RESOLUTION 1E-02
+
+        /* Set the magnetic field */
+        struct pumas_medium_gradient * medium = (void *)medium_;
+        memcpy(locals->magnet, medium->magnet, sizeof locals->magnet);
+        double step = add_global_magnet(state, locals);
+
+        /* Compute the density and the gradient length */
+        locals->density = pumas_medium_gradient_density(medium, (void *)state);
+
+        /* Compute the gradient length */
+        const double * const u = medium->gradient.axis;
+        const double * const v = state->direction;
+        double d = fabs(u[0] * v[0] + u[1] * v[1] + u[2] * v[2]);
+        if (d < GRADIENT_MIN_PROJECTION)
+                d = GRADIENT_MIN_PROJECTION;
+
+        const double step2 =
+            fabs(medium->gradient.lambda / d) * GRADIENT_RESOLUTION;
+        if (step <= 0) return step2;
+        else return (step < step2) ? step: step2;
+}
+
+
+void pumas_medium_gradient_initialise(
+    struct pumas_medium_gradient * medium, int material,
+    enum pumas_medium_gradient_type type, double lambda, double z0,
+    double rho0, const double * magnet)
+{
+        medium->medium.material = material;
+        medium->medium.locals = &gradient_locals;
+
+        medium->gradient.type = type;
+        medium->gradient.lambda = lambda;
+        medium->gradient.z0 = z0;
+        medium->gradient.rho0 = rho0;
+
+        medium->gradient.project = NULL;
+        memset(medium->gradient.axis, 0x0,
+            sizeof medium->gradient.axis);
+
+        if (magnet != NULL)
+                memcpy(medium->magnet, magnet, sizeof medium->magnet);
+        else
+                memset(medium->magnet, 0x0, sizeof medium->magnet);
+
+#undef GRADIENT_MIN_PROJECTION
+#undef GRADIENT_RESOLUTION
+}
+
+
+double pumas_medium_gradient_project_altitude(
+    struct pumas_medium_gradient * medium,
+    struct pumas_state_extended * state)
+{
+#define VERTICAL_UPDATE_DISTANCE 1E+03
+
+        if (!state->geodetic.computed) {
+                turtle_ecef_to_geodetic(state->base.position,
+                                        &state->geodetic.latitude,
+                                        &state->geodetic.longitude,
+                                        &state->geodetic.altitude);
+                state->geodetic.computed = 1;
+        }
+
+        if (state->base.distance >= state->vertical.distance) {
+                turtle_ecef_from_horizontal(state->geodetic.latitude,
+                                            state->geodetic.longitude, 0, 90,
+                                            state->vertical.last);
+                state->vertical.distance = state->base.distance +
+                    VERTICAL_UPDATE_DISTANCE;
+        }
+        memcpy(medium->gradient.axis, state->vertical.last,
+               sizeof medium->gradient.axis);
+
+        return state->geodetic.altitude;
+
+#undef VERTICAL_UPDATE_DISTANCE
+}
+
+
+void pumas_geometry_infinite_get(struct pumas_geometry * base_geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+        if (medium_p != NULL) {
                 struct pumas_geometry_infinite * geometry =
                     (void *)base_geometry;
                 *medium_p = geometry->medium;
         }
 
-        if (step_p != NULL) *step_p = 0;
+        if (step_p != NULL) *step_p = 0;
+}
+
+
+void pumas_geometry_earth_get(struct pumas_geometry * base_geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+        struct pumas_geometry_earth * earth = (void *)base_geometry;
+        struct pumas_state_extended * extended = (void *)state;
+        double elevation[2];
+        int index[2];
+
+        turtle_stepper_step(*earth->stepper, state->position, NULL,
+            &extended->geodetic.latitude, &extended->geodetic.longitude,
+            &extended->geodetic.altitude, elevation, step_p, index);
+        extended->geodetic.computed = 1;
+
+        if (medium_p != NULL) {
+                if ((index[0] >= 0) && (earth->media != NULL)) {
+                        if (earth->n_layers > 1) {
+                                *medium_p = ((index[0] < earth->n_layers) &&
+                                    (elevation[1] != DBL_MAX)) ?
+                                    earth->media[index[0]] : NULL;
+                        } else {
+                                *medium_p = (extended->geodetic.altitude <
+                                             elevation[0]) ?
+                                    earth->media[0] :
+                                    NULL;
+                        }
+                } else {
+                        *medium_p = NULL;
+                }
+        }
+}
+
+
+/* Distance to the next flat layer, modelled as an ellipsoid shell */
+static double flat_distance(const double * r, const double * u,
+    double altitude, double step_min)
+{
+#define WGS84_A 6378137.0
+#define WGS84_B 6356752.314245
+
+        const double a2 = 1. / ((WGS84_A + altitude) * (WGS84_A + altitude));
+        const double b2 = 1. / ((WGS84_B + altitude) * (WGS84_B + altitude));
+
+        const double alpha = (u[0] * u[0] + u[1] * u[1]) * a2 +
+                             u[2] * u[2] * b2;
+        const double beta = (r[0] * u[0] + r[1] * u[1]) * a2 +
+                            r[2] * u[2] * b2;
+        const double gamma = (r[0] * r[0] + r[1] * r[1]) * a2 +
+                             r[2] * r[2] * b2 - 1.;
+
+        const double delta = beta * beta - alpha * gamma;
+        if ((delta <= 0.) || (alpha <= 0.)) return -1.;
+        const double sqrt_delta = sqrt(delta);
+
+        /* Solve for the smallest root beyond the minimum step */
+        const double t0 = (beta > 0) ? -(beta + sqrt_delta) / alpha :
+                                       gamma / (sqrt_delta - beta);
+        const double t1 = (t0 != 0.) ? gamma / (alpha * t0) :
+                                       -2. * beta / alpha;
+        const double tmin = (t0 < t1) ? t0 : t1;
+        const double tmax = (t0 < t1) ? t1 : t0;
+        if (tmin > step_min) return tmin;
+        else if (tmax > step_min) return tmax;
+        else return -1.;
+
+#undef WGS84_A
+#undef WGS84_B
+}
+
+
+/* Index of the flat layer containing the given position */
+static int flat_index(const struct pumas_geometry_earth * earth,
+    const double * r)
+{
+#define WGS84_A 6378137.0
+#define WGS84_B 6356752.314245
+
+        const double rho2 = r[0] * r[0] + r[1] * r[1];
+        const double z2 = r[2] * r[2];
+        int i;
+        for (i = 0; i < earth->n_layers; i++) {
+                const double a = WGS84_A + earth->flat[i];
+                const double b = WGS84_B + earth->flat[i];
+                if (rho2 / (a * a) + z2 / (b * b) < 1.) return i;
+        }
+        return -1;
+
+#undef WGS84_A
+#undef WGS84_B
+}
+
+
+void pumas_geometry_earth_flat_get(struct pumas_geometry * base_geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+#define STEP_MIN 1E-06
+
+        struct pumas_geometry_earth * earth = (void *)base_geometry;
+        struct pumas_state_extended * extended = (void *)state;
+        const double sgn =
+            (extended->context->mode.direction == PUMAS_MODE_FORWARD)? 1 : -1;
+        const double direction[3] = {sgn * state->direction[0],
+                                     sgn * state->direction[1],
+                                     sgn * state->direction[2]};
+
+        if (medium_p != NULL) {
+                /* Locate the position slightly ahead, in order to resolve
+                 * boundaries when the particle lies on a layer surface
+                 */
+                const double * const r = state->position;
+                const double r1[3] = {r[0] + STEP_MIN * direction[0],
+                                      r[1] + STEP_MIN * direction[1],
+                                      r[2] + STEP_MIN * direction[2]};
+                const int index = flat_index(earth, r1);
+                *medium_p = ((index >= 0) && (earth->media != NULL)) ?
+                    earth->media[index] : NULL;
+        }
+
+        if (step_p != NULL) {
+                double step = 0.;
+                int i;
+                for (i = 0; i < earth->n_layers; i++) {
+                        const double d = flat_distance(state->position,
+                            direction, earth->flat[i], STEP_MIN);
+                        if ((d > 0.) && ((step == 0.) || (d < step)))
+                                step = d;
+                }
+                *step_p = step;
+        }
+
+#undef STEP_MIN
+}
+
+
+double pumas_geometry_earth_magnet(struct pumas_geometry * base_geometry,
+    struct pumas_state * state, double * magnet)
+{
+#define GEOMAGNET_UPDATE_DISTANCE 1E+03
+        struct pumas_geometry_earth * earth = (void *)base_geometry;
+
+        if (state->distance < earth->magnet.distance) {
+                memcpy(magnet, earth->magnet.last, sizeof earth->magnet.last);
+        } else {
+                /* Get geodetic coordinates */
+                struct pumas_geodetic_point geodetic_position;
+                turtle_ecef_to_geodetic(state->position,
+                    &geodetic_position.latitude, &geodetic_position.longitude,
+                    &geodetic_position.altitude);
+
+                /* Get the local frame */
+                struct pumas_coordinates_unitary_transformation frame;
+                struct pumas_cartesian_point ecef_position = {
+                    state->position[0], state->position[1], state->position[2]};
+                pumas_coordinates_frame_initialise_local(&frame, &ecef_position,
+                    &geodetic_position, 0, 0);
+
+                /* Get the local magnetic field (ENU frame) */
+                struct pumas_cartesian_vector magnet_enu = {.frame = &frame};
+                gull_snapshot_field(*earth->magnet.snapshot,
+                    geodetic_position.latitude, geodetic_position.longitude,
+                    geodetic_position.altitude, (double *)(&magnet_enu),
+                    earth->magnet.workspace);
+
+                /* Transform back to ECEF */
+                pumas_coordinates_cartesian_vector_transform(
+                    &magnet_enu, NULL);
+
+                /* Update the magnet and its history */
+                memcpy(&earth->magnet.last, &magnet_enu,
+                    sizeof earth->magnet.last);
+                memcpy(magnet, &magnet_enu, sizeof earth->magnet.last);
+                earth->magnet.distance = state->distance +
+                                         GEOMAGNET_UPDATE_DISTANCE;
+        }
+
+        return GEOMAGNET_UPDATE_DISTANCE;
+
+#undef GEOMAGNET_UPDATE_DISTANCE
+}
+
+
+void pumas_geometry_earth_reset(struct pumas_geometry * base_geometry)
+{
+        struct pumas_geometry_earth * earth = (void *)base_geometry;
+        earth->magnet.distance = -1;
+        memset(earth->magnet.last, 0x0, sizeof earth->magnet.last);
+}
+
+
+void pumas_geometry_earth_destroy(struct pumas_geometry * base_geometry)
+{
+        struct pumas_geometry_earth * earth = (void *)base_geometry;
+        if (*earth->stepper != NULL) turtle_stepper_destroy(earth->stepper);
+        free(earth->flat);
+        free(*earth->magnet.workspace);
+        *earth->magnet.workspace = NULL;
+        gull_snapshot_destroy(earth->magnet.snapshot);
+        free(base_geometry);
+}
+
+
+/* Create a snapshot of the geomagnetic field from data in memory
+ *
+ * GULL only reads snapshots from files. On Linux, the data are written to an
+ * anonymous memory file which is read back through procfs. Thus, no temporary
+ * file is created on disk.
+ */
+enum gull_return pumas_geometry_earth_snapshot_create(
+    struct gull_snapshot ** snapshot, const char * data, long size, int day,
+    int month, int year)
+{
+#ifdef __linux__
+        const int fd = syscall(SYS_memfd_create, "pumas_igrf", 0);
+        if (fd < 0) {
+                forward_error(GULL_RETURN_PATH_ERROR, NULL,
+                    "{ 5, pumas_geometry_earth_snapshot_create, memfd } "
+                    "could not create memory file");
+                return GULL_RETURN_PATH_ERROR;
+        }
+
+        long offset;
+        for (offset = 0; offset < size;) {
+                const ssize_t n = write(fd, data + offset, size - offset);
+                if (n <= 0) {
+                        close(fd);
+                        forward_error(GULL_RETURN_PATH_ERROR, NULL,
+                            "{ 5, pumas_geometry_earth_snapshot_create, "
+                            "memfd } could not write memory file");
+                        return GULL_RETURN_PATH_ERROR;
+                }
+                offset += n;
+        }
+
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+        const enum gull_return rc = gull_snapshot_create(
+            snapshot, path, day, month, year);
+        close(fd);
+        return rc;
+#else
+        forward_error(GULL_RETURN_PATH_ERROR, NULL,
+            "{ 5, pumas_geometry_earth_snapshot_create, memfd } "
+            "not supported on this OS");
+        return GULL_RETURN_PATH_ERROR;
+#endif
+}
+
+
+void pumas_geometry_polyhedron_get(struct pumas_geometry * geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+#define STEP_MIN 1E-05
+
+        struct pumas_geometry_polyhedron * p = (void *)geometry;
+        const double * const position = state->position;
+
+        struct pumas_state_extended * extended = (void *)state;
+        const double sgn =
+            (extended->context->mode.direction == PUMAS_MODE_FORWARD)? 1 : -1;
+        const double direction[3] = {sgn * state->direction[0],
+                                     sgn * state->direction[1],
+                                     sgn * state->direction[2]};
+
+        double dE = -DBL_MAX, dL = DBL_MAX;
+        int i, inside = 1;
+        struct pumas_polyhedron_face * s;
+        for (i = 0, s = p->faces; i < p->n_faces; i++, s++) {
+                const double rn = (position[0] - s->origin[0]) * s->normal[0] +
+                    (position[1] - s->origin[1]) * s->normal[1] +
+                    (position[2] - s->origin[2]) * s->normal[2];
+                if (rn > 0) inside = 0;
+                const double un = direction[0] * s->normal[0] +
+                    direction[1] * s->normal[1] + direction[2] * s->normal[2];
+                if (fabs(un) <= FLT_EPSILON) continue;
+                const double d = (rn == 0) ? 0 : -rn / un;
+                if ((un > 0) && (d < dL))
+                        dL = d;
+                else if ((un < 0.) && (d > dE))
+                        dE = d;
+        }
+
+        double step;
+        struct pumas_medium * medium;
+        if (inside && (dL > 0)) {
+                step = (dL > STEP_MIN) ? dL : STEP_MIN;
+                medium = p->medium;
+        } else if (!inside && (dE > 0)) {
+                step = (dE > STEP_MIN) ? dE : STEP_MIN;
+                medium = NULL;
+        } else {
+                step = DBL_MAX;
+                medium = (dL == 0) ? p->medium : NULL;
+        }
+
+        if (step_p != NULL) *step_p = step;
+        if (medium_p != NULL) *medium_p = medium;
+
+#undef STEP_MIN
+}
+
+
+/* Run jobs over threads, the first one being run by the caller
+ *
+ * Jobs that could not be started as a thread are run sequentially by the
+ * caller as well. On Windows all jobs are run by the caller.
+ */
+#define THREADS_MAX 64
+
+static int threads_count(int requested, int n)
+{
+        int n_threads = requested;
+        if (n_threads <= 0) {
+#ifndef _WIN32
+                const long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+                n_threads = (n_cpus > 1) ? (int)n_cpus : 1;
+#else
+                n_threads = 1;
+#endif
+        }
+        if (n_threads > n) n_threads = n;
+        if (n_threads > THREADS_MAX) n_threads = THREADS_MAX;
+        return (n_threads > 0) ? n_threads : 1;
+}
+
+
+static void threads_run(int n_threads, void * (*run)(void *), void * jobs,
+    size_t size)
+{
+        char * job = jobs;
+#ifndef _WIN32
+        pthread_t threads[THREADS_MAX];
+        int i, n_started = 0;
+        for (i = 1; i < n_threads; i++) {
+                if (pthread_create(threads + i, NULL, run, job + i * size)
+                    != 0) break;
+                n_started++;
+        }
+        for (; i < n_threads; i++) run(job + i * size);
+        run(job);
+        for (i = 1; i <= n_started; i++) pthread_join(threads[i], NULL);
+#else
+        int i;
+        for (i = 0; i < n_threads; i++) run(job + i * size);
+#endif
 }
 
 
-void pumas_geometry_earth_get(struct pumas_geometry * base_geometry,
-    struct pumas_state * state, struct pumas_medium ** medium_p,
-    double * step_p)
+/* Polygonal faces of convex polyhedrons
+ *
+ * Each face is initialised as a large square lying on its plane, and then it
+ * is clipped by the half spaces of all other faces. Redundant faces result in
+ * empty polygons. This is O(n^2) per polyhedron, without any allocation in the
+ * inner loop, and it is robust to vertices shared by more than three faces.
+ */
+#define POLYGON_SIZE 1E+09
+#define POLYGON_EPSILON 1E-07
+
+static int polygon_clip(int n, double (*vertices)[3], double (*clipped)[3],
+    const struct pumas_polyhedron_face * face)
 {
-        struct pumas_geometry_earth * earth = (void *)base_geometry;
-        struct pumas_state_extended * extended = (void *)state;
-        double elevation[2];
-        int index[2];
+        int i, m = 0;
+        const double * o = face->origin;
+        const double * u = face->normal;
+        for (i = 0; i < n; i++) {
+                const double * a = vertices[i];
+                const double * b = vertices[(i + 1) % n];
+                const double sa = (a[0] - o[0]) * u[0] +
+                    (a[1] - o[1]) * u[1] + (a[2] - o[2]) * u[2];
+                const double sb = (b[0] - o[0]) * u[0] +
+                    (b[1] - o[1]) * u[1] + (b[2] - o[2]) * u[2];
+                const int ina = (sa <= POLYGON_EPSILON);
+                const int inb = (sb <= POLYGON_EPSILON);
+                if (ina) memcpy(clipped[m++], a, sizeof(*clipped));
+                if (ina != inb) {
+                        const double t = sa / (sa - sb);
+                        int k;
+                        for (k = 0; k < 3; k++)
+                                clipped[m][k] = a[k] + t * (b[k] - a[k]);
+                        m++;
+                }
+        }
+        return m;
+}
 
-        turtle_stepper_step(*earth->stepper, state->position, NULL,
-            &extended->geodetic.latitude, &extended->geodetic.longitude,
-            &extended->geodetic.altitude, elevation, step_p, index);
-        extended->geodetic.computed = 1;
 
-        if (medium_p != NULL) {
-                if ((index[0] >= 0) && (earth->media != NULL)) {
-                        if (earth->n_layers > 1) {
-                                *medium_p = ((index[0] < earth->n_layers) &&
-                                    (elevation[1] != DBL_MAX)) ?
-                                    earth->media[index[0]] : NULL;
-                        } else {
-                                *medium_p = (extended->geodetic.altitude <
-                                             elevation[0]) ?
-                                    earth->media[0] :
-                                    NULL;
+static int polyhedron_polygons(
+    const struct pumas_geometry_polyhedron * polyhedron,
+    struct pumas_polyhedron_polygons * polygons)
+{
+        memset(polygons, 0x0, sizeof(*polygons));
+        const int n_faces = polyhedron->n_faces;
+        if (n_faces <= 0) return 0;
+
+        /* A polygon gains at most one vertex per clipping */
+        const int size_max = n_faces + 4;
+        double (*work)[3] = malloc(2 * size_max * sizeof(*work));
+        polygons->faces = malloc(n_faces * sizeof(*polygons->faces));
+        polygons->sizes = malloc(n_faces * sizeof(*polygons->sizes));
+        if ((work == NULL) || (polygons->faces == NULL) ||
+            (polygons->sizes == NULL)) goto error;
+        int capacity = 0;
+
+        int i;
+        for (i = 0; i < n_faces; i++) {
+                const struct pumas_polyhedron_face * face =
+                    polyhedron->faces + i;
+
+                /* Orthonormal basis of the face, with u x v = normal */
+                const double * n = face->normal;
+                const double norm = sqrt(n[0] * n[0] + n[1] * n[1] +
+                    n[2] * n[2]);
+                if (norm <= 0) continue;
+                const double w[3] = {n[0] / norm, n[1] / norm, n[2] / norm};
+                double u[3];
+                if (fabs(w[0]) < 0.5) {
+                        u[0] = 0;
+                        u[1] = w[2];
+                        u[2] = -w[1];
+                } else {
+                        u[0] = -w[2];
+                        u[1] = 0;
+                        u[2] = w[0];
+                }
+                const double nu = 1 / sqrt(u[0] * u[0] + u[1] * u[1] +
+                    u[2] * u[2]);
+                u[0] *= nu;
+                u[1] *= nu;
+                u[2] *= nu;
+                const double v[3] = {w[1] * u[2] - w[2] * u[1],
+                                     w[2] * u[0] - w[0] * u[2],
+                                     w[0] * u[1] - w[1] * u[0]};
+
+                /* Clip a large square by all other faces */
+                double (*polygon)[3] = work;
+                double (*clipped)[3] = work + size_max;
+                const double corners[4][2] = {
+                    {-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+                int j, k, m = 4;
+                for (j = 0; j < 4; j++) {
+                        for (k = 0; k < 3; k++) {
+                                polygon[j][k] = face->origin[k] +
+                                    POLYGON_SIZE * (corners[j][0] * u[k] +
+                                    corners[j][1] * v[k]);
+                        }
+                }
+                for (j = 0; (j < n_faces) && (m >= 3); j++) {
+                        if (j == i) continue;
+                        m = polygon_clip(
+                            m, polygon, clipped, polyhedron->faces + j);
+                        double (*tmp)[3] = polygon;
+                        polygon = clipped;
+                        clipped = tmp;
+                }
+
+                /* Merge duplicated vertices */
+                int l = 0;
+                for (j = 0; j < m; j++) {
+                        const double * a = polygon[j];
+                        const double * b = (l > 0) ? polygon[l - 1] :
+                                                     polygon[m - 1];
+                        if ((l > 0) || (j < m - 1)) {
+                                if ((fabs(a[0] - b[0]) <= POLYGON_EPSILON) &&
+                                    (fabs(a[1] - b[1]) <= POLYGON_EPSILON) &&
+                                    (fabs(a[2] - b[2]) <= POLYGON_EPSILON))
+                                        continue;
+                        }
+                        if (l != j) memcpy(polygon[l], a, sizeof(*polygon));
+                        l++;
+                }
+                if (l < 3) continue;
+
+                /* Append the polygon */
+                if (polygons->n_vertices + l > capacity) {
+                        capacity = 2 * (polygons->n_vertices + l);
+                        double * tmp = realloc(polygons->vertices,
+                            3 * capacity * sizeof(*tmp));
+                        if (tmp == NULL) goto error;
+                        polygons->vertices = tmp;
+                }
+                memcpy(polygons->vertices + 3 * polygons->n_vertices,
+                    polygon, l * sizeof(*polygon));
+                polygons->faces[polygons->n_polygons] = i;
+                polygons->sizes[polygons->n_polygons] = l;
+                polygons->n_polygons++;
+                polygons->n_vertices += l;
+        }
+
+        free(work);
+        return 0;
+error:
+        free(work);
+        pumas_polyhedron_polygons_clear(1, polygons);
+        return -1;
+}
+
+#undef POLYGON_SIZE
+#undef POLYGON_EPSILON
+
+
+struct polygons_job {
+        int n;
+        struct pumas_geometry_polyhedron ** polyhedrons;
+        struct pumas_polyhedron_polygons * polygons;
+        int start;
+        int stride;
+        int status;
+};
+
+
+static void * polygons_run(void * arg)
+{
+        struct polygons_job * job = arg;
+        int i;
+        for (i = job->start; i < job->n; i += job->stride) {
+                if (polyhedron_polygons(
+                    job->polyhedrons[i], job->polygons + i) != 0) {
+                        job->status = -1;
+                        break;
+                }
+        }
+        return NULL;
+}
+
+
+int pumas_polyhedron_polygons(int n,
+    struct pumas_geometry_polyhedron ** polyhedrons,
+    struct pumas_polyhedron_polygons * polygons)
+{
+        if (n <= 0) return 0;
+        memset(polygons, 0x0, n * sizeof(*polygons));
+
+        /* Share the polyhedrons over threads, one per CPU */
+        const int n_threads = threads_count(0, n);
+        struct polygons_job jobs[THREADS_MAX];
+        int i;
+        for (i = 0; i < n_threads; i++) {
+                struct polygons_job * job = jobs + i;
+                job->n = n;
+                job->polyhedrons = polyhedrons;
+                job->polygons = polygons;
+                job->start = i;
+                job->stride = n_threads;
+                job->status = 0;
+        }
+        threads_run(n_threads, polygons_run, jobs, sizeof(*jobs));
+
+        for (i = 0; i < n_threads; i++) {
+                if (jobs[i].status != 0) {
+                        pumas_polyhedron_polygons_clear(n, polygons);
+                        return -1;
+                }
+        }
+        return 0;
+}
+
+
+void pumas_polyhedron_polygons_clear(int n,
+    struct pumas_polyhedron_polygons * polygons)
+{
+        int i;
+        for (i = 0; i < n; i++) {
+                free(polygons[i].faces);
+                free(polygons[i].sizes);
+                free(polygons[i].vertices);
+                memset(polygons + i, 0x0, sizeof(*polygons));
+        }
+}
+
+
+/* Triangle mesh geometry
+ *
+ * The triangles are stored in a flat array, sorted according to a Bounding
+ * Volume Hierarchy (BVH) built with the Surface Area Heuristic (SAH). The BVH
+ * nodes are stored in depth first order, i.e. the left child of an interior
+ * node immediately follows its parent.
+ */
+#define MESH_BINS 16
+#define MESH_LEAF_SIZE 4
+#define MESH_DEPTH_MAX 64
+
+struct mesh_node {
+        double lower[3];
+        double upper[3];
+        int offset; /* First triangle of a leaf, or index of the right child */
+        int count; /* Number of triangles of a leaf, or 0 */
+        int axis; /* Split axis of an interior node */
+};
+
+struct pumas_mesh {
+        int n_triangles;
+        int n_nodes;
+        double * vertices; /* 9 values per triangle */
+        struct mesh_node * nodes;
+};
+
+struct mesh_build {
+        const double * vertices;
+        double * bounds; /* 6 values per triangle: lower and upper corners */
+        double * centroids;
+        int * index;
+        struct mesh_node * nodes;
+        int n_nodes;
+};
+
+
+static double mesh_box_area(const double * lower, const double * upper)
+{
+        const double dx = upper[0] - lower[0];
+        const double dy = upper[1] - lower[1];
+        const double dz = upper[2] - lower[2];
+        return dx * dy + dy * dz + dz * dx;
+}
+
+
+static void mesh_box_reset(double * lower, double * upper)
+{
+        int k;
+        for (k = 0; k < 3; k++) {
+                lower[k] = DBL_MAX;
+                upper[k] = -DBL_MAX;
+        }
+}
+
+
+static void mesh_box_extend(double * lower, double * upper,
+    const double * other_lower, const double * other_upper)
+{
+        int k;
+        for (k = 0; k < 3; k++) {
+                if (other_lower[k] < lower[k]) lower[k] = other_lower[k];
+                if (other_upper[k] > upper[k]) upper[k] = other_upper[k];
+        }
+}
+
+
+static int mesh_bin(const double * centroid, int axis, const double * lower,
+    double scale)
+{
+        const int bin = (int)((centroid[axis] - lower[axis]) * scale);
+        return (bin < MESH_BINS) ? bin : MESH_BINS - 1;
+}
+
+
+static void mesh_build_node(struct mesh_build * build, int node_index,
+    int start, int count, int depth)
+{
+        struct mesh_node * node = build->nodes + node_index;
+
+        /* Bounding boxes of the triangles and of their centroids */
+        double clower[3], cupper[3];
+        mesh_box_reset(node->lower, node->upper);
+        mesh_box_reset(clower, cupper);
+        int i;
+        for (i = start; i < start + count; i++) {
+                const int j = build->index[i];
+                const double * b = build->bounds + 6 * j;
+                const double * c = build->centroids + 3 * j;
+                mesh_box_extend(node->lower, node->upper, b, b + 3);
+                mesh_box_extend(clower, cupper, c, c);
+        }
+        node->offset = start;
+        node->count = count;
+        node->axis = 0;
+        if ((count <= MESH_LEAF_SIZE) || (depth >= MESH_DEPTH_MAX)) return;
+
+        /* Find the best split over binned centroids (SAH) */
+        const double area = mesh_box_area(node->lower, node->upper);
+        double best_cost = count;
+        int best_axis = -1, best_bin = 0;
+        int axis;
+        for (axis = 0; axis < 3; axis++) {
+                const double extent = cupper[axis] - clower[axis];
+                if (extent <= 0) continue;
+                const double scale = MESH_BINS / extent;
+
+                int n[MESH_BINS] = {0};
+                double lower[MESH_BINS][3], upper[MESH_BINS][3];
+                int k;
+                for (k = 0; k < MESH_BINS; k++)
+                        mesh_box_reset(lower[k], upper[k]);
+                for (i = start; i < start + count; i++) {
+                        const int j = build->index[i];
+                        const double * b = build->bounds + 6 * j;
+                        k = mesh_bin(build->centroids + 3 * j, axis, clower,
+                            scale);
+                        n[k]++;
+                        mesh_box_extend(lower[k], upper[k], b, b + 3);
+                }
+
+                /* Sweep from the left, then from the right */
+                double left_area[MESH_BINS - 1];
+                int left_count[MESH_BINS - 1];
+                double l[3], u[3];
+                int nl = 0;
+                mesh_box_reset(l, u);
+                for (k = 0; k < MESH_BINS - 1; k++) {
+                        nl += n[k];
+                        if (n[k] > 0)
+                                mesh_box_extend(l, u, lower[k], upper[k]);
+                        left_count[k] = nl;
+                        left_area[k] = (nl > 0) ? mesh_box_area(l, u) : 0;
+                }
+
+                int nr = 0;
+                mesh_box_reset(l, u);
+                for (k = MESH_BINS - 1; k > 0; k--) {
+                        nr += n[k];
+                        if (n[k] > 0)
+                                mesh_box_extend(l, u, lower[k], upper[k]);
+                        if ((nr == 0) || (left_count[k - 1] == 0)) continue;
+                        const double cost = 1 + (left_area[k - 1] *
+                            left_count[k - 1] + mesh_box_area(l, u) * nr) /
+                            area;
+                        if (cost < best_cost) {
+                                best_cost = cost;
+                                best_axis = axis;
+                                best_bin = k - 1;
                         }
+                }
+        }
+
+        if (best_axis < 0) return;
+
+        /* Partition the triangles */
+        const double scale = MESH_BINS / (cupper[best_axis] -
+            clower[best_axis]);
+        int * first = build->index + start;
+        int * last = first + count - 1;
+        while (first <= last) {
+                if (mesh_bin(build->centroids + 3 * (*first), best_axis,
+                    clower, scale) <= best_bin) {
+                        first++;
                 } else {
-                        *medium_p = NULL;
+                        const int tmp = *first;
+                        *first = *last;
+                        *last-- = tmp;
                 }
         }
+        const int n_left = (int)(first - (build->index + start));
+        if ((n_left == 0) || (n_left == count)) return;
+
+        /* Build the children, depth first */
+        node->count = 0;
+        node->axis = best_axis;
+        const int left = build->n_nodes++;
+        mesh_build_node(build, left, start, n_left, depth + 1);
+        const int right = build->n_nodes++;
+        node = build->nodes + node_index;
+        node->offset = right;
+        mesh_build_node(build, right, start + n_left, count - n_left,
+            depth + 1);
 }
 
 
-double pumas_geometry_earth_magnet(struct pumas_geometry * base_geometry,
-    struct pumas_state * state, double * magnet)
+struct pumas_mesh * pumas_mesh_create(int n_triangles,
+    const double * vertices)
 {
-#define GEOMAGNET_UPDATE_DISTANCE 1E+03
-        struct pumas_geometry_earth * earth = (void *)base_geometry;
+        if (n_triangles <= 0) return NULL;
+
+        struct mesh_build build = {vertices, NULL, NULL, NULL, NULL, 0};
+        struct pumas_mesh * mesh = calloc(1, sizeof(*mesh));
+        if (mesh == NULL) return NULL;
+        mesh->vertices = malloc(9 * n_triangles * sizeof(*mesh->vertices));
+        mesh->nodes = malloc((2 * n_triangles - 1) * sizeof(*mesh->nodes));
+        build.bounds = malloc(6 * n_triangles * sizeof(*build.bounds));
+        build.centroids = malloc(3 * n_triangles * sizeof(*build.centroids));
+        build.index = malloc(n_triangles * sizeof(*build.index));
+        if ((mesh->vertices == NULL) || (mesh->nodes == NULL) ||
+            (build.bounds == NULL) || (build.centroids == NULL) ||
+            (build.index == NULL))
+                goto error;
 
-        if (state->distance < earth->magnet.distance) {
-                memcpy(magnet, earth->magnet.last, sizeof earth->magnet.last);
+        int i;
+        for (i = 0; i < n_triangles; i++) {
+                const double * v = vertices + 9 * i;
+                double * lower = build.bounds + 6 * i;
+                double * upper = lower + 3;
+                mesh_box_reset(lower, upper);
+                mesh_box_extend(lower, upper, v, v);
+                mesh_box_extend(lower, upper, v + 3, v + 3);
+                mesh_box_extend(lower, upper, v + 6, v + 6);
+                int k;
+                for (k = 0; k < 3; k++) {
+                        build.centroids[3 * i + k] =
+                            (v[k] + v[k + 3] + v[k + 6]) / 3;
+                }
+                build.index[i] = i;
+        }
+
+        build.nodes = mesh->nodes;
+        build.n_nodes = 1;
+        mesh_build_node(&build, 0, 0, n_triangles, 0);
+        mesh->n_nodes = build.n_nodes;
+        mesh->n_triangles = n_triangles;
+
+        /* Sort the triangles according to the BVH leaves */
+        for (i = 0; i < n_triangles; i++) {
+                memcpy(mesh->vertices + 9 * i,
+                    vertices + 9 * build.index[i],
+                    9 * sizeof(*mesh->vertices));
+        }
+
+        free(build.bounds);
+        free(build.centroids);
+        free(build.index);
+        return mesh;
+error:
+        free(build.bounds);
+        free(build.centroids);
+        free(build.index);
+        pumas_mesh_destroy(mesh);
+        return NULL;
+}
+
+
+void pumas_mesh_destroy(struct pumas_mesh * mesh)
+{
+        if (mesh == NULL) return;
+        free(mesh->vertices);
+        free(mesh->nodes);
+        free(mesh);
+}
+
+
+/* Ray data for watertight ray / triangle intersections
+ *
+ * Ref: Woop, Benthin and Wald, JCGT 2(1), 65 (2013)
+ */
+struct mesh_ray {
+        const double * origin;
+        double inverse[3];
+        int kx, ky, kz;
+        double sx, sy, sz;
+};
+
+
+static void mesh_ray_initialise(struct mesh_ray * ray, const double * origin,
+    const double * direction)
+{
+        ray->origin = origin;
+        int k;
+        for (k = 0; k < 3; k++) ray->inverse[k] = 1 / direction[k];
+
+        /* Permute the axes such that z is the dominant direction */
+        const double ax = fabs(direction[0]);
+        const double ay = fabs(direction[1]);
+        const double az = fabs(direction[2]);
+        ray->kz = (ax > ay) ? ((ax > az) ? 0 : 2) : ((ay > az) ? 1 : 2);
+        ray->kx = (ray->kz + 1) % 3;
+        ray->ky = (ray->kx + 1) % 3;
+        if (direction[ray->kz] < 0) {
+                const int tmp = ray->kx;
+                ray->kx = ray->ky;
+                ray->ky = tmp;
+        }
+
+        ray->sx = direction[ray->kx] / direction[ray->kz];
+        ray->sy = direction[ray->ky] / direction[ray->kz];
+        ray->sz = 1 / direction[ray->kz];
+}
+
+
+static int mesh_ray_box(const struct mesh_ray * ray,
+    const struct mesh_node * node, double distance_max)
+{
+        double t0 = 0, t1 = distance_max;
+        int k;
+        for (k = 0; k < 3; k++) {
+                const double ta = (node->lower[k] - ray->origin[k]) *
+                    ray->inverse[k];
+                const double tb = (node->upper[k] - ray->origin[k]) *
+                    ray->inverse[k];
+                /* fmin and fmax discard NaN values, i.e. 0 * inf */
+                t0 = fmax(t0, fmin(ta, tb));
+                t1 = fmin(t1, fmax(ta, tb));
+        }
+
+        /* Conservative bound, for rounding errors */
+        return t0 <= t1 * (1 + 4 * DBL_EPSILON);
+}
+
+
+static int mesh_ray_triangle(const struct mesh_ray * ray, const double * v,
+    double * distance)
+{
+        const int kx = ray->kx, ky = ray->ky, kz = ray->kz;
+        const double * o = ray->origin;
+        const double a[3] = {v[0] - o[0], v[1] - o[1], v[2] - o[2]};
+        const double b[3] = {v[3] - o[0], v[4] - o[1], v[5] - o[2]};
+        const double c[3] = {v[6] - o[0], v[7] - o[1], v[8] - o[2]};
+
+        /* Shear and scale the vertices */
+        const double ax = a[kx] - ray->sx * a[kz];
+        const double ay = a[ky] - ray->sy * a[kz];
+        const double bx = b[kx] - ray->sx * b[kz];
+        const double by = b[ky] - ray->sy * b[kz];
+        const double cx = c[kx] - ray->sx * c[kz];
+        const double cy = c[ky] - ray->sy * c[kz];
+
+        /* Scaled barycentric coordinates */
+        const double u = cx * by - cy * bx;
+        const double w = ax * cy - ay * cx;
+        const double x = bx * ay - by * ax;
+        if (((u < 0) || (w < 0) || (x < 0)) && ((u > 0) || (w > 0) || (x > 0)))
+                return 0;
+        const double det = u + w + x;
+        if (det == 0) return 0;
+
+        const double t = (u * a[kz] + w * b[kz] + x * c[kz]) * ray->sz;
+        *distance = t / det;
+        return 1;
+}
+
+
+/* Distance to the closest triangle along a ray, or -1 */
+static int mesh_trace(const struct pumas_mesh * mesh,
+    const struct mesh_ray * ray, double * distance)
+{
+        double distance_max = DBL_MAX;
+        int hit = -1;
+
+        int stack[MESH_DEPTH_MAX + 1];
+        int size = 0, index = 0;
+        for (;;) {
+                const struct mesh_node * node = mesh->nodes + index;
+                if (mesh_ray_box(ray, node, distance_max)) {
+                        if (node->count > 0) {
+                                int i;
+                                const double * v =
+                                    mesh->vertices + 9 * node->offset;
+                                for (i = node->offset;
+                                     i < node->offset + node->count;
+                                     i++, v += 9) {
+                                        double d;
+                                        if (mesh_ray_triangle(ray, v, &d) &&
+                                            (d > 0) && (d < distance_max)) {
+                                                distance_max = d;
+                                                hit = i;
+                                        }
+                                }
+                        } else {
+                                /* Visit the nearest child first */
+                                if (ray->inverse[node->axis] < 0) {
+                                        stack[size++] = index + 1;
+                                        index = node->offset;
+                                } else {
+                                        stack[size++] = node->offset;
+                                        index = index + 1;
+                                }
+                                continue;
+                        }
+                }
+                if (size == 0) break;
+                index = stack[--size];
+        }
+
+        *distance = distance_max;
+        return hit;
+}
+
+
+void pumas_geometry_mesh_get(struct pumas_geometry * geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p)
+{
+#define STEP_MIN 1E-05
+
+        struct pumas_geometry_mesh * g = (void *)geometry;
+        const struct pumas_mesh * mesh = g->mesh;
+
+        struct pumas_state_extended * extended = (void *)state;
+        const double sgn =
+            (extended->context->mode.direction == PUMAS_MODE_FORWARD)? 1 : -1;
+        const double direction[3] = {sgn * state->direction[0],
+                                     sgn * state->direction[1],
+                                     sgn * state->direction[2]};
+
+        struct mesh_ray ray;
+        mesh_ray_initialise(&ray, state->position, direction);
+        double d;
+        const int i = mesh_trace(mesh, &ray, &d);
+
+        /* The side is given by the orientation of the closest triangle,
+         * assuming outward going normals
+         */
+        double step;
+        struct pumas_medium * medium;
+        if (i < 0) {
+                step = DBL_MAX;
+                medium = NULL;
         } else {
-                /* Get geodetic coordinates */
-                struct pumas_geodetic_point geodetic_position;
-                turtle_ecef_to_geodetic(state->position,
-                    &geodetic_position.latitude, &geodetic_position.longitude,
-                    &geodetic_position.altitude);
+                const double * v = mesh->vertices + 9 * i;
+                const double e0[3] = {v[3] - v[0], v[4] - v[1], v[5] - v[2]};
+                const double e1[3] = {v[6] - v[0], v[7] - v[1], v[8] - v[2]};
+                const double un =
+                    direction[0] * (e0[1] * e1[2] - e0[2] * e1[1]) +
+                    direction[1] * (e0[2] * e1[0] - e0[0] * e1[2]) +
+                    direction[2] * (e0[0] * e1[1] - e0[1] * e1[0]);
+                step = (d > STEP_MIN) ? d : STEP_MIN;
+                medium = (un > 0) ? g->medium : NULL;
+        }
 
-                /* Get the local frame */
-                struct pumas_coordinates_unitary_transformation frame;
-                struct pumas_cartesian_point ecef_position = {
-                    state->position[0], state->position[1], state->position[2]};
-                pumas_coordinates_frame_initialise_local(&frame, &ecef_position,
-                    &geodetic_position, 0, 0);
+        if (step_p != NULL) *step_p = step;
+        if (medium_p != NULL) *medium_p = medium;
 
-                /* Get the local magnetic field (ENU frame) */
-                struct pumas_cartesian_vector magnet_enu = {.frame = &frame};
-                gull_snapshot_field(*earth->magnet.snapshot,
-                    geodetic_position.latitude, geodetic_position.longitude,
-                    geodetic_position.altitude, (double *)(&magnet_enu),
-                    earth->magnet.workspace);
+#undef STEP_MIN
+}
 
-                /* Transform back to ECEF */
-                pumas_coordinates_cartesian_vector_transform(
-                    &magnet_enu, NULL);
+#undef MESH_BINS
+#undef MESH_LEAF_SIZE
+#undef MESH_DEPTH_MAX
+
+
+/* Batched topography queries
+ *
+ * The queries are shared over threads by contiguous blocks. Since stacks are
+ * not thread safe, threads access them through TURTLE clients. This requires
+ * the stacks to be created with the lock and unlock functions below.
+ */
+#ifndef _WIN32
+static pthread_mutex_t topography_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+int pumas_topography_lock(void)
+{
+#ifndef _WIN32
+        return pthread_mutex_lock(&topography_mutex);
+#else
+        return 0;
+#endif
+}
+
+
+int pumas_topography_unlock(void)
+{
+#ifndef _WIN32
+        return pthread_mutex_unlock(&topography_mutex);
+#else
+        return 0;
+#endif
+}
+
+
+struct topography_job {
+        int n_data;
+        const struct pumas_topography_data * data;
+        const double * latitude;
+        const double * longitude;
+        double * x;
+        double * y;
+        int start;
+        int end;
+        int threaded;
+        enum turtle_return rc;
+        char error[1024];
+};
+
+
+static void topography_project(const struct turtle_projection * projection,
+    double latitude, double longitude, double * x, double * y)
+{
+        if (projection == NULL) {
+                *x = longitude;
+                *y = latitude;
+        } else {
+                turtle_projection_project(
+                    projection, latitude, longitude, x, y);
+        }
+}
+
+
+static void * topography_elevation_run(void * arg)
+{
+        struct topography_job * job = arg;
+        struct turtle_client ** clients = NULL;
+        int i, j;
+        thread_error = job->error;
+        thread_error_size = sizeof(job->error);
+        if (job->threaded) {
+                clients = calloc(job->n_data, sizeof(*clients));
+                if (clients == NULL) {
+                        job->rc = TURTLE_RETURN_MEMORY_ERROR;
+                        goto exit;
+                }
+                for (j = 0; j < job->n_data; j++) {
+                        if (job->data[j].stack == NULL) continue;
+                        job->rc = turtle_client_create(
+                            job->data[j].stack, clients + j);
+                        if (job->rc != TURTLE_RETURN_SUCCESS) goto exit;
+                }
+        }
+
+        for (i = job->start; i < job->end; i++) {
+                const double latitude = job->latitude[i];
+                const double longitude = job->longitude[i];
+                double elevation = NAN;
+                for (j = 0; j < job->n_data; j++) {
+                        const struct pumas_topography_data * d = job->data + j;
+                        double z = 0;
+                        int inside = 1;
+                        if (d->map != NULL) {
+                                double x, y;
+                                topography_project(
+                                    turtle_map_projection(d->map), latitude,
+                                    longitude, &x, &y);
+                                job->rc = turtle_map_elevation(
+                                    d->map, x, y, &z, &inside);
+                        } else if (clients != NULL) {
+                                job->rc = turtle_client_elevation(clients[j],
+                                    latitude, longitude, &z, &inside);
+                        } else if (d->stack != NULL) {
+                                job->rc = turtle_stack_elevation(d->stack,
+                                    latitude, longitude, &z, &inside);
+                        }
+                        if (job->rc != TURTLE_RETURN_SUCCESS) goto exit;
+                        if (inside) {
+                                elevation = z + d->offset;
+                                break;
+                        }
+                }
+                job->x[i] = elevation;
+        }
+
+exit:
+        if (clients != NULL) {
+                for (j = 0; j < job->n_data; j++) {
+                        if (clients[j] != NULL)
+                                turtle_client_destroy(clients + j);
+                }
+                free(clients);
+        }
+        thread_error = NULL;
+        return NULL;
+}
+
+
+static void * topography_project_run(void * arg)
+{
+        struct topography_job * job = arg;
+        const struct turtle_projection * projection =
+            (job->data->map != NULL) ?
+            turtle_map_projection(job->data->map) : NULL;
+        thread_error = job->error;
+        thread_error_size = sizeof(job->error);
+        int i;
+        for (i = job->start; i < job->end; i++) {
+                topography_project(projection, job->latitude[i],
+                    job->longitude[i], job->x + i, job->y + i);
+        }
+        thread_error = NULL;
+        return NULL;
+}
+
+
+static enum turtle_return topography_run(void * (*run)(void *), int n_data,
+    const struct pumas_topography_data * data, int n,
+    const double * latitude, const double * longitude, double * x,
+    double * y, int n_threads)
+{
+        if (n <= 0) return TURTLE_RETURN_SUCCESS;
+        n_threads = threads_count(n_threads, n);
+
+        struct topography_job jobs[THREADS_MAX];
+        int i;
+        for (i = 0; i < n_threads; i++) {
+                struct topography_job * job = jobs + i;
+                job->n_data = n_data;
+                job->data = data;
+                job->latitude = latitude;
+                job->longitude = longitude;
+                job->x = x;
+                job->y = y;
+                job->start = (int)(((long long)n * i) / n_threads);
+                job->end = (int)(((long long)n * (i + 1)) / n_threads);
+                job->threaded = (n_threads > 1);
+                job->rc = TURTLE_RETURN_SUCCESS;
+                job->error[0] = 0x0;
+        }
+        threads_run(n_threads, run, jobs, sizeof(*jobs));
 
-                /* Update the magnet and its history */
-                memcpy(&earth->magnet.last, &magnet_enu,
-                    sizeof earth->magnet.last);
-                memcpy(magnet, &magnet_enu, sizeof earth->magnet.last);
-                earth->magnet.distance = state->distance +
-                                         GEOMAGNET_UPDATE_DISTANCE;
+        for (i = 0; i < n_threads; i++) {
+                if (jobs[i].rc != TURTLE_RETURN_SUCCESS) {
+                        if (jobs[i].error[0] != 0x0)
+                                forward_error(jobs[i].rc, NULL, jobs[i].error);
+                        return jobs[i].rc;
+                }
         }
+        return TURTLE_RETURN_SUCCESS;
+}
 
-        return GEOMAGNET_UPDATE_DISTANCE;
 
-#undef GEOMAGNET_UPDATE_DISTANCE
+enum turtle_return pumas_topography_elevation(int n_data,
+    const struct pumas_topography_data * data, int n,
+    const double * latitude, const double * longitude, double * elevation,
+    int n_threads)
+{
+        return topography_run(topography_elevation_run, n_data, data, n,
+            latitude, longitude, elevation, NULL, n_threads);
 }
 
 
-void pumas_geometry_earth_reset(struct pumas_geometry * base_geometry)
+enum turtle_return pumas_topography_project(
+    const struct pumas_topography_data * data, int n,
+    const double * latitude, const double * longitude, double * x,
+    double * y, int n_threads)
 {
-        struct pumas_geometry_earth * earth = (void *)base_geometry;
-        earth->magnet.distance = -1;
-        memset(earth->magnet.last, 0x0, sizeof earth->magnet.last);
+        return topography_run(topography_project_run, 1, data, n, latitude,
+            longitude, x, y, n_threads);
 }
 
+#undef THREADS_MAX
+
+/* Cache of topography maps
+ *
+ * Maps are stored as raw 16 bits grids, preceded by their meta data. This
+ * avoids decoding the initial data format, e.g. ASCII grids. Note that the
+ * cache file is only mapped while loading, since the nodes are copied to a
+ * new TURTLE map. The size and the modification time of the source data are
+ * stored as well, in order to detect stale caches.
+ */
+#define MAP_CACHE_MAGIC "PUMASMAP"
+#define MAP_CACHE_VERSION 1
+
+struct map_cache_header {
+        char magic[8];
+        int32_t version;
+        int32_t nx;
+        int32_t ny;
+        int32_t strings; /* Size of the projection and encoding strings */
+        double x[2];
+        double y[2];
+        double z[2];
+        double source[2]; /* Size and modification time of the source */
+};
 
-void pumas_geometry_earth_destroy(struct pumas_geometry * base_geometry)
+
+static enum turtle_return map_cache_error(enum turtle_return rc,
+    const char * path, const char * message)
 {
-        struct pumas_geometry_earth * earth = (void *)base_geometry;
-        turtle_stepper_destroy(earth->stepper);
-        free(*earth->magnet.workspace);
-        *earth->magnet.workspace = NULL;
-        gull_snapshot_destroy(earth->magnet.snapshot);
-        free(base_geometry);
+        char buffer[1024];
+        snprintf(buffer, sizeof(buffer), "{ %d, pumas_topography_map, %s } %s",
+            rc, path, message);
+        forward_error(rc, NULL, buffer);
+        return rc;
 }
 
 
-void pumas_geometry_polyhedron_get(struct pumas_geometry * geometry,
-    struct pumas_state * state, struct pumas_medium ** medium_p,
-    double * step_p)
+enum turtle_return pumas_topography_map_dump(struct turtle_map * map,
+    const char * path, double size, double mtime)
 {
-#define STEP_MIN 1E-05
+        struct turtle_map_info info;
+        const char * projection;
+        enum turtle_return rc = turtle_map_meta(map, &info, &projection);
+        if (rc != TURTLE_RETURN_SUCCESS) return rc;
+        if (projection == NULL) projection = "";
+        const char * encoding = (info.encoding != NULL) ? info.encoding : "";
+
+        const size_t n_projection = strlen(projection) + 1;
+        const size_t n_encoding = strlen(encoding) + 1;
+        struct map_cache_header header;
+        memset(&header, 0x0, sizeof(header));
+        memcpy(header.magic, MAP_CACHE_MAGIC, sizeof(header.magic));
+        header.version = MAP_CACHE_VERSION;
+        header.nx = info.nx;
+        header.ny = info.ny;
+        header.strings = (int32_t)(n_projection + n_encoding);
+        memcpy(header.x, info.x, sizeof(header.x));
+        memcpy(header.y, info.y, sizeof(header.y));
+        memcpy(header.z, info.z, sizeof(header.z));
+        header.source[0] = size;
+        header.source[1] = mtime;
+
+        uint16_t * row = malloc(info.nx * sizeof(*row));
+        if (row == NULL) {
+                return map_cache_error(TURTLE_RETURN_MEMORY_ERROR, path,
+                    "could not allocate memory");
+        }
 
-        struct pumas_geometry_polyhedron * p = (void *)geometry;
-        const double * const position = state->position;
+        /* Write to a temporary file first, since concurrent jobs might
+         * dump the same map
+         */
+        char tmp[1024];
+#ifndef _WIN32
+        snprintf(tmp, sizeof(tmp), "%s.%ld", path, (long)getpid());
+#else
+        snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+#endif
+        FILE * stream = fopen(tmp, "wb");
+        if (stream == NULL) {
+                free(row);
+                return map_cache_error(TURTLE_RETURN_PATH_ERROR, path,
+                    "could not open file");
+        }
 
-        struct pumas_state_extended * extended = (void *)state;
-        const double sgn =
-            (extended->context->mode.direction == PUMAS_MODE_FORWARD)? 1 : -1;
-        const double direction[3] = {sgn * state->direction[0],
-                                     sgn * state->direction[1],
-                                     sgn * state->direction[2]};
+        int ok = (fwrite(&header, sizeof(header), 1, stream) == 1) &&
+            (fwrite(projection, 1, n_projection, stream) == n_projection) &&
+            (fwrite(encoding, 1, n_encoding, stream) == n_encoding);
+        const double dz = info.z[1] - info.z[0];
+        const double scale = (dz > 0) ? 65535 / dz : 0;
+        int ix, iy;
+        for (iy = 0; ok && (iy < info.ny); iy++) {
+                for (ix = 0; ix < info.nx; ix++) {
+                        double z;
+                        turtle_map_node(map, ix, iy, NULL, NULL, &z);
+                        const double q = (z - info.z[0]) * scale + 0.5;
+                        row[ix] = (q <= 0) ? 0 :
+                            ((q >= 65535) ? 65535 : (uint16_t)q);
+                }
+                ok = (fwrite(row, sizeof(*row), info.nx, stream) ==
+                    (size_t)info.nx);
+        }
+        free(row);
+        if (fclose(stream) != 0) ok = 0;
+
+        if (ok) {
+#ifdef _WIN32
+                remove(path);
+#endif
+                ok = (rename(tmp, path) == 0);
+        }
+        if (!ok) {
+                remove(tmp);
+                return map_cache_error(TURTLE_RETURN_PATH_ERROR, path,
+                    "could not write file");
+        }
+        return TURTLE_RETURN_SUCCESS;
+}
 
-        double dE = -DBL_MAX, dL = DBL_MAX;
-        int i, inside = 1;
-        struct pumas_polyhedron_face * s;
-        for (i = 0, s = p->faces; i < p->n_faces; i++, s++) {
-                const double rn = (position[0] - s->origin[0]) * s->normal[0] +
-                    (position[1] - s->origin[1]) * s->normal[1] +
-                    (position[2] - s->origin[2]) * s->normal[2];
-                if (rn > 0) inside = 0;
-                const double un = direction[0] * s->normal[0] +
-                    direction[1] * s->normal[1] + direction[2] * s->normal[2];
-                if (fabs(un) <= FLT_EPSILON) continue;
-                const double d = (rn == 0) ? 0 : -rn / un;
-                if ((un > 0) && (d < dL))
-                        dL = d;
-                else if ((un < 0.) && (d > dE))
-                        dE = d;
+
+enum turtle_return pumas_topography_map_load(struct turtle_map ** map,
+    const char * path, double size, double mtime)
+{
+        *map = NULL;
+
+        /* Map the cache file, or read it */
+        char * data = NULL;
+        size_t n = 0;
+#ifndef _WIN32
+        const int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+                return map_cache_error(TURTLE_RETURN_PATH_ERROR, path,
+                    "could not open file");
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0) {
+                n = st.st_size;
+                data = mmap(NULL, n, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) data = NULL;
+        }
+        close(fd);
+#else
+        FILE * stream = fopen(path, "rb");
+        if (stream == NULL) {
+                return map_cache_error(TURTLE_RETURN_PATH_ERROR, path,
+                    "could not open file");
+        }
+        fseek(stream, 0, SEEK_END);
+        n = ftell(stream);
+        rewind(stream);
+        data = malloc(n);
+        if ((data != NULL) && (fread(data, 1, n, stream) != n)) {
+                free(data);
+                data = NULL;
+        }
+        fclose(stream);
+#endif
+        if (data == NULL) {
+                return map_cache_error(TURTLE_RETURN_PATH_ERROR, path,
+                    "could not read file");
         }
 
-        double step;
-        struct pumas_medium * medium;
-        if (inside && (dL > 0)) {
-                step = (dL > STEP_MIN) ? dL : STEP_MIN;
-                medium = p->medium;
-        } else if (!inside && (dE > 0)) {
-                step = (dE > STEP_MIN) ? dE : STEP_MIN;
-                medium = NULL;
-        } else {
-                step = DBL_MAX;
-                medium = (dL == 0) ? p->medium : NULL;
+        /* Check the header */
+        enum turtle_return rc = TURTLE_RETURN_BAD_FORMAT;
+        const char * message = "bad format";
+        struct map_cache_header header;
+        if (n < sizeof(header)) goto exit;
+        memcpy(&header, data, sizeof(header));
+        if ((memcmp(header.magic, MAP_CACHE_MAGIC, sizeof(header.magic)) !=
+            0) || (header.version != MAP_CACHE_VERSION) ||
+            (header.nx <= 0) || (header.ny <= 0) || (header.strings < 2) ||
+            (n != sizeof(header) + header.strings +
+            sizeof(uint16_t) * (size_t)header.nx * header.ny)) goto exit;
+        if ((header.source[0] != size) || (header.source[1] != mtime)) {
+                message = "stale cache";
+                goto exit;
+        }
+        const char * projection = data + sizeof(header);
+        const char * encoding = projection + strlen(projection) + 1;
+        if ((encoding - projection >= header.strings) ||
+            (data[sizeof(header) + header.strings - 1] != 0x0)) goto exit;
+
+        /* Build the map */
+        struct turtle_map_info info;
+        info.nx = header.nx;
+        info.ny = header.ny;
+        memcpy(info.x, header.x, sizeof(info.x));
+        memcpy(info.y, header.y, sizeof(info.y));
+        memcpy(info.z, header.z, sizeof(info.z));
+        info.encoding = (*encoding != 0x0) ? encoding : NULL;
+        rc = turtle_map_create(map, &info,
+            (*projection != 0x0) ? projection : NULL);
+        if (rc != TURTLE_RETURN_SUCCESS) {
+                message = NULL;
+                goto exit;
         }
 
-        if (step_p != NULL) *step_p = step;
-        if (medium_p != NULL) *medium_p = medium;
+        const double dz = (header.z[1] - header.z[0]) / 65535;
+        const char * grid = data + sizeof(header) + header.strings;
+        int ix, iy;
+        for (iy = 0; iy < header.ny; iy++) {
+                for (ix = 0; ix < header.nx; ix++, grid += sizeof(uint16_t)) {
+                        uint16_t q;
+                        memcpy(&q, grid, sizeof(q));
+                        turtle_map_fill(*map, ix, iy, header.z[0] + q * dz);
+                }
+        }
 
-#undef STEP_MIN
+exit:
+#ifndef _WIN32
+        munmap(data, n);
+#else
+        free(data);
+#endif
+        if (rc != TURTLE_RETURN_SUCCESS) {
+                turtle_map_destroy(map);
+                if (message != NULL) map_cache_error(rc, path, message);
+        }
+        return rc;
 }
 
+#undef MAP_CACHE_MAGIC
+#undef MAP_CACHE_VERSION
+
 
 /* Coordinates transforms */
 static void cartesian_point_transform(struct pumas_cartesian_point * self,
@@ -889,6 +3479,387 @@ void pumas_coordinates_spherical_vector_transform(
 }
 
 
+/* Batched coordinates transforms, using SoA arrays
+ *
+ * The per element operations are written as straight loops without branches
+ * nor calls to external libraries (but libm) in order to allow for their
+ * vectorization by the compiler.
+ */
+struct array_affine {
+        double m[3][3];
+        double t[3];
+};
+
+static struct array_affine array_affine_compose(
+    const struct pumas_coordinates_unitary_transformation * initial,
+    const struct pumas_coordinates_unitary_transformation * final,
+    int translate)
+{
+        /* Compose the transform from the initial frame to the simulation one
+         * with the transform from the latter to the final frame. A NULL frame
+         * stands for the simulation frame
+         */
+        struct array_affine mi, mf, affine;
+        int i, j, k;
+        for (i = 0; i < 3; i++) {
+                for (j = 0; j < 3; j++) {
+                        mi.m[i][j] = (initial == NULL) ? (i == j) :
+                                                         initial->matrix[i][j];
+                        mf.m[i][j] = (final == NULL) ? (i == j) :
+                                                       final->matrix[i][j];
+                }
+                mi.t[i] = ((initial == NULL) || !translate) ? 0 :
+                    initial->translation[i];
+                mf.t[i] = ((final == NULL) || !translate) ? 0 :
+                    final->translation[i];
+        }
+
+        for (i = 0; i < 3; i++) {
+                affine.t[i] = 0;
+                for (j = 0; j < 3; j++) {
+                        affine.m[i][j] = 0;
+                        for (k = 0; k < 3; k++)
+                                affine.m[i][j] += mf.m[k][i] * mi.m[k][j];
+                        affine.t[i] += mf.m[j][i] * (mi.t[j] - mf.t[j]);
+                }
+        }
+
+        return affine;
+}
+
+
+static void array_affine_apply(const struct array_affine affine, int size,
+    double * x, double * y, double * z)
+{
+        int i;
+        for (i = 0; i < size; i++) {
+                const double r[3] = { x[i], y[i], z[i] };
+                x[i] = affine.t[0] + affine.m[0][0] * r[0] +
+                       affine.m[0][1] * r[1] + affine.m[0][2] * r[2];
+                y[i] = affine.t[1] + affine.m[1][0] * r[0] +
+                       affine.m[1][1] * r[1] + affine.m[1][2] * r[2];
+                z[i] = affine.t[2] + affine.m[2][0] * r[0] +
+                       affine.m[2][1] * r[1] + affine.m[2][2] * r[2];
+        }
+}
+
+
+void pumas_coordinates_cartesian_point_array_transform(
+    struct pumas_cartesian_point_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame)
+{
+        if (self->frame == frame) return;
+
+        array_affine_apply(array_affine_compose(self->frame, frame, 1),
+            self->size, self->x, self->y, self->z);
+        self->frame = (void *)frame;
+}
+
+
+void pumas_coordinates_cartesian_vector_array_transform(
+    struct pumas_cartesian_vector_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame)
+{
+        if (self->frame == frame) return;
+
+        array_affine_apply(array_affine_compose(self->frame, frame, 0),
+            self->size, self->x, self->y, self->z);
+        self->frame = (void *)frame;
+}
+
+
+void pumas_coordinates_cartesian_point_array_from_geodetic(
+    struct pumas_cartesian_point_array * self,
+    const struct pumas_geodetic_point_array * points)
+{
+#define WGS84_A 6378137.0
+#define WGS84_E2 6.69437999014E-03
+
+        const double * latitude = points->latitude;
+        const double * longitude = points->longitude;
+        const double * altitude = points->altitude;
+        double * x = self->x, * y = self->y, * z = self->z;
+        const double deg = M_PI / 180.;
+        int i;
+        for (i = 0; i < self->size; i++) {
+                const double s = sin(latitude[i] * deg);
+                const double c = cos(latitude[i] * deg);
+                const double n = WGS84_A / sqrt(1. - WGS84_E2 * s * s);
+                const double rho = (n + altitude[i]) * c;
+                x[i] = rho * cos(longitude[i] * deg);
+                y[i] = rho * sin(longitude[i] * deg);
+                z[i] = (n * (1. - WGS84_E2) + altitude[i]) * s;
+        }
+        self->frame = NULL;
+
+#undef WGS84_A
+#undef WGS84_E2
+}
+
+
+void pumas_coordinates_geodetic_point_array_from_cartesian(
+    struct pumas_geodetic_point_array * self,
+    const struct pumas_cartesian_point_array * points)
+{
+        /* Bowring's iterative method, with a fixed number of iterations such
+         * that the loop vectorizes. Two iterations are enough for reaching
+         * the double precision at terrestrial altitudes
+         */
+#define WGS84_A 6378137.0
+#define WGS84_B 6356752.314245
+#define WGS84_E2 6.69437999014E-03
+#define WGS84_EP2 6.73949674228E-03
+#define N_ITERATIONS 2
+
+        const struct array_affine affine = array_affine_compose(
+            points->frame, NULL, 1);
+        const double * px = points->x, * py = points->y, * pz = points->z;
+        double * latitude = self->latitude, * longitude = self->longitude;
+        double * altitude = self->altitude;
+        const double rad = 180. / M_PI;
+        int i;
+        for (i = 0; i < self->size; i++) {
+                const double r[3] = { px[i], py[i], pz[i] };
+                const double x = affine.t[0] + affine.m[0][0] * r[0] +
+                    affine.m[0][1] * r[1] + affine.m[0][2] * r[2];
+                const double y = affine.t[1] + affine.m[1][0] * r[0] +
+                    affine.m[1][1] * r[1] + affine.m[1][2] * r[2];
+                const double z = affine.t[2] + affine.m[2][0] * r[0] +
+                    affine.m[2][1] * r[1] + affine.m[2][2] * r[2];
+                const double p = sqrt(x * x + y * y);
+
+                /* Initial guess of the parametric latitude */
+                double cb = p * WGS84_B, sb = z * WGS84_A;
+                double d = sqrt(cb * cb + sb * sb);
+                d = (d > 0) ? 1. / d : 0;
+                cb = (d > 0) ? cb * d : 1;
+                sb *= d;
+
+                double num = 0, den = 1;
+                int j;
+                for (j = 0; j < N_ITERATIONS; j++) {
+                        num = z + WGS84_EP2 * WGS84_B * sb * sb * sb;
+                        den = p - WGS84_E2 * WGS84_A * cb * cb * cb;
+                        cb = WGS84_A * den;
+                        sb = WGS84_B * num;
+                        d = sqrt(cb * cb + sb * sb);
+                        d = (d > 0) ? 1. / d : 0;
+                        cb = (d > 0) ? cb * d : 1;
+                        sb *= d;
+                }
+
+                /* Geodetic coordinates */
+                d = sqrt(num * num + den * den);
+                d = (d > 0) ? 1. / d : 0;
+                const double cl = (d > 0) ? den * d : 1;
+                const double sl = num * d;
+                latitude[i] = atan2(num, den) * rad;
+                longitude[i] = atan2(y, x) * rad;
+                altitude[i] = p * cl + z * sl -
+                    WGS84_A * sqrt(1. - WGS84_E2 * sl * sl);
+        }
+
+#undef WGS84_A
+#undef WGS84_B
+#undef WGS84_E2
+#undef WGS84_EP2
+#undef N_ITERATIONS
+}
+
+
+static void array_horizontal_from_cartesian(int size, const double * x,
+    const double * y, const double * z, double * norm, double * elevation,
+    double * azimuth)
+{
+        /* Branch free version of horizontal_from_cartesian */
+        int i;
+        for (i = 0; i < size; i++) {
+                const double xi = x[i], yi = y[i], zi = z[i];
+                const double rho2 = xi * xi + yi * yi;
+                const double theta = atan2(sqrt(rho2), zi);
+                const double phi0 = atan2(yi, xi);
+                const double phi = (fabs(theta) <= FLT_EPSILON) ? 0 : phi0;
+                norm[i] = sqrt(rho2 + zi * zi);
+                elevation[i] = 0.5 * M_PI - theta;
+                azimuth[i] = ((theta == 0) || (theta == M_PI)) ?
+                    0 : 0.5 * M_PI - phi;
+        }
+}
+
+
+static void array_cartesian_from_horizontal(int size, const double * norm,
+    const double * elevation, const double * azimuth, double * x, double * y,
+    double * z)
+{
+        int i;
+        for (i = 0; i < size; i++) {
+                const double r = norm[i];
+                const double ce = cos(elevation[i]);
+                const double se = sin(elevation[i]);
+                const double ca = cos(azimuth[i]);
+                const double sa = sin(azimuth[i]);
+                x[i] = r * sa * ce;
+                y[i] = r * ca * ce;
+                z[i] = r * se;
+        }
+}
+
+
+void pumas_coordinates_cartesian_vector_array_from_horizontal(
+    struct pumas_cartesian_vector_array * self,
+    const struct pumas_horizontal_vector_array * vectors)
+{
+        array_cartesian_from_horizontal(self->size, vectors->norm,
+            vectors->elevation, vectors->azimuth, self->x, self->y, self->z);
+        self->frame = vectors->frame;
+}
+
+
+void pumas_coordinates_horizontal_vector_array_from_cartesian(
+    struct pumas_horizontal_vector_array * self,
+    const struct pumas_cartesian_vector_array * vectors)
+{
+        array_horizontal_from_cartesian(self->size, vectors->x, vectors->y,
+            vectors->z, self->norm, self->elevation, self->azimuth);
+        self->frame = vectors->frame;
+}
+
+
+void pumas_coordinates_horizontal_vector_array_transform(
+    struct pumas_horizontal_vector_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame)
+{
+        if (self->frame == frame) return;
+
+        /* The conversion is done in place, using the horizontal columns as
+         * Cartesian ones
+         */
+        double * x = self->norm, * y = self->elevation, * z = self->azimuth;
+        array_cartesian_from_horizontal(self->size, self->norm,
+            self->elevation, self->azimuth, x, y, z);
+        array_affine_apply(array_affine_compose(self->frame, frame, 0),
+            self->size, x, y, z);
+        array_horizontal_from_cartesian(self->size, x, y, z, self->norm,
+            self->elevation, self->azimuth);
+        self->frame = (void *)frame;
+}
+
+
+/* Grammage along straight lines, without any physics sampling */
+static void grammage_move(struct pumas_state * state, double step)
+{
+        struct pumas_state_extended * extended = (void *)state;
+        const double sgn = (extended->context->mode.direction ==
+            PUMAS_MODE_FORWARD) ? 1 : -1;
+        int i;
+        for (i = 0; i < 3; i++)
+                state->position[i] += sgn * step * state->direction[i];
+        state->distance += step;
+        extended->geodetic.computed = 0;
+}
+
+
+static double geometry_grammage(struct pumas_context * context,
+    struct pumas_state * state, double distance_max)
+{
+#define STEP_MIN 1E-06
+
+        /* Normalise the direction. Note that in backward mode the state
+         * direction is opposite to the geometric one
+         */
+        const double sgn =
+            (context->mode.direction == PUMAS_MODE_FORWARD) ? 1 : -1;
+        double * const u = state->direction;
+        const double norm = sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+        if (norm <= 0) return 0;
+        int i;
+        for (i = 0; i < 3; i++) u[i] *= sgn / norm;
+
+        pumas_geometry_reset(context);
+        const double grammage0 = state->grammage;
+        for (;;) {
+                struct pumas_medium * medium;
+                double step;
+                pumas_geometry_medium(context, state, &medium, &step);
+                if ((medium == NULL) || (medium->locals == NULL)) break;
+
+                struct pumas_locals locals;
+                const double s = medium->locals(medium, state, &locals);
+                if ((step <= 0) && (distance_max <= 0)) {
+                        /* Unbounded medium. Note that non uniform media
+                         * always provide a step, which must not be
+                         * followed endlessly
+                         */
+                        if (locals.density > 0) state->grammage = INFINITY;
+                        break;
+                }
+
+                if ((s > 0) && ((step <= 0) || (s < step))) step = s;
+                if (distance_max > 0) {
+                        const double d = distance_max - state->distance;
+                        if ((step <= 0) || (d < step)) step = d;
+                }
+
+                if (step <= 0) {
+                        break;
+                } else if (step < STEP_MIN) {
+                        step = STEP_MIN;
+                }
+
+                if (s > 0) {
+                        /* Midpoint rule for non uniform media */
+                        grammage_move(state, 0.5 * step);
+                        medium->locals(medium, state, &locals);
+                        grammage_move(state, 0.5 * step);
+                } else {
+                        grammage_move(state, step);
+                }
+                state->grammage += locals.density * step;
+
+                if ((distance_max > 0) && (state->distance >= distance_max))
+                        break;
+        }
+
+        return state->grammage - grammage0;
+
+#undef STEP_MIN
+}
+
+
+double pumas_geometry_grammage(struct pumas_context * context,
+    struct pumas_state * state, double distance_max)
+{
+        return geometry_grammage(context, state, distance_max);
+}
+
+
+void pumas_geometry_grammage_map(struct pumas_context * context,
+    struct pumas_state * state,
+    const struct pumas_cartesian_vector_array * directions,
+    double distance_max, double * grammage)
+{
+        const struct array_affine affine = array_affine_compose(
+            directions->frame, NULL, 0);
+        struct pumas_state_extended origin;
+        memcpy(&origin, state, sizeof origin);
+
+        int i;
+        for (i = 0; i < directions->size; i++) {
+                const double r[3] = {
+                    directions->x[i], directions->y[i], directions->z[i] };
+                memcpy(state, &origin, sizeof origin);
+
+                int j;
+                for (j = 0; j < 3; j++) {
+                        state->direction[j] = affine.m[j][0] * r[0] +
+                            affine.m[j][1] * r[1] + affine.m[j][2] * r[2];
+                }
+                grammage[i] = geometry_grammage(context, state, distance_max);
+        }
+        memcpy(state, &origin, sizeof origin);
+}
+
+
 void pumas_coordinates_unitary_transformation_from_euler(
     struct pumas_coordinates_unitary_transformation * transformation,
     int n, int * axis, double * angles)
@@ -1125,6 +4096,215 @@ double pumas_flux_tabulation_get(
         return flux;
 }
 
+/* Vectorised access to the material tables and properties */
+enum pumas_return pumas_physics_table_array(
+    const struct pumas_physics * physics, enum pumas_property property,
+    enum pumas_mode scheme, int material, double * values)
+{
+        const int n = pumas_physics_table_length(physics);
+        int i;
+        for (i = 0; i < n; i++) {
+                const enum pumas_return rc = pumas_physics_table_value(
+                    physics, property, scheme, material, i, values + i);
+                if (rc != PUMAS_RETURN_SUCCESS) return rc;
+        }
+        return PUMAS_RETURN_SUCCESS;
+}
+
+
+enum pumas_return pumas_physics_property_array(
+    const struct pumas_physics * physics, enum pumas_property property,
+    enum pumas_mode scheme, int material, int n, const double * input,
+    double * output)
+{
+        int i;
+        for (i = 0; i < n; i++) {
+                enum pumas_return rc;
+                switch (property) {
+                case PUMAS_PROPERTY_CROSS_SECTION:
+                        rc = pumas_physics_property_cross_section(physics,
+                            material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_ENERGY_LOSS:
+                        rc = pumas_physics_property_energy_loss(physics,
+                            scheme, material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_GRAMMAGE:
+                        rc = pumas_physics_property_grammage(physics, scheme,
+                            material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_KINETIC_ENERGY:
+                        rc = pumas_physics_property_kinetic_energy(physics,
+                            scheme, material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_MAGNETIC_ROTATION:
+                        rc = pumas_physics_property_magnetic_rotation(
+                            physics, material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_PROPER_TIME:
+                        rc = pumas_physics_property_proper_time(physics,
+                            scheme, material, input[i], output + i);
+                        break;
+                case PUMAS_PROPERTY_SCATTERING_LENGTH:
+                        rc = pumas_physics_property_scattering_length(
+                            physics, material, input[i], output + i);
+                        break;
+                default:
+                        return PUMAS_RETURN_VALUE_ERROR;
+                }
+                if (rc != PUMAS_RETURN_SUCCESS) return rc;
+        }
+        return PUMAS_RETURN_SUCCESS;
+}
+
+
+/* Transmitted flux through a given grammage
+ *
+ * The data are stored as n_k kinetic energy values, followed by the
+ * corresponding n_k CSDA grammage values and by n_c x n_k flux values. Prior
+ * to the integration the latter contain the differential flux, sampled at
+ * n_c cos(theta) values uniformly distributed over [0, 1].
+ */
+void pumas_flux_transmission_integrate(
+    struct pumas_flux_transmission * transmission)
+{
+        const int n_k = transmission->n_k;
+        const double * const k = transmission->data;
+        int i, j;
+        for (j = 0; j < transmission->n_c; j++) {
+                double * const f = transmission->data + (2 + j) * n_k;
+
+                /* Power law tail above the last kinetic energy value */
+                double integral = 0.;
+                if ((f[n_k - 2] > 0.) && (f[n_k - 1] > 0.) &&
+                    (k[n_k - 2] > 0.)) {
+                        const double gamma = -log(f[n_k - 1] / f[n_k - 2]) /
+                            log(k[n_k - 1] / k[n_k - 2]);
+                        if (gamma > 1.)
+                                integral = f[n_k - 1] * k[n_k - 1] /
+                                    (gamma - 1.);
+                }
+
+                /* Integrate segment wise, assuming a power law between
+                 * nodes, or a linear dependency
+                 */
+                double f1 = f[n_k - 1];
+                f[n_k - 1] = integral;
+                for (i = n_k - 2; i >= 0; i--) {
+                        const double f0 = f[i];
+                        double segment;
+                        if ((f0 > 0.) && (f1 > 0.) && (k[i] > 0.)) {
+                                const double lr = log(k[i + 1] / k[i]);
+                                const double a = 1. + log(f1 / f0) / lr;
+                                if (fabs(a) < FLT_EPSILON)
+                                        segment = f0 * k[i] * lr;
+                                else
+                                        segment = f0 * k[i] *
+                                            (exp(a * lr) - 1.) / a;
+                        } else {
+                                segment = 0.5 * (f0 + f1) * (k[i + 1] - k[i]);
+                        }
+                        integral += segment;
+                        f1 = f0;
+                        f[i] = integral;
+                }
+        }
+}
+
+
+static int transmission_index(
+    const struct pumas_flux_transmission * transmission, double grammage,
+    double * h)
+{
+        /* Locate the grammage w.r.t. the CSDA range table */
+        const int n_k = transmission->n_k;
+        const double * const x = transmission->data + n_k;
+        if (grammage <= x[0]) {
+                *h = 0.;
+                return 0;
+        } else if (grammage >= x[n_k - 1]) {
+                *h = 0.;
+                return -1;
+        }
+
+        int i0 = 0, i1 = n_k - 1;
+        while (i1 - i0 > 1) {
+                const int i2 = (i0 + i1) / 2;
+                if (grammage >= x[i2]) i0 = i2;
+                else i1 = i2;
+        }
+        *h = (grammage - x[i0]) / (x[i1] - x[i0]);
+        return i0;
+}
+
+
+static double transmission_interpolate(double y0, double y1, double h)
+{
+        if ((y0 > 0.) && (y1 > 0.))
+                return exp(log(y0) * (1. - h) + log(y1) * h);
+        else
+                return y0 * (1. - h) + y1 * h;
+}
+
+
+double pumas_flux_transmission_energy(
+    const struct pumas_flux_transmission * transmission, double grammage)
+{
+        double h;
+        const int i = transmission_index(transmission, grammage, &h);
+        if (i < 0) return INFINITY;
+        else if (h == 0.) return transmission->data[i];
+
+        return transmission_interpolate(transmission->data[i],
+            transmission->data[i + 1], h);
+}
+
+
+double pumas_flux_transmission_get(
+    const struct pumas_flux_transmission * transmission, double grammage,
+    double cos_theta)
+{
+        if ((cos_theta < 0.) || (cos_theta > 1.)) return 0.;
+        double h;
+        const int i = transmission_index(transmission, grammage, &h);
+        if (i < 0) return 0.;
+
+        /* Locate cos(theta) */
+        const int n_k = transmission->n_k;
+        const int n_c = transmission->n_c;
+        double hc = cos_theta * (n_c - 1);
+        int j = (int)hc;
+        if (j >= n_c - 1) j = n_c - 2;
+        hc -= j;
+
+        /* Interpolate the integrated flux, using the same log(kinetic)
+         * coefficient than for the minimum energy
+         */
+        const double * const f0 = transmission->data + (2 + j) * n_k;
+        const double * const f1 = f0 + n_k;
+        const int i1 = (h > 0.) ? i + 1 : i;
+        const double g0 = transmission_interpolate(f0[i], f0[i1], h);
+        const double g1 = transmission_interpolate(f1[i], f1[i1], h);
+        return g0 * (1. - hc) + g1 * hc;
+}
+
+
+void pumas_flux_transmission_map(
+    const struct pumas_flux_transmission * transmission, int n_rows,
+    int n_columns, const double * grammage, const double * cos_theta,
+    double * flux)
+{
+        int i, j;
+        for (i = 0; i < n_rows; i++) {
+                for (j = 0; j < n_columns; j++) {
+                        const int k = i * n_columns + j;
+                        flux[k] = pumas_flux_transmission_get(transmission,
+                            grammage[k], cos_theta[i]);
+                }
+        }
+}
+
+
 /* The flux tabulation data */
 #include "flux_mceq.c"
 
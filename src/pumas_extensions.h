@@ -1,7 +1,17 @@
+#include <stdint.h>
+
 #include "gull.h"
 #include "pumas.h"
 #include "turtle.h"
 
+/* Scoring slot of a geometry volume, weighted by the Monte Carlo weight */
+struct pumas_geometry_score {
+        double crossings; /* Number of entries in the volume */
+        double length; /* Track length, in m */
+        double grammage; /* Column depth, in kg / m^2 */
+        double energy; /* Energy loss, in GeV */
+};
+
 /* Wrapper for geometries */
 struct pumas_geometry {
         void (*get)(struct pumas_geometry *, struct pumas_state *,
@@ -14,17 +24,149 @@ struct pumas_geometry {
         struct pumas_geometry * mother;
         struct pumas_geometry * daughters;
         struct pumas_geometry * next;
+
+        int exact; /* Flag for geometries providing exact steps */
+        struct pumas_geometry_score * score; /* Optional scoring slot */
+        struct pumas_geometry * next_reset; /* Next node with a reset */
 };
 
 /* A transparent medium, e.g. for a bounding box */
 extern struct pumas_medium * PUMAS_MEDIUM_TRANSPARENT;
 
+/* Flattened geometry tree, used for navigation (opaque) */
+struct pumas_geometry_flat;
+
+/* Weight window for variance reduction (Russian roulette) */
+struct pumas_weight_window {
+        int enabled;
+        double lower; /* Weight below which the roulette is played */
+        double survival; /* Weight of surviving particles */
+        int n_energies; /* Kinetic energy thresholds, in increasing order */
+        double energies[16];
+};
+
+/* Fields of Monte Carlo states that can be tallied */
+enum pumas_tally_field {
+        PUMAS_TALLY_CHARGE = 0,
+        PUMAS_TALLY_ENERGY,
+        PUMAS_TALLY_DISTANCE,
+        PUMAS_TALLY_GRAMMAGE,
+        PUMAS_TALLY_TIME,
+        PUMAS_TALLY_WEIGHT,
+        PUMAS_TALLY_POSITION_X,
+        PUMAS_TALLY_POSITION_Y,
+        PUMAS_TALLY_POSITION_Z,
+        PUMAS_TALLY_DIRECTION_X,
+        PUMAS_TALLY_DIRECTION_Y,
+        PUMAS_TALLY_DIRECTION_Z,
+        PUMAS_TALLY_N_FIELDS
+};
+
+/* Native tally, with online statistics and an optional 1D or 2D histogram */
+struct pumas_tally {
+        int step; /* Update at each Monte Carlo step instead of each event */
+        int weighted; /* Weight entries by the Monte Carlo weight */
+        int field[2]; /* Tallied fields, the 2nd one is -1 for 1D tallies */
+        int n[2]; /* Number of bins, 0 if no histogram */
+        int log[2]; /* Flag for a logarithmic binning */
+        double min[2];
+        double max[2];
+        double offset[2]; /* Binning parameters, in log scale if relevant */
+        double scale[2];
+
+        /* Online statistics of the 1st field (weighted Welford) */
+        double entries;
+        double sum_w;
+        double sum_w2;
+        double mean;
+        double m2;
+
+        /* Histogram of the sum of weights and of squared weights */
+        double data[];
+};
+
+void pumas_tally_update(
+    struct pumas_tally * tally, const struct pumas_state * state);
+
+void pumas_tally_merge(
+    struct pumas_tally * tally, const struct pumas_tally * other);
+
+/* Recorder callback for step tallies */
+void pumas_tally_record(struct pumas_context * context,
+    struct pumas_state * state, struct pumas_medium * medium,
+    enum pumas_event event);
+
+/* Extra fields of the event writer, beside tallied fields */
+enum pumas_writer_field {
+        PUMAS_WRITER_EVENT = PUMAS_TALLY_N_FIELDS,
+        PUMAS_WRITER_MEDIUM_START,
+        PUMAS_WRITER_MEDIUM_END,
+        PUMAS_WRITER_N_FIELDS
+};
+
+/* Columnar writer of Monte Carlo events, with a background I/O thread */
+struct pumas_event_writer;
+
+struct pumas_event_writer * pumas_event_writer_create(const char * path,
+    int n_fields, const int * fields, int chunk);
+
+int pumas_event_writer_push(struct pumas_event_writer * writer,
+    const struct pumas_state * state, int event, int medium_start,
+    int medium_end);
+
+int pumas_event_writer_flush(struct pumas_event_writer * writer);
+
+int pumas_event_writer_close(struct pumas_event_writer * writer,
+    int n_media, const char ** media);
+
+/* NUMA placement of worker processes (Linux only) */
+int pumas_numa_length(void);
+int pumas_numa_bind(int node);
+
+/* Native sampling profiler (POSIX only). Stacks are returned from the leaf
+ * frame, with NULL for unresolved symbols
+ */
+int pumas_profile_start(int size, double interval);
+int pumas_profile_stop(void);
+int pumas_profile_stack(int index, const char ** symbols, int depth);
+
+/* Mersenne Twister PRNG, with a serialisable state */
+struct pumas_random_state {
+        unsigned long seed;
+        int index;
+        uint32_t data[624];
+};
+
+double pumas_random_uniform01(struct pumas_context * context);
+
+void pumas_random_seed_set(
+    struct pumas_context * context, const unsigned long * seed);
+
+unsigned long pumas_random_seed_get(struct pumas_context * context);
+
+/* Checkpoint of the PRNG state, of the events counter and of tallies */
+enum pumas_return pumas_context_checkpoint(
+    struct pumas_context * context, const char * path);
+
+enum pumas_return pumas_context_restore(
+    struct pumas_context * context, const char * path);
+
 /* Layout of the user data section */
 struct pumas_user_data {
         struct pumas_geometry * top;
         struct pumas_geometry * current;
+        struct pumas_geometry * resets; /* Nodes with a per event state */
+        struct pumas_geometry_flat * flat; /* Flattened tree */
+        int current_index; /* Index of the current node in the flat tree */
         void (*callback)(struct pumas_geometry *, struct pumas_state *,
             struct pumas_medium *, double); /* User callback for debug */
+        struct pumas_weight_window window;
+        struct pumas_tally ** tallies; /* Native tallies */
+        int n_tallies;
+        int scoring; /* Flag for volume scoring, set during transport */
+        int restart; /* Flag for transport restarts, e.g. by weight windows */
+        struct pumas_random_state random;
+        double events; /* Number of transported events */
 };
 
 /* Forward errors */
@@ -48,6 +190,13 @@ struct pumas_state_extended {
                 double distance;
                 double last[3];
         } vertical;
+
+        struct {
+                struct pumas_geometry * geometry;
+                double distance;
+                double grammage;
+                double energy;
+        } score;
 };
 
 void pumas_state_extended_reset(struct pumas_state_extended * state,
@@ -103,11 +252,21 @@ void pumas_geometry_set(
 
 void pumas_geometry_destroy(struct pumas_context * context);
 
+/* Detach the geometry from the context, without destroying its nodes */
+void pumas_geometry_clear(struct pumas_context * context);
+
 void pumas_geometry_reset(struct pumas_context * context);
 
 void pumas_geometry_push(struct pumas_geometry * geometry,
     struct pumas_geometry * daughter);
 
+/* Transport with a weight window applied at geometry boundaries, and with
+ * native tallies
+ */
+enum pumas_return pumas_extended_transport(
+    struct pumas_context * context, struct pumas_state * state,
+    enum pumas_event * event, struct pumas_medium * media[2]);
+
 /* Generic geometry callback for PUMAS */
 enum pumas_step pumas_geometry_medium(struct pumas_context * context,
     struct pumas_state * state, struct pumas_medium ** medium_p,
@@ -131,6 +290,7 @@ struct pumas_geometry_earth {
         struct turtle_stepper * stepper[1];
         struct pumas_medium ** media;
         int n_layers;
+        double * flat; /* Altitudes of layers, if all of them are flat */
 
         struct {
                 double * workspace[1];
@@ -145,6 +305,10 @@ void pumas_geometry_earth_get(struct pumas_geometry * geometry,
     struct pumas_state * state, struct pumas_medium ** medium_p,
     double * step_p);
 
+void pumas_geometry_earth_flat_get(struct pumas_geometry * geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p);
+
 double pumas_geometry_earth_magnet(struct pumas_geometry * geometry,
     struct pumas_state * state, double * magnet);
 
@@ -154,6 +318,11 @@ void pumas_geometry_earth_reset(struct pumas_geometry * geometry);
 /* Finaliser for the Earth geometry */
 void pumas_geometry_earth_destroy(struct pumas_geometry * geometry);
 
+/* Geomagnetic snapshot from data in memory (Linux only) */
+enum gull_return pumas_geometry_earth_snapshot_create(
+    struct gull_snapshot ** snapshot, const char * data, long size, int day,
+    int month, int year);
+
 /* Data for the Polyhedron geometry */
 struct pumas_polyhedron_face {
         double origin[3];
@@ -173,6 +342,113 @@ void pumas_geometry_polyhedron_get(struct pumas_geometry * geometry,
     struct pumas_state * state, struct pumas_medium ** medium_p,
     double * step_p);
 
+/* Polygonal faces of a convex polyhedron, e.g. for exporting it */
+struct pumas_polyhedron_polygons {
+        int n_polygons;
+        int n_vertices;
+        int * faces; /* Index of the supporting face, per polygon */
+        int * sizes; /* Number of vertices, per polygon */
+        double * vertices; /* Grouped by polygon, counter-clockwise */
+};
+
+/* Compute the polygons of n polyhedrons, in parallel */
+int pumas_polyhedron_polygons(int n,
+    struct pumas_geometry_polyhedron ** polyhedrons,
+    struct pumas_polyhedron_polygons * polygons);
+
+/* Release the memory allocated for polygons */
+void pumas_polyhedron_polygons_clear(int n,
+    struct pumas_polyhedron_polygons * polygons);
+
+/* Triangle mesh, with a Bounding Volume Hierarchy for ray tracing */
+struct pumas_mesh;
+
+struct pumas_mesh * pumas_mesh_create(int n_triangles,
+    const double * vertices);
+
+void pumas_mesh_destroy(struct pumas_mesh * mesh);
+
+/* Per context data for the Mesh geometry */
+struct pumas_geometry_mesh {
+        struct pumas_geometry base;
+        struct pumas_medium * medium;
+        const struct pumas_mesh * mesh;
+};
+
+/* Getter for a Mesh geometry */
+void pumas_geometry_mesh_get(struct pumas_geometry * geometry,
+    struct pumas_state * state, struct pumas_medium ** medium_p,
+    double * step_p);
+
+/* Topography data for batched queries. Flat data have a NULL map and stack */
+struct pumas_topography_data {
+        struct turtle_map * map;
+        struct turtle_stack * stack;
+        double offset;
+};
+
+/* Locks for sharing topography stacks between threads */
+int pumas_topography_lock(void);
+int pumas_topography_unlock(void);
+
+/* Batched elevation, from the first data covering each point, or NaN */
+enum turtle_return pumas_topography_elevation(int n_data,
+    const struct pumas_topography_data * data, int n,
+    const double * latitude, const double * longitude, double * elevation,
+    int n_threads);
+
+/* Batched projection to map coordinates */
+enum turtle_return pumas_topography_project(
+    const struct pumas_topography_data * data, int n,
+    const double * latitude, const double * longitude, double * x,
+    double * y, int n_threads);
+
+/* Cache of topography maps. Loading fails for a stale cache, i.e. if the size
+ * or the modification time of the source data differ
+ */
+enum turtle_return pumas_topography_map_dump(struct turtle_map * map,
+    const char * path, double size, double mtime);
+
+enum turtle_return pumas_topography_map_load(struct turtle_map ** map,
+    const char * path, double size, double mtime);
+
+/* Plugin interface for user defined geometries and media
+ *
+ * A plugin is a shared library exporting a pumas_plugin_initialise function.
+ * Plugin geometries are created as regular nodes, i.e. they must set the get
+ * and destroy methods of their base. The exact flag of the base indicates if
+ * the get method provides exact steps to the boundaries.
+ */
+enum pumas_plugin_version {
+        PUMAS_PLUGIN_VERSION = 1
+};
+
+struct pumas_plugin_geometry {
+        const char * name;
+        /* Create a geometry node, given the media of its volumes */
+        struct pumas_geometry * (*create)(const char * options,
+            struct pumas_medium ** media, int n_media);
+};
+
+struct pumas_plugin_medium {
+        const char * name;
+        size_t size; /* Size of the medium object, including its base */
+        /* Initialise a zeroed medium object, e.g. set its locals method */
+        int (*initialise)(struct pumas_medium * medium, const char * options);
+};
+
+struct pumas_plugin {
+        int version; /* Must be PUMAS_PLUGIN_VERSION */
+        const char * name;
+        int n_geometries;
+        const struct pumas_plugin_geometry * geometries;
+        int n_media;
+        const struct pumas_plugin_medium * media;
+};
+
+/* Entry point of plugins */
+const struct pumas_plugin * pumas_plugin_initialise(void);
+
 /* Coordinates objects */
 struct pumas_coordinates_unitary_transformation {
     double translation[3];
@@ -277,6 +553,68 @@ void pumas_coordinates_spherical_vector_from_horizontal(
     struct pumas_spherical_vector * self,
     const struct pumas_horizontal_vector * vector);
 
+/* Arrays of coordinates, using a Structure of Arrays (SoA) layout */
+struct pumas_cartesian_point_array {
+    int size;
+    double * x, * y, * z;
+    struct pumas_coordinates_unitary_transformation * frame;
+};
+
+struct pumas_cartesian_vector_array {
+    int size;
+    double * x, * y, * z;
+    struct pumas_coordinates_unitary_transformation * frame;
+};
+
+struct pumas_geodetic_point_array {
+    int size;
+    double * latitude, * longitude, * altitude;
+};
+
+struct pumas_horizontal_vector_array {
+    int size;
+    double * norm, * elevation, * azimuth;
+    struct pumas_coordinates_unitary_transformation * frame;
+};
+
+/* Batched coordinates transforms */
+void pumas_coordinates_cartesian_point_array_transform(
+    struct pumas_cartesian_point_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame);
+
+void pumas_coordinates_cartesian_vector_array_transform(
+    struct pumas_cartesian_vector_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame);
+
+void pumas_coordinates_horizontal_vector_array_transform(
+    struct pumas_horizontal_vector_array * self,
+    const struct pumas_coordinates_unitary_transformation * frame);
+
+void pumas_coordinates_cartesian_point_array_from_geodetic(
+    struct pumas_cartesian_point_array * self,
+    const struct pumas_geodetic_point_array * points);
+
+void pumas_coordinates_cartesian_vector_array_from_horizontal(
+    struct pumas_cartesian_vector_array * self,
+    const struct pumas_horizontal_vector_array * vectors);
+
+void pumas_coordinates_geodetic_point_array_from_cartesian(
+    struct pumas_geodetic_point_array * self,
+    const struct pumas_cartesian_point_array * points);
+
+void pumas_coordinates_horizontal_vector_array_from_cartesian(
+    struct pumas_horizontal_vector_array * self,
+    const struct pumas_cartesian_vector_array * vectors);
+
+/* Grammage along straight lines, without physics sampling */
+double pumas_geometry_grammage(struct pumas_context * context,
+    struct pumas_state * state, double distance_max);
+
+void pumas_geometry_grammage_map(struct pumas_context * context,
+    struct pumas_state * state,
+    const struct pumas_cartesian_vector_array * directions,
+    double distance_max, double * grammage);
+
 /* Rotation matrix from Euler angles */
 void pumas_coordinates_unitary_transformation_from_euler(
     struct pumas_coordinates_unitary_transformation * transformation,
@@ -289,6 +627,16 @@ void pumas_coordinates_frame_initialise_local(
     const struct pumas_geodetic_point * geodetic, double declination,
     double inclination);
 
+/* Vectorised access to the material tables and properties */
+enum pumas_return pumas_physics_table_array(
+    const struct pumas_physics * physics, enum pumas_property property,
+    enum pumas_mode scheme, int material, double * values);
+
+enum pumas_return pumas_physics_property_array(
+    const struct pumas_physics * physics, enum pumas_property property,
+    enum pumas_mode scheme, int material, int n, const double * input,
+    double * output);
+
 /* Flux tabulations */
 struct pumas_flux_tabulation {
         int n_k;
@@ -310,3 +658,25 @@ double pumas_flux_tabulation_get(
     double h, double charge);
 
 extern struct pumas_flux_tabulation * pumas_flux_tabulation_data[1];
+
+/* Transmitted flux through a given grammage */
+struct pumas_flux_transmission {
+        int n_k;
+        int n_c;
+        double data[];
+};
+
+void pumas_flux_transmission_integrate(
+    struct pumas_flux_transmission * transmission);
+
+double pumas_flux_transmission_energy(
+    const struct pumas_flux_transmission * transmission, double grammage);
+
+double pumas_flux_transmission_get(
+    const struct pumas_flux_transmission * transmission, double grammage,
+    double cos_theta);
+
+void pumas_flux_transmission_map(
+    const struct pumas_flux_transmission * transmission, int n_rows,
+    int n_columns, const double * grammage, const double * cos_theta,
+    double * flux);
@@ -120,7 +120,7 @@ runtime.NOTICE = string.format(
 -- The REPL
 -------------------------------------------------------------------------------
 function runtime.repl ()
-    local interactive
+    local interactive, jobs, numa, profile
     local index = 1
     while index <= #arg do
         local optstr = arg[index]
@@ -130,8 +130,12 @@ function runtime.repl ()
         index = index + 1
 
         local opt = optstr:sub(2, 2)
-        if opt == 'i' then
+        if optstr:match('^%-%-profile') then
+            profile = optstr:match('^%-%-profile=(.+)$') or 'pumas.folded'
+        elseif opt == 'i' then
             interactive = true
+        elseif opt == 'n' then
+            numa = true
         elseif opt == '-' then
             break
         else
@@ -150,6 +154,11 @@ function runtime.repl ()
                 if interactive ~= true then
                     interactive = false
                 end
+            elseif opt == 'j' then
+                jobs = tonumber(optarg)
+                if (jobs == nil) or (jobs < 1) or (jobs % 1 ~= 0) then
+                    error('bad number of jobs for option -j', 2)
+                end
             elseif opt == 'l' then
                 require(optarg)
             else
@@ -161,7 +170,24 @@ function runtime.repl ()
     if arg[index] ~= nil then
         for i = 0, #arg do arg[i - index] = arg[i] end
         for _ = 1, index do table.remove(arg) end
-        dofile(arg[0])
+        if numa and not jobs then
+            error('option -n requires option -j', 2)
+        end
+        if profile and jobs then
+            error('option --profile cannot be combined with option -j', 2)
+        end
+        if jobs then
+            require('pumas.job').run(jobs, arg[0], numa)
+        elseif profile then
+            local profile_ = require('pumas.profile')
+            local script = arg[0]
+            local report = profile_.profile(function ()
+                return dofile(script)
+            end, {output = profile})
+            io.stderr:write(profile_.summary(report), '\n')
+        else
+            dofile(arg[0])
+        end
         if interactive ~= true then return end
     elseif interactive == false then
         return